@@ -199,6 +199,15 @@ typedef struct CassBatch_ CassBatch;
  */
 typedef struct CassFuture_ CassFuture;
 
+/**
+ * A queue that completed request futures are posted to. It allows a single
+ * application thread to handle the completions of many requests per wakeup
+ * instead of waiting on each future individually.
+ *
+ * @struct CassCompletionQueue
+ */
+typedef struct CassCompletionQueue_ CassCompletionQueue;
+
 /**
  * A statement that has been prepared cluster-side (It has been pre-parsed
  * and cached).
@@ -451,6 +460,12 @@ typedef struct CassSpeculativeExecutionMetrics_ {
   cass_double_t percentage; /**< Fraction of requests that are aborted speculative retries */
 } CassSpeculativeExecutionMetrics;
 
+typedef struct CassRetryMetrics_ {
+  cass_uint64_t retries; /**< The number of retries */
+  cass_uint64_t throttled_retries; /**< The number of retries prevented by the retry budget */
+  cass_double_t available_retries; /**< The number of retries currently available in the session's retry budget (0.0 if disabled) */
+} CassRetryMetrics;
+
 typedef enum CassConsistency_ {
   CASS_CONSISTENCY_UNKNOWN      = 0xFFFF,
   CASS_CONSISTENCY_ANY          = 0x0000,
@@ -582,6 +597,16 @@ typedef enum CassBatchType_ {
   CASS_BATCH_TYPE_COUNTER  = 0x02
 } CassBatchType;
 
+typedef enum CassRequestPriority_ {
+  CASS_REQUEST_PRIORITY_HIGH,
+  CASS_REQUEST_PRIORITY_NORMAL,
+  CASS_REQUEST_PRIORITY_LOW,
+  /* @cond IGNORE */
+  CASS_REQUEST_PRIORITY_LAST_ENTRY,
+  /* @endcond */
+  CASS_REQUEST_PRIORITY_UNKNOWN = 0xFFFF
+} CassRequestPriority;
+
 typedef enum CassIteratorType_ {
   CASS_ITERATOR_TYPE_RESULT,
   CASS_ITERATOR_TYPE_ROW,
@@ -685,6 +710,9 @@ typedef enum  CassErrorSource_ {
   XX(CASS_ERROR_SOURCE_LIB, CASS_ERROR_LIB_NO_CUSTOM_PAYLOAD, 33, "No custom payload") \
   XX(CASS_ERROR_SOURCE_LIB, CASS_ERROR_LIB_EXECUTION_PROFILE_INVALID, 34, "Invalid execution profile specified") \
   XX(CASS_ERROR_SOURCE_LIB, CASS_ERROR_LIB_NO_TRACING_ID, 35, "No tracing ID") \
+  XX(CASS_ERROR_SOURCE_LIB, CASS_ERROR_LIB_REQUEST_DEADLINE_EXCEEDED, 36, "Request deadline exceeded") \
+  XX(CASS_ERROR_SOURCE_LIB, CASS_ERROR_LIB_RATE_LIMITED, 37, "Request rate limit reached") \
+  XX(CASS_ERROR_SOURCE_LIB, CASS_ERROR_LIB_RETRY_BUDGET_EXHAUSTED, 38, "Retry budget exhausted") \
   XX(CASS_ERROR_SOURCE_SERVER, CASS_ERROR_SERVER_SERVER_ERROR, 0x0000, "Server error") \
   XX(CASS_ERROR_SOURCE_SERVER, CASS_ERROR_SERVER_PROTOCOL_ERROR, 0x000A, "Protocol error") \
   XX(CASS_ERROR_SOURCE_SERVER, CASS_ERROR_SERVER_BAD_CREDENTIALS, 0x0100, "Bad credentials") \
@@ -968,6 +996,78 @@ CASS_EXPORT CassError
 cass_execution_profile_set_request_timeout(CassExecProfile* profile,
                                            cass_uint64_t timeout_ms);
 
+/**
+ * Sets the priority of requests using the execution profile.
+ *
+ * <b>Default:</b> CASS_REQUEST_PRIORITY_UNKNOWN (uses the cluster priority)
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] priority
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_priority_lanes()
+ * @see cass_statement_set_priority()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_priority(CassExecProfile* profile,
+                                    CassRequestPriority priority);
+
+/**
+ * Sets a client-side rate limit for requests using the execution profile. The
+ * limit is shared by all the I/O threads of a session and allows bursts of up
+ * to one second worth of requests (and bytes).
+ *
+ * <b>Default:</b> No limit
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] requests_per_second The maximum number of requests per second.
+ * Fractional rates are allowed and the burst is always at least one request.
+ * Use 0.0 for no limit.
+ * @param[in] bytes_per_second The maximum number of bytes written per second,
+ * including retries and speculative executions. Use 0 for no limit.
+ * @param[in] queue_excess_requests If cass_true, requests over the limit wait
+ * on their I/O thread until the limit allows them to be sent, otherwise they
+ * fail with CASS_ERROR_LIB_RATE_LIMITED.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_rate_limit()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_rate_limit(CassExecProfile* profile,
+                                      cass_double_t requests_per_second,
+                                      cass_uint64_t bytes_per_second,
+                                      cass_bool_t queue_excess_requests);
+
+/**
+ * Enables/Disables coalescing identical concurrent reads that use the
+ * execution profile. An idempotent, bound read (EXECUTE) that is identical to
+ * a read already in flight on the same I/O thread (same prepared statement,
+ * values, consistency and paging state) isn't sent; instead it's completed
+ * with the in-flight request's result (or error).
+ *
+ * <b>Note:</b> Coalesced requests share the first request's timeout and
+ * aren't traced. Reads using a specific host, tracing or a custom payload are
+ * never coalesced.
+ *
+ * <b>Default:</b> cass_false (disabled).
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] enabled
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_singleflight_reads()
+ * @see cass_statement_set_is_idempotent()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_singleflight_reads(CassExecProfile* profile,
+                                              cass_bool_t enabled);
+
 /**
  * Sets the consistency level.
  *
@@ -1204,6 +1304,207 @@ cass_execution_profile_set_latency_aware_routing_settings(CassExecProfile* profi
                                                           cass_uint64_t update_rate_ms,
                                                           cass_uint64_t min_measured);
 
+/**
+ * Configures the cluster to use peak EWMA (load-aware) request routing or not.
+ *
+ * <b>Default:</b> cass_false (disabled).
+ *
+ * This routing policy is a top-level routing policy. It reorders the first
+ * hosts of the base routing policy's plan (e.g. the replicas when token-aware
+ * routing is enabled) by their load: a moving average of their response
+ * latency that immediately follows latency spikes (peak EWMA) multiplied by
+ * their number of in-flight requests. The latency is updated on every
+ * response, so requests move away from a slow or overloaded node quickly.
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] enabled
+ */
+CASS_EXPORT void
+cass_cluster_set_peak_ewma_routing(CassCluster* cluster,
+                                   cass_bool_t enabled);
+
+/**
+ * Configures the settings for peak EWMA request routing.
+ *
+ * <b>Defaults:</b>
+ *
+ * <ul>
+ *   <li>decay_ms: 10,000 milliseconds (10 seconds)</li>
+ *   <li>max_candidates: 3</li>
+ * </ul>
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] decay_ms The time it takes for a latency measurement's weight in
+ * the moving average to decay by a factor of e. A bigger value gives more
+ * weight to older latency measurements. It must be between 1 and 86,400,000
+ * milliseconds (1 day). A host has a single moving average so when execution
+ * profiles use different decays the first one to be applied to a host is used
+ * (and a warning is logged).
+ * @param[in] max_candidates The number of hosts from the start of the base
+ * routing policy's plan that are ranked by load. This should usually match the
+ * replication factor of the local data center.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+CASS_EXPORT CassError
+cass_cluster_set_peak_ewma_routing_settings(CassCluster* cluster,
+                                            cass_uint64_t decay_ms,
+                                            unsigned max_candidates);
+
+/**
+ * Configures the cluster to use outlier detection or not.
+ *
+ * <b>Default:</b> cass_false (disabled).
+ *
+ * Outlier detection tracks the failure rate of each host (request timeouts,
+ * connection errors and overloaded, server or bootstrapping errors) and
+ * temporarily ejects hosts that fail too many of their requests, for example
+ * a node that is UP but stuck in long garbage collection pauses. Ejected hosts
+ * are moved to the end of query plans and once the ejection ends they're
+ * gradually given more requests. Hosts that are ejected repeatedly are ejected
+ * for exponentially longer periods.
+ *
+ * This routing policy is a top-level routing policy and is applied after all
+ * other routing policies.
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] enabled
+ */
+CASS_EXPORT void
+cass_cluster_set_outlier_detection(CassCluster* cluster,
+                                   cass_bool_t enabled);
+
+/**
+ * Configures the settings for outlier detection.
+ *
+ * <b>Defaults:</b>
+ *
+ * <ul>
+ *   <li>failure_rate_threshold: 0.5</li>
+ *   <li>min_requests: 20</li>
+ *   <li>interval_ms: 1,000 milliseconds (1 second)</li>
+ *   <li>base_ejection_ms: 10,000 milliseconds (10 seconds)</li>
+ *   <li>max_ejection_ms: 300,000 milliseconds (5 minutes)</li>
+ * </ul>
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] failure_rate_threshold The portion of failed requests in an
+ * interval, in the range (0.0, 1.0], that causes a host to be ejected.
+ * @param[in] min_requests The minimum number of requests in an interval before
+ * a host can be ejected.
+ * @param[in] interval_ms The interval over which failure rates are computed.
+ * @param[in] base_ejection_ms The time a host is ejected for the first time.
+ * Each consecutive ejection doubles this time. This is also the time it takes
+ * for a host to receive its full share of requests after an ejection ends.
+ * @param[in] max_ejection_ms The maximum time a host is ejected.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+CASS_EXPORT CassError
+cass_cluster_set_outlier_detection_settings(CassCluster* cluster,
+                                            cass_double_t failure_rate_threshold,
+                                            unsigned min_requests,
+                                            cass_uint64_t interval_ms,
+                                            cass_uint64_t base_ejection_ms,
+                                            cass_uint64_t max_ejection_ms);
+
+/**
+ * Configures the execution profile to use peak EWMA (load-aware) request
+ * routing or not.
+ *
+ * <b>Note:</b> Execution profiles use the cluster-level load balancing policy
+ * unless enabled. This setting is not applicable unless a load balancing policy
+ * is enabled on the execution profile.
+ *
+ * <b>Default:</b> cass_false (disabled).
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] enabled
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_peak_ewma_routing()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_peak_ewma_routing(CassExecProfile* profile,
+                                             cass_bool_t enabled);
+
+/**
+ * Configures the execution profile's settings for peak EWMA request routing.
+ *
+ * <b>Note:</b> Execution profiles use the cluster-level load balancing policy
+ * unless enabled. This setting is not applicable unless a load balancing policy
+ * is enabled on the execution profile.
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] decay_ms
+ * @param[in] max_candidates
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_peak_ewma_routing_settings()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_peak_ewma_routing_settings(CassExecProfile* profile,
+                                                      cass_uint64_t decay_ms,
+                                                      unsigned max_candidates);
+
+/**
+ * Configures the execution profile to use outlier detection or not.
+ *
+ * <b>Note:</b> Execution profiles use the cluster-level load balancing policy
+ * unless enabled. This setting is not applicable unless a load balancing policy
+ * is enabled on the execution profile.
+ *
+ * <b>Default:</b> cass_false (disabled).
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] enabled
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_outlier_detection()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_outlier_detection(CassExecProfile* profile,
+                                             cass_bool_t enabled);
+
+/**
+ * Configures the execution profile's settings for outlier detection.
+ *
+ * <b>Note:</b> Execution profiles use the cluster-level load balancing policy
+ * unless enabled. This setting is not applicable unless a load balancing policy
+ * is enabled on the execution profile.
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] failure_rate_threshold
+ * @param[in] min_requests
+ * @param[in] interval_ms
+ * @param[in] base_ejection_ms
+ * @param[in] max_ejection_ms
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_outlier_detection_settings()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_outlier_detection_settings(CassExecProfile* profile,
+                                                      cass_double_t failure_rate_threshold,
+                                                      unsigned min_requests,
+                                                      cass_uint64_t interval_ms,
+                                                      cass_uint64_t base_ejection_ms,
+                                                      cass_uint64_t max_ejection_ms);
+
 /**
  * Sets/Appends whitelist hosts for the execution profile. The first call sets
  * the whitelist hosts and any subsequent calls appends additional hosts.
@@ -1426,6 +1727,36 @@ cass_execution_profile_set_constant_speculative_execution_policy(CassExecProfile
                                                                  cass_int64_t constant_delay_ms,
                                                                  int max_speculative_executions);
 
+/**
+ * Enable adaptive speculative executions for the execution profile. The delay
+ * before a speculative execution is started is the given percentile of the
+ * profile's recent request latencies (recomputed every 5 seconds).
+ * Speculative executions aren't started until enough latencies have been
+ * recorded.
+ *
+ * <b>Note:</b> Profile-based speculative execution policy is disabled by
+ * default; cluster speculative execution policy is used when profile does not
+ * contain a policy.
+ *
+ * @public @memberof CassExecProfile
+ *
+ * @param[in] profile
+ * @param[in] percentile The latency percentile used as the delay (e.g. 95.0 or
+ * 99.0).
+ * @param[in] max_speculative_executions
+ * @param[in] max_speculative_ratio The maximum share of requests, from 0.0 to
+ * 1.0, that can start a speculative execution. This prevents speculative
+ * executions from multiplying the load when latencies increase.
+ * @return CASS_OK if successful, otherwise an error occurred
+ *
+ * @see cass_cluster_set_percentile_speculative_execution_policy()
+ */
+CASS_EXPORT CassError
+cass_execution_profile_set_percentile_speculative_execution_policy(CassExecProfile* profile,
+                                                                   cass_double_t percentile,
+                                                                   int max_speculative_executions,
+                                                                   cass_double_t max_speculative_ratio);
+
 /**
  * Disable speculative executions for the execution profile.
  *
@@ -2024,6 +2355,85 @@ CASS_EXPORT void
 cass_cluster_set_resolve_timeout(CassCluster* cluster,
                                  unsigned timeout_ms);
 
+/**
+ * Sets how long resolved contact point and proxy (e.g. cloud SNI) hostnames
+ * are cached. The cache is shared by all sessions in the process so repeated
+ * connections and reconnections to the same hostname don't wait on DNS. After
+ * the TTL has passed the cached addresses are still used while the hostname
+ * is resolved again in the background, and they're kept if that resolution
+ * fails.
+ *
+ * <b>Note:</b> The system resolver doesn't provide the TTL of DNS records so
+ * this should be set to a value that's less than or equal to the records'
+ * TTL.
+ *
+ * <b>Default:</b> 0 milliseconds (disabled)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] ttl_ms TTL in milliseconds. Use 0 to disable.
+ *
+ * @see cass_cluster_set_resolve_timeout()
+ */
+CASS_EXPORT void
+cass_cluster_set_resolve_cache_ttl(CassCluster* cluster,
+                                   unsigned ttl_ms);
+
+/**
+ * Sets the delay between staggered connection attempts to the contact points
+ * when establishing the initial control connection.
+ *
+ * When the delay is greater than zero the contact points race each other:
+ * a connection attempt is started as soon as a contact point is resolved,
+ * and the next contact point is tried if the previous attempt hasn't
+ * finished within the delay or has failed. The first control connection to
+ * finish protocol negotiation is kept and the remaining attempts are
+ * canceled. This avoids waiting on a slow or unavailable contact point
+ * without opening a connection to every contact point at once.
+ *
+ * When the delay is zero all contact points are resolved and then connected
+ * to at the same time.
+ *
+ * <b>Default:</b> 0 milliseconds (disabled)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] delay_ms Delay in milliseconds. Use 0 to disable.
+ *
+ * @see cass_cluster_set_resolve_timeout()
+ */
+CASS_EXPORT void
+cass_cluster_set_contact_point_connect_delay(CassCluster* cluster,
+                                             unsigned delay_ms);
+
+/**
+ * Enable completing the session connection as soon as the connection pools to
+ * the local hosts (as determined by the load balancing policy's host
+ * distance, e.g. the local datacenter) are established.
+ *
+ * The connection pools to the remaining remote hosts are connected in the
+ * background after the session is connected and requests are only sent to
+ * those hosts once their pools are up. If none of the local hosts can be
+ * connected then the session waits for the remote hosts instead.
+ *
+ * This can greatly reduce the time it takes to connect a session to a cluster
+ * with many remote hosts.
+ *
+ * <b>Default:</b> cass_false (wait for all hosts)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] enabled
+ *
+ * @see cass_cluster_set_load_balance_dc_aware()
+ */
+CASS_EXPORT void
+cass_cluster_set_local_hosts_first_connect(CassCluster* cluster,
+                                           cass_bool_t enabled);
+
 /**
  * Sets the maximum time to wait for schema agreement after a schema change
  * is made (e.g. creating, altering, dropping a table/keyspace/view/index etc).
@@ -2543,6 +2953,202 @@ CASS_EXPORT void
 cass_cluster_set_retry_policy(CassCluster* cluster,
                               CassRetryPolicy* retry_policy);
 
+/**
+ * Sets a session-wide retry budget that limits retries to a ratio of recent
+ * requests. Each request adds a fraction of a retry to the budget of the
+ * session and of the host it's sent to, and each retry takes a whole retry
+ * from the budget of the session and of the host that failed. This prevents
+ * retries from amplifying an overload. When the budget is exhausted the
+ * request's error is returned instead of retrying. If there's no error from
+ * a node to return (e.g. the connection was closed) the request fails with
+ * CASS_ERROR_LIB_RETRY_BUDGET_EXHAUSTED.
+ *
+ * The budget applies to retries decided by the retry policy and to retries of
+ * idempotent requests after a connection is closed.
+ *
+ * <b>Default:</b> 0.0 (disabled)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] retry_ratio The ratio of retries to requests, from 0.0 to 1.0
+ * (e.g. 0.1 allows 1 retry for every 10 requests). A ratio of 0.0 disables the
+ * retry budget.
+ * @param[in] max_retries The maximum number of retries that can be saved up,
+ * this allows bursts of retries after a period without failures. The budget
+ * starts full. Default: 10
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_session_get_retry_metrics()
+ */
+CASS_EXPORT CassError
+cass_cluster_set_retry_budget(CassCluster* cluster,
+                              cass_double_t retry_ratio,
+                              unsigned max_retries);
+
+/**
+ * Enables/Disables an adaptive limit on the number of in-flight requests to
+ * each host. The limit is adjusted using additive-increase/multiplicative-decrease
+ * based on the measured round-trip time of requests: it slowly grows while
+ * latencies stay close to the host's minimum round-trip time and shrinks
+ * quickly when latencies rise or requests time out or are rejected as
+ * overloaded. Hosts at their limit are skipped by query plans.
+ *
+ * <b>Default:</b> cass_false (disabled).
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] enabled
+ * @param[in] queue_excess_requests If cass_true, requests wait in the
+ * session's request queue while every connected host is at its limit,
+ * otherwise they fail fast with CASS_ERROR_LIB_NO_HOSTS_AVAILABLE. Requests
+ * waiting in the queue are bounded by the queue size
+ * (cass_cluster_set_queue_size_io()).
+ *
+ * @see cass_cluster_set_adaptive_concurrency_limit_settings()
+ */
+CASS_EXPORT void
+cass_cluster_set_adaptive_concurrency_limit(CassCluster* cluster,
+                                            cass_bool_t enabled,
+                                            cass_bool_t queue_excess_requests);
+
+/**
+ * Sets the settings for the adaptive concurrency limit.
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] initial_limit The limit used for a host before any requests have
+ * completed. Default: 20
+ * @param[in] min_limit The minimum limit. Default: 1
+ * @param[in] max_limit The maximum limit. Default: 1000
+ * @param[in] backoff_ratio The ratio the limit is multiplied by when the host
+ * is congested, between 0.0 and 1.0 (exclusive). Default: 0.9
+ * @param[in] latency_tolerance A host is considered congested when a request's
+ * round-trip time exceeds its minimum round-trip time by this factor. Must be
+ * at least 1.0. Default: 2.0
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_adaptive_concurrency_limit()
+ */
+CASS_EXPORT CassError
+cass_cluster_set_adaptive_concurrency_limit_settings(CassCluster* cluster,
+                                                     unsigned initial_limit,
+                                                     unsigned min_limit,
+                                                     unsigned max_limit,
+                                                     cass_double_t backoff_ratio,
+                                                     cass_double_t latency_tolerance);
+
+/**
+ * Enables priority lanes. Each priority has a separate request queue and
+ * requests are taken from the queues using weighted round-robin so that
+ * a large number of low priority requests (e.g. bulk loading) doesn't delay
+ * high priority requests sharing the same connections.
+ *
+ * The priority of a request is set using cass_statement_set_priority(),
+ * cass_batch_set_priority(), cass_execution_profile_set_priority() or
+ * cass_cluster_set_priority(). Each queue has the size set by
+ * cass_cluster_set_queue_size_io().
+ *
+ * <b>Default:</b> Disabled (a single request queue is used)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] high_weight The relative share of requests taken from the high
+ * priority queue. Default: 16
+ * @param[in] normal_weight The relative share of requests taken from the
+ * normal priority queue. Default: 4
+ * @param[in] low_weight The relative share of requests taken from the low
+ * priority queue. Default: 1
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_priority_lane_max_inflight_requests()
+ */
+CASS_EXPORT CassError
+cass_cluster_set_priority_lanes(CassCluster* cluster,
+                                unsigned high_weight,
+                                unsigned normal_weight,
+                                unsigned low_weight);
+
+/**
+ * Sets the maximum number of in-flight requests of a priority (per I/O
+ * thread). Requests of that priority wait in their queue while the limit is
+ * reached. This has no effect unless priority lanes are enabled.
+ *
+ * <b>Default:</b> 0 (no limit)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] priority
+ * @param[in] max_inflight_requests Use 0 for no limit.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_priority_lanes()
+ */
+CASS_EXPORT CassError
+cass_cluster_set_priority_lane_max_inflight_requests(CassCluster* cluster,
+                                                     CassRequestPriority priority,
+                                                     unsigned max_inflight_requests);
+
+/**
+ * Sets the default priority of requests.
+ *
+ * <b>Default:</b> CASS_REQUEST_PRIORITY_NORMAL
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] priority
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_priority_lanes()
+ */
+CASS_EXPORT CassError
+cass_cluster_set_priority(CassCluster* cluster,
+                          CassRequestPriority priority);
+
+/**
+ * Sets a client-side rate limit for requests that use the default execution
+ * profile. Execution profiles have their own rate limit.
+ *
+ * <b>Default:</b> No limit
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] requests_per_second
+ * @param[in] bytes_per_second
+ * @param[in] queue_excess_requests
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_execution_profile_set_rate_limit()
+ */
+CASS_EXPORT CassError
+cass_cluster_set_rate_limit(CassCluster* cluster,
+                            cass_double_t requests_per_second,
+                            cass_uint64_t bytes_per_second,
+                            cass_bool_t queue_excess_requests);
+
+/**
+ * Enables/Disables coalescing identical concurrent reads that use the default
+ * execution profile.
+ *
+ * <b>Default:</b> cass_false (disabled).
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] enabled
+ *
+ * @see cass_execution_profile_set_singleflight_reads()
+ */
+CASS_EXPORT void
+cass_cluster_set_singleflight_reads(CassCluster* cluster,
+                                    cass_bool_t enabled);
+
 /**
  * Enable/Disable retrieving and updating schema metadata. If disabled
  * this is allows the driver to skip over retrieving and updating schema
@@ -2562,6 +3168,47 @@ CASS_EXPORT void
 cass_cluster_set_use_schema(CassCluster* cluster,
                             cass_bool_t enabled);
 
+/**
+ * Sets the keyspaces that schema metadata is retrieved and updated for.
+ * Table, view, column, index, user type, function and aggregate metadata is
+ * only retrieved for these keyspaces, which reduces the startup time and
+ * memory used by sessions connected to clusters with many keyspaces. Keyspace
+ * metadata, including the replication strategy used for token-aware routing,
+ * is still retrieved for every keyspace.
+ *
+ * Examples: "keyspace1", "keyspace1,keyspace2"
+ *
+ * <b>Note:</b> Keyspace names are case-sensitive.
+ *
+ * <b>Default:</b> Empty string (all keyspaces)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] keyspaces A comma delimited list of keyspaces. An empty string
+ * clears the list and metadata is retrieved for all keyspaces.
+ *
+ * @see cass_cluster_set_use_schema()
+ */
+CASS_EXPORT void
+cass_cluster_set_schema_metadata_keyspaces(CassCluster* cluster,
+                                           const char* keyspaces);
+
+/**
+ * Same as cass_cluster_set_schema_metadata_keyspaces(), but with lengths for
+ * string parameters.
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] keyspaces
+ * @param[in] keyspaces_length
+ */
+CASS_EXPORT void
+cass_cluster_set_schema_metadata_keyspaces_n(CassCluster* cluster,
+                                             const char* keyspaces,
+                                             size_t keyspaces_length);
+
 /**
  * Enable/Disable retrieving hostnames for IP addresses using reverse IP lookup.
  *
@@ -2615,6 +3262,29 @@ cass_cluster_set_constant_speculative_execution_policy(CassCluster* cluster,
                                                        cass_int64_t constant_delay_ms,
                                                        int max_speculative_executions);
 
+/**
+ * Enable adaptive speculative executions. The delay before a speculative
+ * execution is started is the given percentile of the recent request
+ * latencies (recomputed every 5 seconds). Speculative executions aren't
+ * started until enough latencies have been recorded.
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] percentile The latency percentile used as the delay (e.g. 95.0 or
+ * 99.0).
+ * @param[in] max_speculative_executions
+ * @param[in] max_speculative_ratio The maximum share of requests, from 0.0 to
+ * 1.0, that can start a speculative execution. This prevents speculative
+ * executions from multiplying the load when latencies increase.
+ * @return CASS_OK if successful, otherwise an error occurred
+ */
+CASS_EXPORT CassError
+cass_cluster_set_percentile_speculative_execution_policy(CassCluster* cluster,
+                                                         cass_double_t percentile,
+                                                         int max_speculative_executions,
+                                                         cass_double_t max_speculative_ratio);
+
 /**
  * Disable speculative executions
  *
@@ -2728,6 +3398,56 @@ CASS_EXPORT CassError
 cass_cluster_set_prepare_on_up_or_add_host(CassCluster* cluster,
                                            cass_bool_t enabled);
 
+/**
+ * Sets the number of the most recently executed prepared statements that need
+ * to be prepared on a host that becomes available again, or is added, before
+ * the host is used for requests. The remaining statements are prepared in the
+ * background afterwards.
+ *
+ * Statements are prepared in order of most recent use and are spread over as
+ * many connections as the host's connection pool uses.
+ *
+ * <b>Default:</b> 0 (all statements are prepared before the host is used)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] count The number of statements. Use 0 to wait for all statements.
+ *
+ * @see cass_cluster_set_prepare_on_up_or_add_host()
+ */
+CASS_EXPORT void
+cass_cluster_set_prepare_on_up_or_add_host_hot_statements(CassCluster* cluster,
+                                                          unsigned count);
+
+/**
+ * Enable automatic preparation of simple statements. Once the same query
+ * string (and keyspace) has been executed <b>threshold</b> times it's prepared
+ * in the background and later executions of it are sent as bound statements,
+ * which avoids re-parsing the query on the server, skips the result metadata
+ * in responses and allows token-aware routing without setting a routing key.
+ *
+ * Only the <b>max_statements</b> most recently executed queries are tracked.
+ * Statements using named values or custom payloads are always sent as simple
+ * statements. The tracked statements are forgotten when the session's keyspace
+ * is changed using a "USE <keyspace>" query.
+ *
+ * <b>Default:</b> 0 (disabled), 1024
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] threshold The number of executions before a statement is
+ * prepared. Use 0 to disable automatic preparation.
+ * @param[in] max_statements The maximum number of tracked statements.
+ *
+ * @see cass_session_prepare()
+ */
+CASS_EXPORT void
+cass_cluster_set_auto_prepare(CassCluster* cluster,
+                              unsigned threshold,
+                              unsigned max_statements);
+
 /**
  * Enable the <b>NO_COMPACT</b> startup option.
  *
@@ -2833,6 +3553,49 @@ cass_cluster_set_cloud_secure_connection_bundle_no_ssl_lib_init_n(CassCluster* c
                                                                   const char* path,
                                                                   size_t path_length);
 
+/**
+ * Sets the path of a prepared statement snapshot. When a session is closed it
+ * saves its prepared statements to the snapshot and the next session that
+ * connects using the same path uses the snapshot to complete
+ * cass_session_prepare() calls for previously prepared statements without
+ * waiting for the server. Those statements are still prepared in the
+ * background and the snapshot's results are replaced once the server
+ * responds.
+ *
+ * The snapshot also records the cluster's hosts and tokens, but only to
+ * validate it. Sessions still connect and discover the cluster before
+ * routing requests. The snapshot is only used if it was saved by a session
+ * that used the same protocol version and keyspace, and the host used for
+ * the control connection has the same partitioner and tokens, otherwise it's
+ * ignored.
+ *
+ * <b>Default:</b> Empty string (disabled)
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] path The snapshot's file path. Use an empty string to disable
+ * the snapshot.
+ */
+CASS_EXPORT void
+cass_cluster_set_prepared_snapshot(CassCluster* cluster,
+                                   const char* path);
+
+/**
+ * Same as cass_cluster_set_prepared_snapshot(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof CassCluster
+ *
+ * @param[in] cluster
+ * @param[in] path
+ * @param[in] path_length
+ */
+CASS_EXPORT void
+cass_cluster_set_prepared_snapshot_n(CassCluster* cluster,
+                                     const char* path,
+                                     size_t path_length);
+
 /**
  * Set the application name.
  *
@@ -3112,6 +3875,75 @@ CASS_EXPORT CassFuture*
 cass_session_execute_batch(CassSession* session,
                            const CassBatch* batch);
 
+/**
+ * Execute a query or bound statement. The future is posted to the completion
+ * queue, along with the tag, once the request completes instead of being
+ * returned. Futures drained from the queue must be freed.
+ *
+ * @public @memberof CassSession
+ *
+ * @param[in] session
+ * @param[in] statement
+ * @param[in] completion_queue
+ * @param[in] tag An application value returned with the completed future.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_completion_queue_poll()
+ * @see cass_completion_queue_wait_timed()
+ */
+CASS_EXPORT CassError
+cass_session_execute_cq(CassSession* session,
+                        const CassStatement* statement,
+                        CassCompletionQueue* completion_queue,
+                        void* tag);
+
+/**
+ * Execute a batch statement. The future is posted to the completion queue,
+ * along with the tag, once the request completes instead of being returned.
+ *
+ * @cassandra{2.0+}
+ *
+ * @public @memberof CassSession
+ *
+ * @param[in] session
+ * @param[in] batch
+ * @param[in] completion_queue
+ * @param[in] tag An application value returned with the completed future.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_session_execute_cq()
+ */
+CASS_EXPORT CassError
+cass_session_execute_batch_cq(CassSession* session,
+                              const CassBatch* batch,
+                              CassCompletionQueue* completion_queue,
+                              void* tag);
+
+/**
+ * Execute an array of query or bound statements. This is equivalent to
+ * calling cass_session_execute() for each statement, but the requests are
+ * handed to the I/O threads in bulk: each I/O thread's request queue is
+ * reserved and woken up once for the whole array instead of once per
+ * statement.
+ *
+ * @public @memberof CassSession
+ *
+ * @param[in] session
+ * @param[in] statements
+ * @param[in] count The number of statements.
+ * @param[out] futures An array of at least "count" entries that's populated
+ * with a future for each statement, in order. Each future must be freed.
+ * @return CASS_OK if successful, otherwise an error occurred and no
+ * statements were executed.
+ *
+ * @see cass_session_execute()
+ */
+CASS_EXPORT CassError
+cass_session_execute_batch_submit(CassSession* session,
+                                  const CassStatement* const* statements,
+                                  size_t count,
+                                  CassFuture** futures);
+
 /**
  * Gets a snapshot of this session's schema metadata. The returned
  * snapshot of the schema metadata is not updated. This function
@@ -3152,6 +3984,20 @@ CASS_EXPORT void
 cass_session_get_speculative_execution_metrics(const CassSession* session,
                                                CassSpeculativeExecutionMetrics* output);
 
+/**
+ * Gets a copy of this session's retry metrics.
+ *
+ * @public @memberof CassSession
+ *
+ * @param[in] session
+ * @param[out] output
+ *
+ * @see cass_cluster_set_retry_budget()
+ */
+CASS_EXPORT void
+cass_session_get_retry_metrics(const CassSession* session,
+                               CassRetryMetrics* output);
+
 /**
  * Get the client id.
  *
@@ -5025,6 +5871,93 @@ cass_future_custom_payload_item(CassFuture* future,
 CASS_EXPORT const CassNode*
 cass_future_coordinator(CassFuture* future);
 
+/***********************************************************************************
+ *
+ * Completion queue
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new completion queue.
+ *
+ * <b>Note:</b> Any number of threads can execute requests that complete to the
+ * same queue, but only one thread at a time may drain it.
+ *
+ * @public @memberof CassCompletionQueue
+ *
+ * @return Returns a completion queue that must be freed.
+ *
+ * @see cass_completion_queue_free()
+ * @see cass_session_execute_cq()
+ */
+CASS_EXPORT CassCompletionQueue*
+cass_completion_queue_new();
+
+/**
+ * Frees a completion queue instance. Completed futures that haven't been
+ * drained are freed with it. Requests that are still running keep the queue
+ * alive until they complete.
+ *
+ * @public @memberof CassCompletionQueue
+ *
+ * @param[in] completion_queue
+ */
+CASS_EXPORT void
+cass_completion_queue_free(CassCompletionQueue* completion_queue);
+
+/**
+ * Gets a file descriptor that becomes readable when completions are available.
+ * It can be registered with epoll() or poll() to integrate the queue with an
+ * existing event loop. The descriptor is reset by draining the queue; don't
+ * read from it directly.
+ *
+ * @public @memberof CassCompletionQueue
+ *
+ * @param[in] completion_queue
+ * @return A file descriptor or -1 if not supported on this platform.
+ */
+CASS_EXPORT int
+cass_completion_queue_fd(const CassCompletionQueue* completion_queue);
+
+/**
+ * Drains up to count completed futures from the queue without blocking.
+ *
+ * @public @memberof CassCompletionQueue
+ *
+ * @param[in] completion_queue
+ * @param[out] futures An array with room for at least count futures. Each
+ * returned future is ready and must be freed.
+ * @param[out] tags An array with room for at least count tags, the tags passed
+ * to cass_session_execute_cq(). Can be NULL.
+ * @param[in] count
+ * @return The number of futures drained.
+ */
+CASS_EXPORT size_t
+cass_completion_queue_poll(CassCompletionQueue* completion_queue,
+                           CassFuture** futures,
+                           void** tags,
+                           size_t count);
+
+/**
+ * Same as cass_completion_queue_poll(), but waits up to the specified
+ * timeout for at least one completion.
+ *
+ * @public @memberof CassCompletionQueue
+ *
+ * @param[in] completion_queue
+ * @param[out] futures
+ * @param[out] tags
+ * @param[in] count
+ * @param[in] timeout_us wait time in microseconds
+ * @return The number of futures drained. Zero if the timeout elapsed.
+ */
+CASS_EXPORT size_t
+cass_completion_queue_wait_timed(CassCompletionQueue* completion_queue,
+                                 CassFuture** futures,
+                                 void** tags,
+                                 size_t count,
+                                 cass_duration_t timeout_us);
+
 /***********************************************************************************
  *
  * Statement
@@ -5231,42 +6164,87 @@ cass_statement_set_paging_state(CassStatement* statement,
  * @see cass_result_paging_state_token()
  */
 CASS_EXPORT CassError
-cass_statement_set_paging_state_token(CassStatement* statement,
-                                      const char* paging_state,
-                                      size_t paging_state_size);
+cass_statement_set_paging_state_token(CassStatement* statement,
+                                      const char* paging_state,
+                                      size_t paging_state_size);
+
+/**
+ * Sets the statement's timestamp.
+ *
+ * @cassandra{2.1+}
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] timestamp
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+CASS_EXPORT CassError
+cass_statement_set_timestamp(CassStatement* statement,
+                             cass_int64_t timestamp);
+
+/**
+ * Sets the statement's timeout for waiting for a response from a node.
+ *
+ * <b>Default:</b> Disabled (use the cluster-level request timeout)
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] timeout_ms Request timeout in milliseconds. Use 0 for no timeout
+ * or CASS_UINT64_MAX to disable (to use the cluster-level request timeout).
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_cluster_set_request_timeout()
+ */
+CASS_EXPORT CassError
+cass_statement_set_request_timeout(CassStatement* statement,
+                                   cass_uint64_t timeout_ms);
 
 /**
- * Sets the statement's timestamp.
+ * Sets the statement's absolute deadline. The deadline covers the whole
+ * request, including the time it waits in the session's request queue,
+ * retries and speculative executions. A request that is still waiting to be
+ * sent (or retried) when its deadline expires is dropped without being sent
+ * to a node and fails with CASS_ERROR_LIB_REQUEST_DEADLINE_EXCEEDED, as does
+ * a request still waiting for a response.
  *
- * @cassandra{2.1+}
+ * The request timeout (cass_statement_set_request_timeout()) also applies
+ * and is counted from the time the request is executed.
+ *
+ * <b>Default:</b> 0 (no deadline)
  *
  * @public @memberof CassStatement
  *
  * @param[in] statement
- * @param[in] timestamp
+ * @param[in] deadline_ms The deadline in milliseconds since the Unix epoch
+ * (e.g. a deadline propagated from an upstream request). Use 0 for no deadline.
  * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_batch_set_deadline()
  */
 CASS_EXPORT CassError
-cass_statement_set_timestamp(CassStatement* statement,
-                             cass_int64_t timestamp);
+cass_statement_set_deadline(CassStatement* statement,
+                            cass_uint64_t deadline_ms);
 
 /**
- * Sets the statement's timeout for waiting for a response from a node.
+ * Sets the statement's priority. This determines the request queue used for
+ * the statement when priority lanes are enabled.
  *
- * <b>Default:</b> Disabled (use the cluster-level request timeout)
+ * <b>Default:</b> CASS_REQUEST_PRIORITY_UNKNOWN (uses the execution
+ * profile's or the cluster-level priority)
  *
  * @public @memberof CassStatement
  *
  * @param[in] statement
- * @param[in] timeout_ms Request timeout in milliseconds. Use 0 for no timeout
- * or CASS_UINT64_MAX to disable (to use the cluster-level request timeout).
+ * @param[in] priority
  * @return CASS_OK if successful, otherwise an error occurred.
  *
- * @see cass_cluster_set_request_timeout()
+ * @see cass_cluster_set_priority_lanes()
  */
 CASS_EXPORT CassError
-cass_statement_set_request_timeout(CassStatement* statement,
-                                   cass_uint64_t timeout_ms);
+cass_statement_set_priority(CassStatement* statement,
+                            CassRequestPriority priority);
 
 /**
  * Sets whether the statement is idempotent. Idempotent statements are able to be
@@ -6389,6 +7367,136 @@ cass_statement_bind_duration_by_name_n(CassStatement* statement,
                                        cass_int32_t days,
                                        cass_int64_t nanos);
 
+/**
+ * Binds a "vector<float, n>" to a query or bound statement at the specified
+ * index. The values are encoded into the statement in a single pass.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] index
+ * @param[in] values The values are copied into the statement object; the
+ * memory pointed to by this parameter can be freed after this call.
+ * @param[in] count The number of values. This must match the dimension of
+ * the vector for bound statements.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+CASS_EXPORT CassError
+cass_statement_bind_float_vector(CassStatement* statement,
+                                 size_t index,
+                                 const cass_float_t* values,
+                                 size_t count);
+
+/**
+ * Binds a "vector<float, n>" to all the values with the specified name.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] values
+ * @param[in] count
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+CASS_EXPORT CassError
+cass_statement_bind_float_vector_by_name(CassStatement* statement,
+                                         const char* name,
+                                         const cass_float_t* values,
+                                         size_t count);
+
+/**
+ * Same as cass_statement_bind_float_vector_by_name(), but with lengths for
+ * string parameters.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] name_length
+ * @param[in] values
+ * @param[in] count
+ * @return same as cass_statement_bind_float_vector_by_name()
+ *
+ * @see cass_statement_bind_float_vector_by_name()
+ */
+CASS_EXPORT CassError
+cass_statement_bind_float_vector_by_name_n(CassStatement* statement,
+                                           const char* name,
+                                           size_t name_length,
+                                           const cass_float_t* values,
+                                           size_t count);
+
+/**
+ * Binds a "vector<double, n>" to a query or bound statement at the specified
+ * index. The values are encoded into the statement in a single pass.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] index
+ * @param[in] values The values are copied into the statement object; the
+ * memory pointed to by this parameter can be freed after this call.
+ * @param[in] count The number of values. This must match the dimension of
+ * the vector for bound statements.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+CASS_EXPORT CassError
+cass_statement_bind_double_vector(CassStatement* statement,
+                                  size_t index,
+                                  const cass_double_t* values,
+                                  size_t count);
+
+/**
+ * Binds a "vector<double, n>" to all the values with the specified name.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] values
+ * @param[in] count
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+CASS_EXPORT CassError
+cass_statement_bind_double_vector_by_name(CassStatement* statement,
+                                          const char* name,
+                                          const cass_double_t* values,
+                                          size_t count);
+
+/**
+ * Same as cass_statement_bind_double_vector_by_name(), but with lengths for
+ * string parameters.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] name_length
+ * @param[in] values
+ * @param[in] count
+ * @return same as cass_statement_bind_double_vector_by_name()
+ *
+ * @see cass_statement_bind_double_vector_by_name()
+ */
+CASS_EXPORT CassError
+cass_statement_bind_double_vector_by_name_n(CassStatement* statement,
+                                            const char* name,
+                                            size_t name_length,
+                                            const cass_double_t* values,
+                                            size_t count);
+
 /**
  * Bind a "list", "map" or "set" to a query or bound statement at the
  * specified index.
@@ -6784,6 +7892,42 @@ CASS_EXPORT CassError
 cass_batch_set_request_timeout(CassBatch* batch,
                                cass_uint64_t timeout_ms);
 
+/**
+ * Sets the batch's absolute deadline.
+ *
+ * <b>Default:</b> 0 (no deadline)
+ *
+ * @public @memberof CassBatch
+ *
+ * @param[in] batch
+ * @param[in] deadline_ms The deadline in milliseconds since the Unix epoch.
+ * Use 0 for no deadline.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_statement_set_deadline()
+ */
+CASS_EXPORT CassError
+cass_batch_set_deadline(CassBatch* batch,
+                        cass_uint64_t deadline_ms);
+
+/**
+ * Sets the batch's priority.
+ *
+ * <b>Default:</b> CASS_REQUEST_PRIORITY_UNKNOWN (uses the execution
+ * profile's or the cluster-level priority)
+ *
+ * @public @memberof CassBatch
+ *
+ * @param[in] batch
+ * @param[in] priority
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_statement_set_priority()
+ */
+CASS_EXPORT CassError
+cass_batch_set_priority(CassBatch* batch,
+                        CassRequestPriority priority);
+
 /**
  * Sets whether the statements in a batch are idempotent. Idempotent batches
  * are able to be automatically retried after timeouts/errors and can be
@@ -7648,6 +8792,82 @@ cass_collection_append_duration(CassCollection* collection,
                                 cass_int32_t days,
                                 cass_int64_t nanos);
 
+/**
+ * Appends an array of "int" values to the collection. The values are
+ * encoded into a single buffer which is considerably faster than appending
+ * them one at a time for large collections.
+ *
+ * @public @memberof CassCollection
+ *
+ * @param[in] collection
+ * @param[in] values
+ * @param[in] count The number of values in the array.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_collection_append_int32()
+ */
+CASS_EXPORT CassError
+cass_collection_append_int32_array(CassCollection* collection,
+                                   const cass_int32_t* values,
+                                   size_t count);
+
+/**
+ * Appends an array of "bigint" values to the collection. The values are
+ * encoded into a single buffer which is considerably faster than appending
+ * them one at a time for large collections.
+ *
+ * @public @memberof CassCollection
+ *
+ * @param[in] collection
+ * @param[in] values
+ * @param[in] count The number of values in the array.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_collection_append_int64()
+ */
+CASS_EXPORT CassError
+cass_collection_append_int64_array(CassCollection* collection,
+                                   const cass_int64_t* values,
+                                   size_t count);
+
+/**
+ * Appends an array of "float" values to the collection. The values are
+ * encoded into a single buffer which is considerably faster than appending
+ * them one at a time for large collections.
+ *
+ * @public @memberof CassCollection
+ *
+ * @param[in] collection
+ * @param[in] values
+ * @param[in] count The number of values in the array.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_collection_append_float()
+ */
+CASS_EXPORT CassError
+cass_collection_append_float_array(CassCollection* collection,
+                                   const cass_float_t* values,
+                                   size_t count);
+
+/**
+ * Appends an array of "double" values to the collection. The values are
+ * encoded into a single buffer which is considerably faster than appending
+ * them one at a time for large collections.
+ *
+ * @public @memberof CassCollection
+ *
+ * @param[in] collection
+ * @param[in] values
+ * @param[in] count The number of values in the array.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see cass_collection_append_double()
+ */
+CASS_EXPORT CassError
+cass_collection_append_double_array(CassCollection* collection,
+                                    const cass_double_t* values,
+                                    size_t count);
+
 /**
  * Appends a "list", "map" or "set" to the collection.
  *
@@ -10167,6 +11387,110 @@ cass_iterator_get_column(const CassIterator* iterator);
 CASS_EXPORT const CassValue*
 cass_iterator_get_value(const CassIterator* iterator);
 
+/**
+ * Gets up to output_count of the remaining elements of a list or set of
+ * "int" values and advances the collection iterator past them. This decodes
+ * the elements in a single pass instead of one cass_iterator_next() and
+ * cass_value_get_int32() call per element.
+ *
+ * Calling this function will invalidate the value previously returned by
+ * cass_iterator_get_value().
+ *
+ * @public @memberof CassIterator
+ *
+ * @param[in] iterator A collection iterator.
+ * @param[out] output An array with room for at least output_count values.
+ * @param[in] output_count
+ * @param[out] count_read The number of values read. Zero once the
+ * iterator is exhausted.
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_DATA if one of the elements is null or truncated;
+ * the iterator is not advanced in that case.
+ */
+CASS_EXPORT CassError
+cass_iterator_next_int32_array(CassIterator* iterator,
+                               cass_int32_t* output,
+                               size_t output_count,
+                               size_t* count_read);
+
+/**
+ * Gets up to output_count of the remaining elements of a list or set of
+ * "bigint", "counter", "timestamp" or "time" values and advances the collection iterator past them. This decodes
+ * the elements in a single pass instead of one cass_iterator_next() and
+ * cass_value_get_int64() call per element.
+ *
+ * Calling this function will invalidate the value previously returned by
+ * cass_iterator_get_value().
+ *
+ * @public @memberof CassIterator
+ *
+ * @param[in] iterator A collection iterator.
+ * @param[out] output An array with room for at least output_count values.
+ * @param[in] output_count
+ * @param[out] count_read The number of values read. Zero once the
+ * iterator is exhausted.
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_DATA if one of the elements is null or truncated;
+ * the iterator is not advanced in that case.
+ */
+CASS_EXPORT CassError
+cass_iterator_next_int64_array(CassIterator* iterator,
+                               cass_int64_t* output,
+                               size_t output_count,
+                               size_t* count_read);
+
+/**
+ * Gets up to output_count of the remaining elements of a list or set of
+ * "float" values and advances the collection iterator past them. This decodes
+ * the elements in a single pass instead of one cass_iterator_next() and
+ * cass_value_get_float() call per element.
+ *
+ * Calling this function will invalidate the value previously returned by
+ * cass_iterator_get_value().
+ *
+ * @public @memberof CassIterator
+ *
+ * @param[in] iterator A collection iterator.
+ * @param[out] output An array with room for at least output_count values.
+ * @param[in] output_count
+ * @param[out] count_read The number of values read. Zero once the
+ * iterator is exhausted.
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_DATA if one of the elements is null or truncated;
+ * the iterator is not advanced in that case.
+ */
+CASS_EXPORT CassError
+cass_iterator_next_float_array(CassIterator* iterator,
+                               cass_float_t* output,
+                               size_t output_count,
+                               size_t* count_read);
+
+/**
+ * Gets up to output_count of the remaining elements of a list or set of
+ * "double" values and advances the collection iterator past them. This decodes
+ * the elements in a single pass instead of one cass_iterator_next() and
+ * cass_value_get_double() call per element.
+ *
+ * Calling this function will invalidate the value previously returned by
+ * cass_iterator_get_value().
+ *
+ * @public @memberof CassIterator
+ *
+ * @param[in] iterator A collection iterator.
+ * @param[out] output An array with room for at least output_count values.
+ * @param[in] output_count
+ * @param[out] count_read The number of values read. Zero once the
+ * iterator is exhausted.
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_DATA if one of the elements is null or truncated;
+ * the iterator is not advanced in that case.
+ */
+CASS_EXPORT CassError
+cass_iterator_next_double_array(CassIterator* iterator,
+                                cass_double_t* output,
+                                size_t output_count,
+                                size_t* count_read);
+
 /**
  * Gets the key at the map iterator's current position.
  *
@@ -10657,6 +11981,46 @@ cass_value_get_duration(const CassValue* value,
                         cass_int32_t* days,
                         cass_int64_t* nanos);
 
+/**
+ * Gets the elements of a "vector<float, n>" for the specified value. The
+ * elements are decoded directly into the provided array.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassValue
+ *
+ * @param[in] value
+ * @param[out] output An array with room for at least output_count elements.
+ * @param[in] output_count Must match the dimension of the vector.
+ * @return CASS_OK if successful, otherwise error occurred
+ *
+ * @see cass_value_vector_dimension()
+ */
+CASS_EXPORT CassError
+cass_value_get_float_vector(const CassValue* value,
+                            cass_float_t* output,
+                            size_t output_count);
+
+/**
+ * Gets the elements of a "vector<double, n>" for the specified value. The
+ * elements are decoded directly into the provided array.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassValue
+ *
+ * @param[in] value
+ * @param[out] output An array with room for at least output_count elements.
+ * @param[in] output_count Must match the dimension of the vector.
+ * @return CASS_OK if successful, otherwise error occurred
+ *
+ * @see cass_value_vector_dimension()
+ */
+CASS_EXPORT CassError
+cass_value_get_double_vector(const CassValue* value,
+                             cass_double_t* output,
+                             size_t output_count);
+
 /**
  * Gets the type of the specified value.
  *
@@ -10701,6 +12065,19 @@ cass_value_is_collection(const CassValue* value);
 CASS_EXPORT cass_bool_t
 cass_value_is_duration(const CassValue* value);
 
+/**
+ * Get the dimension (number of elements) of a vector value.
+ *
+ * @cassandra{5.0+}
+ *
+ * @public @memberof CassValue
+ *
+ * @param[in] value
+ * @return The dimension of the vector. 0 if not a vector.
+ */
+CASS_EXPORT size_t
+cass_value_vector_dimension(const CassValue* value);
+
 /**
  * Get the number of items in a collection. Works for all collection types.
  *
@@ -10792,7 +12169,9 @@ cass_uuid_gen_free(CassUuidGen* uuid_gen);
 /**
  * Generates a V1 (time) UUID.
  *
- * <b>Note:</b> This method is thread-safe
+ * <b>Note:</b> This method is thread-safe and doesn't take a lock. Each thread
+ * is assigned its own clock sequence so UUIDs generated on different threads
+ * never collide; UUIDs are monotonically increasing per thread.
  *
  * @public @memberof CassUuidGen
  *
@@ -10995,6 +12374,46 @@ CASS_EXPORT CassTimestampGen*
 cass_timestamp_gen_monotonic_new_with_settings(cass_int64_t warning_threshold_us,
                                                cass_int64_t warning_interval_ms);
 
+/**
+ * Creates a new monotonically increasing timestamp generator with microsecond
+ * precision that keeps its state per thread.
+ *
+ * This behaves like cass_timestamp_gen_monotonic_new(), but each thread
+ * tracks its own last timestamp so that threads generating timestamps at a
+ * high rate don't contend with each other. Timestamps are only guaranteed to
+ * be monotonically increasing for requests executed from the same thread.
+ *
+ * <b>Note:</b> This generator is thread-safe and can be shared by multiple
+ * sessions.
+ *
+ * @cassandra{2.1+}
+ *
+ * @public @memberof CassTimestampGen
+ *
+ * @return Returns a timestamp generator that must be freed.
+ *
+ * @see cass_timestamp_gen_monotonic_thread_local_new_with_settings();
+ * @see cass_timestamp_gen_free()
+ */
+CASS_EXPORT CassTimestampGen*
+cass_timestamp_gen_monotonic_thread_local_new();
+
+/**
+ * Same as cass_timestamp_gen_monotonic_thread_local_new(), but with settings
+ * for controlling warnings about clock skew.
+ *
+ * @param warning_threshold_us The amount of clock skew, in microseconds, that
+ * must be detected before a warning is triggered. A threshold less than 0 can
+ * be used to disable warnings.
+ * @param warning_interval_ms The amount of time, in milliseconds, to wait before
+ * warning again about clock skew. An interval value less than or equal to 0 allows
+ * the warning to be triggered every millisecond.
+ * @return Returns a timestamp generator that must be freed.
+ */
+CASS_EXPORT CassTimestampGen*
+cass_timestamp_gen_monotonic_thread_local_new_with_settings(cass_int64_t warning_threshold_us,
+                                                            cass_int64_t warning_interval_ms);
+
 /**
  * Frees a timestamp generator instance.
  *
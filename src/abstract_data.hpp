@@ -89,6 +89,8 @@ public:
     elements_.resize(count);
   }
 
+  void set_elements(const ElementVec& elements) { elements_ = elements; }
+
 #define SET_TYPE(Type)                                  \
   CassError set(size_t index, const Type value) {       \
     CASS_CHECK_INDEX_AND_TYPE(index, value);            \
@@ -111,6 +113,8 @@ public:
   SET_TYPE(CassInet)
   SET_TYPE(CassDecimal)
   SET_TYPE(CassDuration)
+  SET_TYPE(CassFloatVector)
+  SET_TYPE(CassDoubleVector)
 
 #undef SET_TYPE
 
@@ -0,0 +1,172 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "auto_prepare_cache.hpp"
+
+#include "constants.hpp"
+#include "logger.hpp"
+#include "scoped_lock.hpp"
+#include "statement.hpp"
+
+using namespace datastax;
+using namespace datastax::internal;
+using namespace datastax::internal::core;
+
+AutoPrepareCache::AutoPrepareCache()
+    : threshold_(0)
+    , max_entries_(0) {
+  uv_rwlock_init(&rwlock_);
+  // Keys always contain the separator so neither of these can be a valid key
+  entries_.set_empty_key(String());
+  entries_.set_deleted_key(String(1, '\1'));
+}
+
+AutoPrepareCache::~AutoPrepareCache() {
+  clear();
+  uv_rwlock_destroy(&rwlock_);
+}
+
+Prepared::ConstPtr AutoPrepareCache::get(const Statement* statement,
+                                         PrepareRequest::Ptr* prepare) {
+  String key(PreparedMetadata::statement_key(statement->keyspace(), statement->query()));
+
+  { // Fast path: the statement is already prepared
+    ScopedReadLock rl(&rwlock_);
+    EntryMap::const_iterator it = entries_.find(key);
+    if (it != entries_.end() && it->second->prepared) {
+      it->second->is_referenced.store(true, MEMORY_ORDER_RELAXED);
+      return it->second->prepared;
+    }
+  }
+
+  ScopedWriteLock wl(&rwlock_);
+
+  Entry* entry;
+  EntryMap::iterator it = entries_.find(key);
+  if (it != entries_.end()) {
+    entry = it->second;
+    lru_.remove(entry);
+    entry->is_referenced.store(false, MEMORY_ORDER_RELAXED);
+  } else {
+    if (entries_.size() >= max_entries_) {
+      evict();
+    }
+    entry = new Entry(key);
+    entries_[key] = entry;
+  }
+  lru_.add_to_back(entry);
+
+  if (!entry->prepared && !entry->prepare && ++entry->count >= threshold_) {
+    PrepareRequest::Ptr request(new PrepareRequest(statement->query()));
+    // The bound statements inherit the settings of the prepare request
+    request->set_settings(statement->settings());
+    entry->prepare.reset(request.get());
+    *prepare = request;
+  }
+
+  return entry->prepared;
+}
+
+void AutoPrepareCache::set_callback(const ResponseFuture::Ptr& future) {
+  inc_ref(); // Released in the future's callback
+  future->set_callback(on_prepared, this);
+}
+
+void AutoPrepareCache::configure(unsigned threshold, size_t max_entries) {
+  ScopedWriteLock wl(&rwlock_);
+  remove_all();
+  threshold_ = threshold;
+  max_entries_ = max_entries;
+}
+
+void AutoPrepareCache::clear() {
+  ScopedWriteLock wl(&rwlock_);
+  remove_all();
+}
+
+size_t AutoPrepareCache::size() const {
+  ScopedReadLock rl(&rwlock_);
+  return entries_.size();
+}
+
+size_t AutoPrepareCache::prepared_count() const {
+  ScopedReadLock rl(&rwlock_);
+  size_t count = 0;
+  for (EntryMap::const_iterator it = entries_.begin(), end = entries_.end(); it != end; ++it) {
+    if (it->second->prepared) ++count;
+  }
+  return count;
+}
+
+void AutoPrepareCache::on_prepared(CassFuture* future, void* data) {
+  AutoPrepareCache* cache = static_cast<AutoPrepareCache*>(data);
+  cache->handle_prepared(static_cast<ResponseFuture*>(future->from()));
+  cache->dec_ref();
+}
+
+void AutoPrepareCache::handle_prepared(ResponseFuture* future) {
+  const PrepareRequest::ConstPtr& request(future->prepare_request);
+  Response::ConstPtr response(future->response());
+
+  Prepared::ConstPtr prepared;
+  if (response && response->opcode() == CQL_OPCODE_RESULT) {
+    ResultResponse::ConstPtr result(response);
+    if (result->kind() == CASS_RESULT_KIND_PREPARED) {
+      prepared.reset(new Prepared(result, request, *future->schema_metadata));
+    }
+  }
+
+  ScopedWriteLock wl(&rwlock_);
+
+  EntryMap::iterator it =
+      entries_.find(PreparedMetadata::statement_key(request->keyspace(), request->query()));
+  // The entry might have been evicted (or recreated) while it was being prepared
+  if (it == entries_.end() || it->second->prepare.get() != request.get()) return;
+
+  Entry* entry = it->second;
+  entry->prepare.reset();
+  if (prepared) {
+    entry->prepared = prepared;
+  } else {
+    // Try again once the statement has reached the threshold again
+    LOG_DEBUG("Unable to automatically prepare query \"%s\"", request->query().c_str());
+    entry->count = 0;
+  }
+}
+
+void AutoPrepareCache::evict() {
+  // Entries that were referenced since they were last moved are moved to the
+  // back instead of being evicted. This ends because their marks are cleared.
+  Entry* entry = lru_.front();
+  while (entry->is_referenced.exchange(false, MEMORY_ORDER_RELAXED)) {
+    lru_.remove(entry);
+    lru_.add_to_back(entry);
+    entry = lru_.front();
+  }
+  remove(entry);
+}
+
+void AutoPrepareCache::remove(Entry* entry) {
+  lru_.remove(entry);
+  entries_.erase(entry->key);
+  delete entry;
+}
+
+void AutoPrepareCache::remove_all() {
+  while (!lru_.is_empty()) {
+    remove(lru_.front());
+  }
+}
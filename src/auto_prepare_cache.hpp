@@ -0,0 +1,138 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_AUTO_PREPARE_CACHE_HPP
+#define DATASTAX_INTERNAL_AUTO_PREPARE_CACHE_HPP
+
+#include "allocated.hpp"
+#include "atomic.hpp"
+#include "dense_hash_map.hpp"
+#include "list.hpp"
+#include "macros.hpp"
+#include "prepare_request.hpp"
+#include "prepared.hpp"
+#include "ref_counted.hpp"
+#include "request_handler.hpp"
+#include "string.hpp"
+
+#include <uv.h>
+
+namespace datastax { namespace internal { namespace core {
+
+class Statement;
+
+/**
+ * Tracks how often simple statements are executed and caches the prepared
+ * statements of the ones that have been executed often enough to be prepared
+ * automatically. The statements are keyed by their query and keyspace and only
+ * the most recently executed statements are kept (approximately LRU).
+ *
+ * This is used from the application's threads and the callback of the future
+ * used to prepare a statement so it's thread-safe. Executing a statement that's
+ * already prepared only takes a read lock so it doesn't reorder the LRU list.
+ * The entry is marked as referenced instead and it's given a second chance
+ * when it reaches the front of the list.
+ */
+class AutoPrepareCache : public RefCounted<AutoPrepareCache> {
+public:
+  typedef SharedRefPtr<AutoPrepareCache> Ptr;
+
+  AutoPrepareCache();
+  ~AutoPrepareCache();
+
+  /**
+   * Set the cache's settings and forget all the tracked and prepared
+   * statements, e.g. when the session connects.
+   *
+   * @param threshold The number of executions before a statement is prepared.
+   * @param max_entries The maximum number of statements tracked. It must be
+   * greater than 0.
+   */
+  void configure(unsigned threshold, size_t max_entries);
+
+  /**
+   * Record an execution of a simple statement.
+   *
+   * @param statement A simple statement.
+   * @param prepare A request to prepare the statement if it has just reached
+   * the threshold. The request must be executed using a future that was set up
+   * using `set_callback()`.
+   * @return The cached prepared statement, or null if the statement hasn't
+   * been prepared yet.
+   */
+  Prepared::ConstPtr get(const Statement* statement, PrepareRequest::Ptr* prepare);
+
+  /**
+   * Set up a future so that the result of preparing a statement is added to
+   * the cache.
+   *
+   * @param future The future used to prepare the statement.
+   */
+  void set_callback(const ResponseFuture::Ptr& future);
+
+  /**
+   * Forget all the tracked and prepared statements, e.g. when the session's
+   * keyspace changes. Statements currently being prepared are discarded once
+   * they're prepared.
+   */
+  void clear();
+
+  size_t size() const;
+
+  /**
+   * The number of tracked statements that have been prepared.
+   */
+  size_t prepared_count() const;
+
+private:
+  struct Entry
+      : public List<Entry>::Node
+      , public Allocated {
+    Entry(const String& key)
+        : key(key)
+        , count(0)
+        , is_referenced(false) {}
+
+    String key;
+    unsigned count;
+    Atomic<bool> is_referenced; // Used while only holding the read lock
+    Prepared::ConstPtr prepared;
+    PrepareRequest::ConstPtr prepare; // Set while the statement is being prepared
+  };
+
+  typedef DenseHashMap<String, Entry*> EntryMap;
+
+  static void on_prepared(CassFuture* future, void* data);
+  void handle_prepared(ResponseFuture* future);
+
+  void evict();
+  void remove(Entry* entry);
+  void remove_all();
+
+private:
+  mutable uv_rwlock_t rwlock_;
+  unsigned threshold_;
+  size_t max_entries_;
+  EntryMap entries_;
+  List<Entry> lru_; // Least recently used first
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(AutoPrepareCache);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
@@ -121,6 +121,18 @@ public:
     return offset + sizeof(double);
   }
 
+  size_t encode_float_array(size_t offset, const float* values, size_t count) {
+    assert(offset + count * sizeof(float) <= static_cast<size_t>(size_));
+    internal::encode_float_array(data() + offset, values, count);
+    return offset + count * sizeof(float);
+  }
+
+  size_t encode_double_array(size_t offset, const double* values, size_t count) {
+    assert(offset + count * sizeof(double) <= static_cast<size_t>(size_));
+    internal::encode_double_array(data() + offset, values, count);
+    return offset + count * sizeof(double);
+  }
+
   size_t encode_long_string(size_t offset, const char* value, int32_t size) {
     size_t pos = encode_int32(offset, size);
     return copy(pos, value, size);
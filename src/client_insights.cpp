@@ -789,6 +789,31 @@ private:
         writer.Uint64(profile.latency_aware_routing_settings().min_measured);
         writer.EndObject(); // latencyAwareRouting
       }
+      if (profile.peak_ewma_routing()) {
+        writer.Key("peakEwmaRouting");
+        writer.StartObject();
+        writer.Key("decayNs");
+        writer.Uint64(profile.peak_ewma_routing_settings().decay_ns);
+        writer.Key("maxCandidates");
+        writer.Uint(profile.peak_ewma_routing_settings().max_candidates);
+        writer.EndObject(); // peakEwmaRouting
+      }
+      if (profile.outlier_detection()) {
+        const OutlierDetectionPolicy::Settings& settings = profile.outlier_detection_settings();
+        writer.Key("outlierDetection");
+        writer.StartObject();
+        writer.Key("failureRateThreshold");
+        writer.Double(settings.failure_rate_threshold);
+        writer.Key("minRequests");
+        writer.Uint64(settings.min_requests);
+        writer.Key("intervalNs");
+        writer.Uint64(settings.interval_ns);
+        writer.Key("baseEjectionNs");
+        writer.Uint64(settings.base_ejection_ns);
+        writer.Key("maxEjectionNs");
+        writer.Uint64(settings.max_ejection_ns);
+        writer.EndObject(); // outlierDetection
+      }
       writer.EndObject(); // options
 
       writer.EndObject(); // loadBalancingPolicy
@@ -820,6 +845,34 @@ private:
       }
     }
 
+    typedef PercentileSpeculativeExecutionPolicy PSEP;
+    PSEP* default_psep =
+        default_profile ? dynamic_cast<PSEP*>(default_profile->speculative_execution_policy().get())
+                        : NULL;
+    PSEP* psep = dynamic_cast<PSEP*>(profile.speculative_execution_policy().get());
+    if (psep) {
+      if (!default_psep || default_psep->percentile_ != psep->percentile_ ||
+          default_psep->max_speculative_executions_ != psep->max_speculative_executions_ ||
+          default_psep->max_speculative_ratio_ != psep->max_speculative_ratio_) {
+        writer.Key("speculativeExecutionPolicy");
+        writer.StartObject();
+        writer.Key("type");
+        writer.String("PercentileSpeculativeExecutionPolicy");
+
+        writer.Key("options");
+        writer.StartObject();
+        writer.Key("percentile");
+        writer.Double(psep->percentile_);
+        writer.Key("maxSpeculativeExecutions");
+        writer.Int(psep->max_speculative_executions_);
+        writer.Key("maxSpeculativeRatio");
+        writer.Double(psep->max_speculative_ratio_);
+        writer.EndObject(); // options
+
+        writer.EndObject(); // speculativeExecutionPolicy
+      }
+    }
+
     writer.EndObject(); // executionProfile
   }
 
@@ -150,6 +150,9 @@ void ClusterEvent::process_event(const ClusterEvent& event, ClusterListener* lis
     case TOKEN_MAP_UPDATE:
       listener->on_token_map_updated(event.token_map);
       break;
+    case SCHEMA_CHANGE:
+      listener->on_schema_changed(event.schema_changes);
+      break;
   }
 }
 
@@ -201,7 +204,11 @@ ClusterSettings::ClusterSettings()
     , reconnection_policy(new ExponentialReconnectionPolicy())
     , prepare_on_up_or_add_host(CASS_DEFAULT_PREPARE_ON_UP_OR_ADD_HOST)
     , max_prepares_per_flush(CASS_DEFAULT_MAX_PREPARES_PER_FLUSH)
+    , num_prepare_connections_per_host(CASS_DEFAULT_NUM_CONNECTIONS_PER_HOST)
+    , prepare_on_up_or_add_host_hot_statements(
+          CASS_DEFAULT_PREPARE_ON_UP_OR_ADD_HOST_HOT_STATEMENTS)
     , disable_events_on_startup(false)
+    , contact_point_connect_delay_ms(CASS_DEFAULT_CONTACT_POINT_CONNECT_DELAY_MS)
     , cluster_metadata_resolver_factory(new DefaultClusterMetadataResolverFactory()) {
   load_balancing_policies.push_back(load_balancing_policy);
 }
@@ -214,7 +221,10 @@ ClusterSettings::ClusterSettings(const Config& config)
     , reconnection_policy(config.reconnection_policy())
     , prepare_on_up_or_add_host(config.prepare_on_up_or_add_host())
     , max_prepares_per_flush(CASS_DEFAULT_MAX_PREPARES_PER_FLUSH)
+    , num_prepare_connections_per_host(config.core_connections_per_host())
+    , prepare_on_up_or_add_host_hot_statements(config.prepare_on_up_or_add_host_hot_statements())
     , disable_events_on_startup(false)
+    , contact_point_connect_delay_ms(config.contact_point_connect_delay_ms())
     , cluster_metadata_resolver_factory(config.cluster_metadata_resolver_factory()) {}
 
 Cluster::Cluster(const ControlConnection::Ptr& connection, ClusterListener* listener,
@@ -271,10 +281,22 @@ PreparedMetadata::Entry::Ptr Cluster::prepared(const String& id) const {
   return prepared_metadata_.get(id);
 }
 
+PreparedMetadata::Entry::Ptr Cluster::prepared(const String& keyspace, const String& query) const {
+  return prepared_metadata_.find(keyspace, query);
+}
+
 void Cluster::prepared(const String& id, const PreparedMetadata::Entry::Ptr& entry) {
   prepared_metadata_.set(id, entry);
 }
 
+void Cluster::remove_prepared_statements(const String& keyspace) {
+  prepared_metadata_.remove_statements(keyspace);
+}
+
+PreparedMetadata::Entry::Vec Cluster::prepared_entries() const {
+  return prepared_metadata_.copy();
+}
+
 HostMap Cluster::available_hosts() const {
   HostMap available;
   for (HostMap::const_iterator it = hosts_.begin(), end = hosts_.end(); it != end; ++it) {
@@ -285,6 +307,21 @@ HostMap Cluster::available_hosts() const {
   return available;
 }
 
+HostMap Cluster::local_hosts() const {
+  HostMap local;
+  for (HostMap::const_iterator it = hosts_.begin(), end = hosts_.end(); it != end; ++it) {
+    for (LoadBalancingPolicy::Vec::const_iterator policy_it = load_balancing_policies_.begin(),
+                                                  policy_end = load_balancing_policies_.end();
+         policy_it != policy_end; ++policy_it) {
+      if ((*policy_it)->distance(it->second) == CASS_HOST_DISTANCE_LOCAL) {
+        local[it->first] = it->second;
+        break;
+      }
+    }
+  }
+  return local;
+}
+
 void Cluster::set_listener(ClusterListener* listener) {
   listener_ = listener ? listener : &nop_cluster_listener__;
 }
@@ -357,6 +394,15 @@ void Cluster::update_schema(const ControlConnectionSchema& schema) {
   }
 
   metadata_.swap_to_back_and_update_front();
+  notify_schema_changes();
+}
+
+void Cluster::notify_schema_changes() {
+  SchemaChange::Vec changes;
+  metadata_.take_schema_changes(&changes);
+  if (!changes.empty()) {
+    notify_or_record(ClusterEvent(changes));
+  }
 }
 
 void Cluster::update_token_map(const HostMap& hosts, const String& partitioner,
@@ -654,7 +700,9 @@ bool Cluster::prepare_host(const Host::Ptr& host, const PrepareHostHandler::Call
   if (connection_ && settings_.prepare_on_up_or_add_host) {
     PrepareHostHandler::Ptr prepare_host_handler(
         new PrepareHostHandler(host, prepared_metadata_.copy(), callback,
-                               connection_->protocol_version(), settings_.max_prepares_per_flush));
+                               connection_->protocol_version(), settings_.max_prepares_per_flush,
+                               settings_.num_prepare_connections_per_host,
+                               settings_.prepare_on_up_or_add_host_hot_statements));
 
     prepare_host_handler->prepare(connection_->loop(),
                                   settings_.control_connection_settings.connection_settings);
@@ -705,6 +753,7 @@ void Cluster::on_update_schema(SchemaType type, const ResultResponse::Ptr& resul
       metadata_.update_aggregates(result.get());
       break;
   }
+  notify_schema_changes();
 }
 
 void Cluster::on_drop_schema(SchemaType type, const String& keyspace_name,
@@ -736,6 +785,7 @@ void Cluster::on_drop_schema(SchemaType type, const String& keyspace_name,
     default:
       break;
   }
+  notify_schema_changes();
 }
 
 void Cluster::on_up(const Address& address) {
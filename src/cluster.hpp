@@ -115,6 +115,16 @@ public:
    */
   virtual void on_reconnect(Cluster* cluster) {}
 
+  /**
+   * A callback that's called when the schema metadata has changed. The changes
+   * are computed from the differences between the previous and the updated
+   * schema metadata.
+   *
+   * @param changes The keyspaces, tables, views, types, functions and
+   * aggregates that were created, updated or dropped.
+   */
+  virtual void on_schema_changed(const SchemaChange::Vec& changes) {}
+
   /**
    * A callback that's called when the cluster has closed.
    *
@@ -124,7 +134,8 @@ public:
 };
 
 /**
- * A class for recording host and token map events so they can be replayed.
+ * A class for recording host, token map and schema events so they can be
+ * replayed.
  */
 struct ClusterEvent {
   typedef Vector<ClusterEvent> Vec;
@@ -135,7 +146,8 @@ struct ClusterEvent {
     HOST_REMOVE,
     HOST_MAYBE_UP,
     HOST_READY,
-    TOKEN_MAP_UPDATE
+    TOKEN_MAP_UPDATE,
+    SCHEMA_CHANGE
   };
 
   ClusterEvent(Type type, const Host::Ptr& host)
@@ -146,12 +158,17 @@ struct ClusterEvent {
       : type(TOKEN_MAP_UPDATE)
       , token_map(token_map) {}
 
+  ClusterEvent(const SchemaChange::Vec& schema_changes)
+      : type(SCHEMA_CHANGE)
+      , schema_changes(schema_changes) {}
+
   static void process_event(const ClusterEvent& event, ClusterListener* listener);
   static void process_events(const Vec& events, ClusterListener* listener);
 
   Type type;
   Host::Ptr host;
   TokenMap::Ptr token_map;
+  SchemaChange::Vec schema_changes;
 };
 
 /**
@@ -208,12 +225,32 @@ struct ClusterSettings {
    */
   unsigned max_prepares_per_flush;
 
+  /**
+   * The number of connections used to prepare cached prepared statements on a
+   * host. This matches the number of connections in a host's pool.
+   */
+  unsigned num_prepare_connections_per_host;
+
+  /**
+   * The number of most recently used prepared statements that are prepared
+   * before a host is marked as up or added. If zero then all the statements
+   * are prepared first.
+   */
+  unsigned prepare_on_up_or_add_host_hot_statements;
+
   /**
    * If true then events are disabled on startup. Events can be explicitly
    * started by calling `Cluster::start_events()`.
    */
   bool disable_events_on_startup;
 
+  /**
+   * The delay between staggered connection attempts to the contact points. If
+   * zero then all the contact points are connected to at the same time once
+   * they're all resolved.
+   */
+  uint64_t contact_point_connect_delay_ms;
+
   /**
    * A factory for creating cluster metadata resolvers. A cluster metadata resolver is used to
    * determine contact points and retrieve other metadata required to connect the
@@ -332,6 +369,16 @@ public:
    */
   PreparedMetadata::Entry::Ptr prepared(const String& id) const;
 
+  /**
+   * Get the prepared metadata entry for a query and keyspace (thread-safe).
+   *
+   * @param keyspace The keyspace of the prepared statement.
+   * @param query The query of the prepared statement.
+   * @return The prepare metadata object for the query or a null object
+   * pointer if the query hasn't been prepared.
+   */
+  PreparedMetadata::Entry::Ptr prepared(const String& keyspace, const String& query) const;
+
   /**
    * Set the prepared metadata for a given prepared ID (thread-safe).
    *
@@ -340,6 +387,33 @@ public:
    */
   void prepared(const String& id, const PreparedMetadata::Entry::Ptr& entry);
 
+  /**
+   * Stop reusing the prepared results of a keyspace's statements to complete
+   * prepares (thread-safe).
+   *
+   * @param keyspace The name of the keyspace.
+   */
+  void remove_prepared_statements(const String& keyspace);
+
+  /**
+   * Determine if table changes are tracked for a keyspace. Only then are its
+   * prepared results removed when its schema changes.
+   *
+   * @param keyspace The name of the keyspace.
+   * @return true if the keyspace's schema changes are tracked.
+   */
+  bool is_schema_tracked(const String& keyspace) const {
+    return settings_.control_connection_settings.use_schema &&
+           settings_.control_connection_settings.is_schema_keyspace(keyspace);
+  }
+
+  /**
+   * Get all the prepared metadata entries (thread-safe).
+   *
+   * @return A copy of the prepared metadata entries.
+   */
+  PreparedMetadata::Entry::Vec prepared_entries() const;
+
   /**
    * Get available hosts (determined by host distance). This filters out ignored
    * hosts (*NOT* thread-safe).
@@ -348,6 +422,14 @@ public:
    */
   HostMap available_hosts() const;
 
+  /**
+   * Get the hosts that are at a local distance for at least one of the load
+   * balancing policies (*NOT* thread-safe).
+   *
+   * @return A mapping of local hosts.
+   */
+  HostMap local_hosts() const;
+
 public:
   ProtocolVersion protocol_version() const { return connection_->protocol_version(); }
   const Host::Ptr& connected_host() const { return connected_host_; }
@@ -366,6 +448,7 @@ private:
 private:
   void update_hosts(const HostMap& hosts);
   void update_schema(const ControlConnectionSchema& schema);
+  void notify_schema_changes();
   void update_token_map(const HostMap& hosts, const String& partitioner,
                         const ControlConnectionSchema& schema);
 
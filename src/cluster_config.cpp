@@ -245,6 +245,18 @@ void cass_cluster_set_resolve_timeout(CassCluster* cluster, unsigned timeout_ms)
   cluster->config().set_resolve_timeout(timeout_ms);
 }
 
+void cass_cluster_set_resolve_cache_ttl(CassCluster* cluster, unsigned ttl_ms) {
+  cluster->config().set_resolve_cache_ttl(ttl_ms);
+}
+
+void cass_cluster_set_contact_point_connect_delay(CassCluster* cluster, unsigned delay_ms) {
+  cluster->config().set_contact_point_connect_delay_ms(delay_ms);
+}
+
+void cass_cluster_set_local_hosts_first_connect(CassCluster* cluster, cass_bool_t enabled) {
+  cluster->config().set_local_hosts_first_connect(enabled == cass_true);
+}
+
 void cass_cluster_set_max_schema_wait_time(CassCluster* cluster, unsigned wait_time_ms) {
   cluster->config().set_max_schema_wait_time_ms(wait_time_ms);
 }
@@ -326,6 +338,134 @@ void cass_cluster_set_latency_aware_routing_settings(
   cluster->config().set_latency_aware_routing_settings(settings);
 }
 
+void cass_cluster_set_peak_ewma_routing(CassCluster* cluster, cass_bool_t enabled) {
+  cluster->config().set_peak_ewma_routing(enabled == cass_true);
+}
+
+CassError cass_cluster_set_peak_ewma_routing_settings(CassCluster* cluster,
+                                                      cass_uint64_t decay_ms,
+                                                      unsigned max_candidates) {
+  if (decay_ms == 0 || decay_ms > PeakEwmaPolicy::MAX_DECAY_MS || max_candidates == 0) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  PeakEwmaPolicy::Settings settings;
+  settings.decay_ns = decay_ms * 1000 * 1000;
+  settings.max_candidates = max_candidates;
+  cluster->config().set_peak_ewma_routing_settings(settings);
+  return CASS_OK;
+}
+
+void cass_cluster_set_outlier_detection(CassCluster* cluster, cass_bool_t enabled) {
+  cluster->config().set_outlier_detection(enabled == cass_true);
+}
+
+CassError cass_cluster_set_outlier_detection_settings(
+    CassCluster* cluster, cass_double_t failure_rate_threshold, unsigned min_requests,
+    cass_uint64_t interval_ms, cass_uint64_t base_ejection_ms, cass_uint64_t max_ejection_ms) {
+  if (failure_rate_threshold <= 0.0 || failure_rate_threshold > 1.0 || interval_ms == 0 ||
+      base_ejection_ms == 0 || max_ejection_ms < base_ejection_ms) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  OutlierDetectionPolicy::Settings settings;
+  settings.failure_rate_threshold = failure_rate_threshold;
+  settings.min_requests = min_requests;
+  settings.interval_ns = interval_ms * 1000 * 1000;
+  settings.base_ejection_ns = base_ejection_ms * 1000 * 1000;
+  settings.max_ejection_ns = max_ejection_ms * 1000 * 1000;
+  cluster->config().set_outlier_detection_settings(settings);
+  return CASS_OK;
+}
+
+CassError cass_cluster_set_retry_budget(CassCluster* cluster, cass_double_t retry_ratio,
+                                        unsigned max_retries) {
+  if (retry_ratio < 0.0 || retry_ratio > 1.0) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  RetryBudget::Settings settings;
+  settings.retry_ratio = retry_ratio;
+  settings.max_retries = max_retries;
+  cluster->config().set_retry_budget_settings(settings);
+  return CASS_OK;
+}
+
+void cass_cluster_set_adaptive_concurrency_limit(CassCluster* cluster, cass_bool_t enabled,
+                                                 cass_bool_t queue_excess_requests) {
+  ConcurrencyLimiterSettings settings(cluster->config().concurrency_limiter_settings());
+  settings.enabled = enabled == cass_true;
+  settings.queue_excess_requests = queue_excess_requests == cass_true;
+  cluster->config().set_concurrency_limiter_settings(settings);
+}
+
+CassError cass_cluster_set_adaptive_concurrency_limit_settings(
+    CassCluster* cluster, unsigned initial_limit, unsigned min_limit, unsigned max_limit,
+    cass_double_t backoff_ratio, cass_double_t latency_tolerance) {
+  if (min_limit == 0 || min_limit > max_limit || initial_limit < min_limit ||
+      initial_limit > max_limit || max_limit > static_cast<unsigned>(CASS_INT32_MAX) ||
+      backoff_ratio <= 0.0 || backoff_ratio >= 1.0 || latency_tolerance < 1.0) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  ConcurrencyLimiterSettings settings(cluster->config().concurrency_limiter_settings());
+  settings.initial_limit = initial_limit;
+  settings.min_limit = min_limit;
+  settings.max_limit = max_limit;
+  settings.backoff_ratio = backoff_ratio;
+  settings.latency_tolerance = latency_tolerance;
+  cluster->config().set_concurrency_limiter_settings(settings);
+  return CASS_OK;
+}
+
+CassError cass_cluster_set_priority_lanes(CassCluster* cluster, unsigned high_weight,
+                                          unsigned normal_weight, unsigned low_weight) {
+  if (high_weight == 0 || normal_weight == 0 || low_weight == 0) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  PriorityLaneSettings settings(cluster->config().priority_lane_settings());
+  settings.enabled = true;
+  settings.weights[CASS_REQUEST_PRIORITY_HIGH] = high_weight;
+  settings.weights[CASS_REQUEST_PRIORITY_NORMAL] = normal_weight;
+  settings.weights[CASS_REQUEST_PRIORITY_LOW] = low_weight;
+  cluster->config().set_priority_lane_settings(settings);
+  return CASS_OK;
+}
+
+CassError cass_cluster_set_priority_lane_max_inflight_requests(CassCluster* cluster,
+                                                               CassRequestPriority priority,
+                                                               unsigned max_inflight_requests) {
+  if (priority >= CASS_REQUEST_PRIORITY_LAST_ENTRY) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  PriorityLaneSettings settings(cluster->config().priority_lane_settings());
+  settings.max_inflight_requests[priority] = max_inflight_requests;
+  cluster->config().set_priority_lane_settings(settings);
+  return CASS_OK;
+}
+
+CassError cass_cluster_set_rate_limit(CassCluster* cluster, cass_double_t requests_per_second,
+                                      cass_uint64_t bytes_per_second,
+                                      cass_bool_t queue_excess_requests) {
+  if (requests_per_second < 0.0 || bytes_per_second > static_cast<cass_uint64_t>(CASS_INT64_MAX)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  RateLimitSettings settings;
+  settings.requests_per_second = requests_per_second;
+  settings.bytes_per_second = bytes_per_second;
+  settings.queue_excess_requests = queue_excess_requests == cass_true;
+  cluster->config().default_profile().set_rate_limit_settings(settings);
+  return CASS_OK;
+}
+
+void cass_cluster_set_singleflight_reads(CassCluster* cluster, cass_bool_t enabled) {
+  cluster->config().default_profile().set_singleflight_reads(enabled == cass_true);
+}
+
+CassError cass_cluster_set_priority(CassCluster* cluster, CassRequestPriority priority) {
+  if (priority >= CASS_REQUEST_PRIORITY_LAST_ENTRY) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  cluster->config().set_priority(priority);
+  return CASS_OK;
+}
+
 void cass_cluster_set_whitelist_filtering(CassCluster* cluster, const char* hosts) {
   cass_cluster_set_whitelist_filtering_n(cluster, hosts, SAFE_STRLEN(hosts));
 }
@@ -415,6 +555,19 @@ void cass_cluster_set_use_schema(CassCluster* cluster, cass_bool_t enabled) {
   cluster->config().set_use_schema(enabled == cass_true);
 }
 
+void cass_cluster_set_schema_metadata_keyspaces(CassCluster* cluster, const char* keyspaces) {
+  cass_cluster_set_schema_metadata_keyspaces_n(cluster, keyspaces, SAFE_STRLEN(keyspaces));
+}
+
+void cass_cluster_set_schema_metadata_keyspaces_n(CassCluster* cluster, const char* keyspaces,
+                                                  size_t keyspaces_length) {
+  if (keyspaces_length == 0) {
+    cluster->config().schema_keyspaces().clear();
+  } else {
+    explode(String(keyspaces, keyspaces_length), cluster->config().schema_keyspaces());
+  }
+}
+
 CassError cass_cluster_set_use_hostname_resolution(CassCluster* cluster, cass_bool_t enabled) {
   cluster->config().set_use_hostname_resolution(enabled == cass_true);
   return CASS_OK;
@@ -437,6 +590,18 @@ CassError cass_cluster_set_constant_speculative_execution_policy(CassCluster* cl
   return CASS_OK;
 }
 
+CassError cass_cluster_set_percentile_speculative_execution_policy(
+    CassCluster* cluster, cass_double_t percentile, int max_speculative_executions,
+    cass_double_t max_speculative_ratio) {
+  if (percentile <= 0.0 || percentile > 100.0 || max_speculative_executions < 0 ||
+      max_speculative_ratio < 0.0 || max_speculative_ratio > 1.0) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  cluster->config().set_speculative_execution_policy(new PercentileSpeculativeExecutionPolicy(
+      percentile, max_speculative_executions, max_speculative_ratio));
+  return CASS_OK;
+}
+
 CassError cass_cluster_set_no_speculative_execution_policy(CassCluster* cluster) {
   cluster->config().set_speculative_execution_policy(new NoSpeculativeExecutionPolicy());
   return CASS_OK;
@@ -471,6 +636,16 @@ CassError cass_cluster_set_prepare_on_up_or_add_host(CassCluster* cluster, cass_
   return CASS_OK;
 }
 
+void cass_cluster_set_prepare_on_up_or_add_host_hot_statements(CassCluster* cluster,
+                                                               unsigned count) {
+  cluster->config().set_prepare_on_up_or_add_host_hot_statements(count);
+}
+
+void cass_cluster_set_auto_prepare(CassCluster* cluster, unsigned threshold,
+                                   unsigned max_statements) {
+  cluster->config().set_auto_prepare(threshold, max_statements);
+}
+
 CassError cass_cluster_set_local_address(CassCluster* cluster, const char* name) {
   return cass_cluster_set_local_address_n(cluster, name, SAFE_STRLEN(name));
 }
@@ -549,6 +724,15 @@ CassError cass_cluster_set_cloud_secure_connection_bundle_no_ssl_lib_init_n(Cass
   return CASS_OK;
 }
 
+void cass_cluster_set_prepared_snapshot(CassCluster* cluster, const char* path) {
+  cass_cluster_set_prepared_snapshot_n(cluster, path, SAFE_STRLEN(path));
+}
+
+void cass_cluster_set_prepared_snapshot_n(CassCluster* cluster, const char* path,
+                                          size_t path_length) {
+  cluster->config().set_prepared_snapshot_path(String(path, path_length));
+}
+
 void cass_cluster_set_application_name(CassCluster* cluster, const char* application_name) {
   cass_cluster_set_application_name_n(cluster, application_name, SAFE_STRLEN(application_name));
 }
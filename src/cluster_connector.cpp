@@ -59,6 +59,8 @@ private:
 ClusterConnector::ClusterConnector(const AddressVec& contact_points,
                                    ProtocolVersion protocol_version, const Callback& callback)
     : remaining_connector_count_(0)
+    , is_resolving_(false)
+    , next_contact_point_index_(0)
     , contact_points_(contact_points)
     , protocol_version_(protocol_version)
     , listener_(NULL)
@@ -109,7 +111,12 @@ void ClusterConnector::internal_resolve_and_connect() {
   }
 
   resolver_ = settings_.cluster_metadata_resolver_factory->new_instance(settings_);
+  if (is_racing()) {
+    resolver_->set_contact_point_callback(
+        bind_callback(&ClusterConnector::on_resolve_contact_point, this));
+  }
 
+  is_resolving_ = true;
   resolver_->resolve(event_loop_->loop(), contact_points_,
                      bind_callback(&ClusterConnector::on_resolve, this));
 }
@@ -126,6 +133,7 @@ void ClusterConnector::internal_connect(const Address& address, ProtocolVersion
 
 void ClusterConnector::internal_cancel() {
   error_code_ = CLUSTER_CANCELED;
+  connect_delay_timer_.stop();
   if (resolver_) resolver_->cancel();
   for (ConnectorMap::iterator it = connectors_.begin(), end = connectors_.end(); it != end; ++it) {
     it->second->cancel();
@@ -133,7 +141,22 @@ void ClusterConnector::internal_cancel() {
   if (cluster_) cluster_->close();
 }
 
+void ClusterConnector::connect_next_contact_point() {
+  if (cluster_ || is_canceled()) return;
+
+  const AddressVec& contact_points(resolver_->resolved_contact_points());
+  if (next_contact_point_index_ >= contact_points.size()) return;
+
+  remaining_connector_count_++;
+  internal_connect(contact_points[next_contact_point_index_++], protocol_version_);
+
+  // Start the next attempt if this one hasn't finished within the delay
+  connect_delay_timer_.start(event_loop_->loop(), settings_.contact_point_connect_delay_ms,
+                             bind_callback(&ClusterConnector::on_connect_delay, this));
+}
+
 void ClusterConnector::finish() {
+  connect_delay_timer_.stop();
   callback_(this);
   if (cluster_) {
     // If the callback doesn't take possession of the cluster then we should
@@ -149,11 +172,27 @@ void ClusterConnector::finish() {
 }
 
 void ClusterConnector::maybe_finish() {
+  if (is_racing()) {
+    if (remaining_connector_count_ > 0) remaining_connector_count_--;
+    // A failed attempt starts the next attempt right away
+    connect_next_contact_point();
+    maybe_finish_race();
+    return;
+  }
+
   if (remaining_connector_count_ > 0 && --remaining_connector_count_ == 0) {
     finish();
   }
 }
 
+void ClusterConnector::maybe_finish_race() {
+  if (is_resolving_ || remaining_connector_count_ > 0) return;
+  if (cluster_ || is_canceled() ||
+      next_contact_point_index_ >= resolver_->resolved_contact_points().size()) {
+    finish();
+  }
+}
+
 void ClusterConnector::on_error(ClusterConnector::ClusterError code, const String& message) {
   assert(code != CLUSTER_OK && "Notified error without an error");
   error_message_ = message;
@@ -162,6 +201,24 @@ void ClusterConnector::on_error(ClusterConnector::ClusterError code, const Strin
 }
 
 void ClusterConnector::on_resolve(ClusterMetadataResolver* resolver) {
+  is_resolving_ = false;
+
+  if (is_racing()) {
+    local_dc_ = resolver->local_dc();
+    if (!cluster_ && !is_canceled()) {
+      if (resolver->resolved_contact_points().empty()) {
+        error_code_ = CLUSTER_ERROR_NO_HOSTS_AVAILABLE;
+        error_message_ = "Unable to connect to any contact points";
+      } else if (remaining_connector_count_ == 0 || !connect_delay_timer_.is_running()) {
+        // Start attempts for any contact points that were only available
+        // once resolving finished.
+        connect_next_contact_point();
+      }
+    }
+    maybe_finish_race();
+    return;
+  }
+
   if (is_canceled()) {
     finish();
     return;
@@ -185,6 +242,15 @@ void ClusterConnector::on_resolve(ClusterMetadataResolver* resolver) {
   }
 }
 
+void ClusterConnector::on_resolve_contact_point(ClusterMetadataResolver* resolver) {
+  // Start right away unless an attempt was started within the delay
+  if (!connect_delay_timer_.is_running()) {
+    connect_next_contact_point();
+  }
+}
+
+void ClusterConnector::on_connect_delay(Timer* timer) { connect_next_contact_point(); }
+
 void ClusterConnector::on_connect(ControlConnector* connector) {
   // Ignore logging protocol errors here because they're handled below
   if (!connector->is_ok() && !connector->is_canceled() && !connector->is_invalid_protocol()) {
@@ -265,7 +331,10 @@ void ClusterConnector::on_connect(ControlConnector* connector) {
     error_message_.clear();
     protocol_version_ = connector->protocol_version();
 
-    // The cluster is initialized so the rest of the connectors can be canceled.
+    // The cluster is initialized so the rest of the connectors (and any
+    // remaining contact point resolution) can be canceled.
+    connect_delay_timer_.stop();
+    if (is_resolving_) resolver_->cancel();
     for (ConnectorMap::iterator it = connectors_.begin(), end = connectors_.end(); it != end;
          ++it) {
       if (it->first != connector->address()) { // Not the current connector.
@@ -21,6 +21,7 @@
 #include "cluster.hpp"
 #include "cluster_metadata_resolver.hpp"
 #include "resolver.hpp"
+#include "timer.hpp"
 
 namespace datastax { namespace internal {
 
@@ -36,6 +37,11 @@ class Metrics;
  * contact points and returns after the first successful connection or it fails
  * if no connections can be made. It also handles negotiating the highest
  * supported server-side protocol version.
+ *
+ * If a contact point connect delay is configured then the contact points race
+ * each other: a connection attempt is started as soon as a contact point is
+ * resolved and subsequent attempts are staggered by the delay, or started
+ * immediately when the previous attempt fails.
  */
 class ClusterConnector : public RefCounted<ClusterConnector> {
 public:
@@ -141,11 +147,17 @@ private:
   void internal_connect(const Address& address, ProtocolVersion version);
   void internal_cancel();
 
+  bool is_racing() const { return settings_.contact_point_connect_delay_ms > 0; }
+  void connect_next_contact_point();
+
   void finish();
   void maybe_finish();
+  void maybe_finish_race();
 
   void on_error(ClusterError code, const String& message);
   void on_resolve(ClusterMetadataResolver* resolver);
+  void on_resolve_contact_point(ClusterMetadataResolver* resolver);
+  void on_connect_delay(Timer* timer);
   void on_connect(ControlConnector* connector);
 
 private:
@@ -162,6 +174,9 @@ private:
   ClusterMetadataResolver::Ptr resolver_;
   ConnectorMap connectors_;
   size_t remaining_connector_count_;
+  bool is_resolving_;
+  size_t next_contact_point_index_;
+  Timer connect_delay_timer_;
   AddressVec contact_points_;
   ProtocolVersion protocol_version_;
   ClusterListener* listener_;
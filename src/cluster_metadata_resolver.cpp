@@ -25,8 +25,10 @@ namespace {
 
 class DefaultClusterMetadataResolver : public ClusterMetadataResolver {
 public:
-  DefaultClusterMetadataResolver(uint64_t resolve_timeout_ms, int port)
+  DefaultClusterMetadataResolver(uint64_t resolve_timeout_ms, uint64_t resolve_cache_ttl_ms,
+                                 int port)
       : resolve_timeout_ms_(resolve_timeout_ms)
+      , resolve_cache_ttl_ms_(resolve_cache_ttl_ms)
       , port_(port) {}
 
 private:
@@ -39,11 +41,13 @@ private:
       int port = it->port() <= 0 ? port_ : it->port();
 
       if (it->is_resolved()) {
-        resolved_contact_points_.push_back(Address(it->hostname_or_address(), port));
+        add_resolved_contact_point(Address(it->hostname_or_address(), port));
       } else {
         if (!resolver_) {
-          resolver_.reset(
-              new MultiResolver(bind_callback(&DefaultClusterMetadataResolver::on_resolve, this)));
+          resolver_.reset(new MultiResolver(
+              bind_callback(&DefaultClusterMetadataResolver::on_resolve, this),
+              bind_callback(&DefaultClusterMetadataResolver::on_resolve_host, this)));
+          resolver_->set_cache_ttl_ms(resolve_cache_ttl_ms_);
         }
         resolver_->resolve(loop, it->hostname_or_address(), port, resolve_timeout_ms_);
       }
@@ -61,31 +65,30 @@ private:
   }
 
 private:
-  void on_resolve(MultiResolver* resolver) {
-    const Resolver::Vec& resolvers = resolver->resolvers();
-    for (Resolver::Vec::const_iterator it = resolvers.begin(), end = resolvers.end(); it != end;
-         ++it) {
-      const Resolver::Ptr resolver(*it);
-      if (resolver->is_success()) {
-        const AddressVec& addresses = resolver->addresses();
-        if (!addresses.empty()) {
-          for (AddressVec::const_iterator it = addresses.begin(), end = addresses.end(); it != end;
-               ++it) {
-            resolved_contact_points_.push_back(*it);
-          }
-        } else {
-          LOG_ERROR("No addresses resolved for %s:%d\n", resolver->hostname().c_str(),
-                    resolver->port());
+  void on_resolve_host(Resolver* resolver) {
+    // Addresses are added as soon as they're resolved so that connection
+    // attempts can start before all the contact points are resolved.
+    if (resolver->is_success()) {
+      const AddressVec& addresses = resolver->addresses();
+      if (!addresses.empty()) {
+        for (AddressVec::const_iterator it = addresses.begin(), end = addresses.end(); it != end;
+             ++it) {
+          add_resolved_contact_point(*it);
         }
-      } else if (resolver->is_timed_out()) {
-        LOG_ERROR("Timed out attempting to resolve address for %s:%d\n",
-                  resolver->hostname().c_str(), resolver->port());
-      } else if (!resolver->is_canceled()) {
-        LOG_ERROR("Unable to resolve address for %s:%d\n", resolver->hostname().c_str(),
+      } else {
+        LOG_ERROR("No addresses resolved for %s:%d\n", resolver->hostname().c_str(),
                   resolver->port());
       }
+    } else if (resolver->is_timed_out()) {
+      LOG_ERROR("Timed out attempting to resolve address for %s:%d\n",
+                resolver->hostname().c_str(), resolver->port());
+    } else if (!resolver->is_canceled()) {
+      LOG_ERROR("Unable to resolve address for %s:%d\n", resolver->hostname().c_str(),
+                resolver->port());
     }
+  }
 
+  void on_resolve(MultiResolver* resolver) {
     callback_(this);
     dec_ref();
   }
@@ -93,6 +96,7 @@ private:
 private:
   MultiResolver::Ptr resolver_;
   const uint64_t resolve_timeout_ms_;
+  const uint64_t resolve_cache_ttl_ms_;
   const int port_;
 };
 
@@ -100,7 +104,8 @@ private:
 
 ClusterMetadataResolver::Ptr
 DefaultClusterMetadataResolverFactory::new_instance(const ClusterSettings& settings) const {
+  const SocketSettings& socket_settings =
+      settings.control_connection_settings.connection_settings.socket_settings;
   return ClusterMetadataResolver::Ptr(new DefaultClusterMetadataResolver(
-      settings.control_connection_settings.connection_settings.socket_settings.resolve_timeout_ms,
-      settings.port));
+      socket_settings.resolve_timeout_ms, socket_settings.resolve_cache_ttl_ms, settings.port));
 }
@@ -46,6 +46,18 @@ public:
 
   virtual void cancel() { internal_cancel(); }
 
+  /**
+   * Set a callback that's called as soon as each contact point is added to the
+   * resolved contact points, before all the contact points have finished
+   * resolving. Resolvers that only determine their contact points at the end
+   * don't call this callback.
+   *
+   * @param callback The callback.
+   */
+  void set_contact_point_callback(const Callback& callback) {
+    contact_point_callback_ = callback;
+  }
+
   const AddressVec& resolved_contact_points() const { return resolved_contact_points_; }
   const String& local_dc() const { return local_dc_; }
 
@@ -54,10 +66,18 @@ protected:
 
   virtual void internal_cancel() = 0;
 
+  void add_resolved_contact_point(const Address& address) {
+    resolved_contact_points_.push_back(address);
+    if (contact_point_callback_) {
+      contact_point_callback_(this);
+    }
+  }
+
 protected:
   AddressVec resolved_contact_points_;
   String local_dc_;
   Callback callback_;
+  Callback contact_point_callback_;
 };
 
 /**
@@ -81,6 +81,19 @@ CASS_COLLECTION_APPEND(duration,
 
 #undef CASS_COLLECTION_APPEND
 
+#define CASS_COLLECTION_APPEND_ARRAY(Name, Type)                                                  \
+  CassError cass_collection_append_##Name##_array(CassCollection* collection, const Type* values, \
+                                                  size_t count) {                                 \
+    return collection->append_##Name##_array(values, count);                                      \
+  }
+
+CASS_COLLECTION_APPEND_ARRAY(int32, cass_int32_t)
+CASS_COLLECTION_APPEND_ARRAY(int64, cass_int64_t)
+CASS_COLLECTION_APPEND_ARRAY(float, cass_float_t)
+CASS_COLLECTION_APPEND_ARRAY(double, cass_double_t)
+
+#undef CASS_COLLECTION_APPEND_ARRAY
+
 CassError cass_collection_append_string(CassCollection* collection, const char* value) {
   return collection->append(CassString(value, SAFE_STRLEN(value)));
 }
@@ -106,32 +119,57 @@ CassError cass_collection_append_custom_n(CassCollection* collection, const char
 
 CassError Collection::append(CassNull value) {
   CASS_COLLECTION_CHECK_TYPE(value);
-  items_.push_back(Buffer());
+  Buffer buf(sizeof(int32_t));
+  buf.encode_int32(0, 0);
+  items_.push_back(buf);
+  ++item_count_;
   return CASS_OK;
 }
 
 CassError Collection::append(const Collection* value) {
   CASS_COLLECTION_CHECK_TYPE(value);
-  items_.push_back(value->encode());
+  items_.push_back(value->encode_with_length());
+  ++item_count_;
   return CASS_OK;
 }
 
 CassError Collection::append(const Tuple* value) {
   CASS_COLLECTION_CHECK_TYPE(value);
-  items_.push_back(value->encode());
+  items_.push_back(value->encode_with_length());
+  ++item_count_;
   return CASS_OK;
 }
 
 CassError Collection::append(const UserTypeValue* value) {
   CASS_COLLECTION_CHECK_TYPE(value);
-  items_.push_back(value->encode());
+  items_.push_back(value->encode_with_length());
+  ++item_count_;
   return CASS_OK;
 }
 
+#define APPEND_ARRAY(Name, Type, Width)                                           \
+  CassError Collection::append_##Name##_array(const Type* values, size_t count) { \
+    if (values == NULL && count > 0) return CASS_ERROR_LIB_BAD_PARAMS;            \
+    if (count == 0) return CASS_OK;                                               \
+    CassError rc = check_array(values[0], count);                                 \
+    if (rc != CASS_OK) return rc;                                                 \
+    Buffer buf(count * (sizeof(int32_t) + sizeof(Type)));                         \
+    encode_uint##Width##_elements(buf.data(), values, count);                     \
+    items_.push_back(buf);                                                        \
+    item_count_ += count;                                                         \
+    return CASS_OK;                                                               \
+  }
+
+APPEND_ARRAY(int32, cass_int32_t, 32)
+APPEND_ARRAY(int64, cass_int64_t, 64)
+APPEND_ARRAY(float, cass_float_t, 32)
+APPEND_ARRAY(double, cass_double_t, 64)
+
+#undef APPEND_ARRAY
+
 size_t Collection::get_items_size() const {
   size_t size = 0;
   for (BufferVec::const_iterator i = items_.begin(), end = items_.end(); i != end; ++i) {
-    size += sizeof(int32_t);
     size += i->size();
   }
   return size;
@@ -139,8 +177,6 @@ size_t Collection::get_items_size() const {
 
 void Collection::encode_items(char* buf) const {
   for (BufferVec::const_iterator i = items_.begin(), end = items_.end(); i != end; ++i) {
-    encode_int32(buf, i->size());
-    buf += sizeof(int32_t);
     memcpy(buf, i->data(), i->size());
     buf += i->size();
   }
@@ -38,12 +38,14 @@ class UserTypeValue;
 class Collection : public RefCounted<Collection> {
 public:
   Collection(CassCollectionType type, size_t item_count)
-      : data_type_(new CollectionType(static_cast<CassValueType>(type), false)) {
+      : data_type_(new CollectionType(static_cast<CassValueType>(type), false))
+      , item_count_(0) {
     items_.reserve(item_count);
   }
 
   Collection(const CollectionType::ConstPtr& data_type, size_t item_count)
-      : data_type_(data_type) {
+      : data_type_(data_type)
+      , item_count_(0) {
     items_.reserve(item_count);
   }
 
@@ -52,13 +54,14 @@ public:
   }
 
   const CollectionType::ConstPtr& data_type() const { return data_type_; }
-  const BufferVec& items() const { return items_; }
-
-#define APPEND_TYPE(Type)                  \
-  CassError append(const Type value) {     \
-    CASS_COLLECTION_CHECK_TYPE(value);     \
-    items_.push_back(core::encode(value)); \
-    return CASS_OK;                        \
+  size_t item_count() const { return item_count_; }
+
+#define APPEND_TYPE(Type)                              \
+  CassError append(const Type value) {                 \
+    CASS_COLLECTION_CHECK_TYPE(value);                 \
+    items_.push_back(core::encode_with_length(value)); \
+    ++item_count_;                                     \
+    return CASS_OK;                                    \
   }
 
   APPEND_TYPE(cass_int8_t)
@@ -84,6 +87,12 @@ public:
   CassError append(const Tuple* value);
   CassError append(const UserTypeValue* value);
 
+  // Appends a run of fixed width values, encoded into a single buffer
+  CassError append_int32_array(const cass_int32_t* values, size_t count);
+  CassError append_int64_array(const cass_int64_t* values, size_t count);
+  CassError append_float_array(const cass_float_t* values, size_t count);
+  CassError append_double_array(const cass_double_t* values, size_t count);
+
   size_t get_items_size() const;
   void encode_items(char* buf) const;
 
@@ -93,13 +102,16 @@ public:
   Buffer encode() const;
   Buffer encode_with_length() const;
 
-  void clear() { items_.clear(); }
+  void clear() {
+    items_.clear();
+    item_count_ = 0;
+  }
 
 private:
   template <class T>
   CassError check(const T value) {
     IsValidDataType<T> is_valid_type;
-    size_t index = items_.size();
+    size_t index = item_count_;
 
     switch (type()) {
       case CASS_COLLECTION_TYPE_MAP:
@@ -119,13 +131,28 @@ private:
     return CASS_OK;
   }
 
+  template <class T>
+  CassError check_array(const T value, size_t count) {
+    CASS_COLLECTION_CHECK_TYPE(value);
+    if (count > 1 && type() == CASS_COLLECTION_TYPE_MAP) {
+      // Values alternate between key and value so both types must match
+      item_count_++;
+      CassError rc = check(value);
+      item_count_--;
+      return rc;
+    }
+    return CASS_OK;
+  }
+
   int32_t get_count() const {
-    return ((type() == CASS_COLLECTION_TYPE_MAP) ? items_.size() / 2 : items_.size());
+    return ((type() == CASS_COLLECTION_TYPE_MAP) ? item_count_ / 2 : item_count_);
   }
 
 private:
   CollectionType::ConstPtr data_type_;
+  // Each buffer holds one or more encoded items, including their size prefixes
   BufferVec items_;
+  size_t item_count_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(Collection);
@@ -38,6 +38,39 @@ bool CollectionIterator::decode_value() {
   return decoder_.decode_value(data_type, value_, true);
 }
 
+CassError CollectionIterator::check_array(bool is_valid_type, size_t output_count,
+                                          size_t* count) {
+  if (collection_->value_type() == CASS_VALUE_TYPE_MAP || !is_valid_type) {
+    return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+  }
+  size_t remaining = static_cast<size_t>(count_ - (index_ + 1));
+  *count = output_count < remaining ? output_count : remaining;
+  return CASS_OK;
+}
+
+#define NEXT_ARRAY(Name, Type, Width, IsValidType)                                     \
+  CassError CollectionIterator::next_##Name##_array(Type* output, size_t output_count, \
+                                                    size_t* count_read) {              \
+    size_t count = 0;                                                                  \
+    CassValueType value_type = collection_->primary_value_type();                      \
+    CassError rc = check_array(IsValidType, output_count, &count);                     \
+    if (rc != CASS_OK) return rc;                                                      \
+    if (!decoder_.decode_uint##Width##_elements(output, count)) {                      \
+      return CASS_ERROR_LIB_INVALID_DATA;                                              \
+    }                                                                                  \
+    index_ += static_cast<int32_t>(count);                                             \
+    value_ = Value();                                                                  \
+    if (count_read != NULL) *count_read = count;                                       \
+    return CASS_OK;                                                                    \
+  }
+
+NEXT_ARRAY(int32, cass_int32_t, 32, value_type == CASS_VALUE_TYPE_INT)
+NEXT_ARRAY(int64, cass_int64_t, 64, is_int64_type(value_type))
+NEXT_ARRAY(float, cass_float_t, 32, value_type == CASS_VALUE_TYPE_FLOAT)
+NEXT_ARRAY(double, cass_double_t, 64, value_type == CASS_VALUE_TYPE_DOUBLE)
+
+#undef NEXT_ARRAY
+
 bool TupleIterator::next() {
   if (next_ == end_) {
     return false;
@@ -48,8 +48,16 @@ public:
 
   virtual bool next();
 
+  // Decodes up to `output_count` of the remaining elements in one pass. This
+  // requires a list or set with fixed width elements that are all non-null.
+  CassError next_int32_array(cass_int32_t* output, size_t output_count, size_t* count_read);
+  CassError next_int64_array(cass_int64_t* output, size_t output_count, size_t* count_read);
+  CassError next_float_array(cass_float_t* output, size_t output_count, size_t* count_read);
+  CassError next_double_array(cass_double_t* output, size_t output_count, size_t* count_read);
+
 private:
   bool decode_value();
+  CassError check_array(bool is_valid_type, size_t output_count, size_t* count);
 
 private:
   const Value* collection_;
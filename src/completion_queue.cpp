@@ -0,0 +1,156 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "completion_queue.hpp"
+
+#include "driver_config.hpp"
+#include "future.hpp"
+#include "logger.hpp"
+#include "scoped_lock.hpp"
+
+#ifdef HAVE_EVENTFD
+#include <errno.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+using namespace datastax::internal::core;
+
+extern "C" {
+
+CassCompletionQueue* cass_completion_queue_new() {
+  CompletionQueue* completion_queue = new CompletionQueue();
+  completion_queue->inc_ref();
+  return CassCompletionQueue::to(completion_queue);
+}
+
+void cass_completion_queue_free(CassCompletionQueue* completion_queue) {
+  completion_queue->dec_ref();
+}
+
+int cass_completion_queue_fd(const CassCompletionQueue* completion_queue) {
+  return completion_queue->fd();
+}
+
+size_t cass_completion_queue_poll(CassCompletionQueue* completion_queue, CassFuture** futures,
+                                  void** tags, size_t count) {
+  return completion_queue->poll(futures, tags, count);
+}
+
+size_t cass_completion_queue_wait_timed(CassCompletionQueue* completion_queue,
+                                        CassFuture** futures, void** tags, size_t count,
+                                        cass_duration_t timeout_us) {
+  return completion_queue->wait(futures, tags, count, timeout_us);
+}
+
+} // extern "C"
+
+CompletionQueue::CompletionQueue()
+    : is_signaled_(false)
+    , fd_(-1) {
+  uv_mutex_init(&mutex_);
+  uv_cond_init(&cond_);
+#ifdef HAVE_EVENTFD
+  fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (fd_ == -1) {
+    LOG_ERROR("Unable to create eventfd for completion queue: %s", strerror(errno));
+  }
+#endif
+}
+
+CompletionQueue::~CompletionQueue() {
+  // Release futures that were never drained
+  Future* future;
+  while ((future = queue_.dequeue()) != NULL) {
+    future->dec_ref();
+  }
+#ifdef HAVE_EVENTFD
+  if (fd_ != -1) close(fd_);
+#endif
+  uv_mutex_destroy(&mutex_);
+  uv_cond_destroy(&cond_);
+}
+
+void CompletionQueue::push(Future* future) {
+  queue_.enqueue(future);
+  notify();
+}
+
+size_t CompletionQueue::poll(CassFuture** futures, void** tags, size_t count) {
+  if (!is_signaled_.load(MEMORY_ORDER_ACQUIRE)) return 0;
+  return drain(futures, tags, count);
+}
+
+size_t CompletionQueue::wait(CassFuture** futures, void** tags, size_t count,
+                             uint64_t timeout_us) {
+  uint64_t start = uv_hrtime();
+  uint64_t timeout_ns = timeout_us * 1000;
+  while (true) {
+    size_t drained = poll(futures, tags, count);
+    if (drained > 0 || count == 0) return drained;
+
+    ScopedMutex lock(&mutex_);
+    while (!is_signaled_.load(MEMORY_ORDER_ACQUIRE)) {
+      uint64_t elapsed = uv_hrtime() - start;
+      if (elapsed >= timeout_ns || uv_cond_timedwait(&cond_, &mutex_, timeout_ns - elapsed) != 0) {
+        return 0;
+      }
+    }
+  }
+}
+
+size_t CompletionQueue::drain(CassFuture** futures, void** tags, size_t count) {
+#ifdef HAVE_EVENTFD
+  if (fd_ != -1) {
+    uint64_t value;
+    if (read(fd_, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+      LOG_ERROR("Unable to read completion queue eventfd: %s", strerror(errno));
+    }
+  }
+#endif
+  // Clear the signal before draining so that completions posted from here on
+  // signal again.
+  is_signaled_.store(false, MEMORY_ORDER_RELEASE);
+
+  size_t drained = 0;
+  Future* future;
+  while (drained < count && (future = queue_.dequeue()) != NULL) {
+    futures[drained] = CassFuture::to(future);
+    if (tags != NULL) tags[drained] = future->completion_tag();
+    ++drained;
+  }
+
+  // Completions that are left behind (or a producer that hasn't finished
+  // linking its completion) need to be picked up by the next drain.
+  if (!queue_.is_empty()) notify();
+
+  return drained;
+}
+
+void CompletionQueue::notify() {
+  if (is_signaled_.exchange(true, MEMORY_ORDER_ACQ_REL)) return;
+#ifdef HAVE_EVENTFD
+  if (fd_ != -1) {
+    uint64_t value = 1;
+    if (write(fd_, &value, sizeof(value)) < 0) {
+      LOG_ERROR("Unable to write completion queue eventfd: %s", strerror(errno));
+    }
+  }
+#endif
+  ScopedMutex lock(&mutex_);
+  uv_cond_signal(&cond_);
+}
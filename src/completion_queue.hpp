@@ -0,0 +1,79 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_COMPLETION_QUEUE_HPP
+#define DATASTAX_INTERNAL_COMPLETION_QUEUE_HPP
+
+#include "atomic.hpp"
+#include "cassandra.h"
+#include "external.hpp"
+#include "macros.hpp"
+#include "mpsc_queue.hpp"
+#include "ref_counted.hpp"
+
+#include <uv.h>
+
+namespace datastax { namespace internal { namespace core {
+
+class Future;
+
+/**
+ * Completed futures are posted here, from any thread, and drained by a
+ * single application thread. The consumer is only woken when the queue goes
+ * from drained to non-empty so many completions can be handled per wakeup.
+ */
+class CompletionQueue : public RefCounted<CompletionQueue> {
+public:
+  typedef SharedRefPtr<CompletionQueue> Ptr;
+
+  CompletionQueue();
+  ~CompletionQueue();
+
+  /**
+   * A file descriptor that becomes readable when completions are available
+   * (an eventfd). -1 if it's not supported on this platform.
+   */
+  int fd() const { return fd_; }
+
+  /**
+   * Posts a completed future. The queue takes over a reference to the
+   * future which is handed to the consumer.
+   */
+  void push(Future* future);
+
+  size_t poll(CassFuture** futures, void** tags, size_t count);
+  size_t wait(CassFuture** futures, void** tags, size_t count, uint64_t timeout_us);
+
+private:
+  size_t drain(CassFuture** futures, void** tags, size_t count);
+  void notify();
+
+private:
+  MPSCQueue<Future> queue_;
+  Atomic<bool> is_signaled_;
+  uv_mutex_t mutex_;
+  uv_cond_t cond_;
+  int fd_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(CompletionQueue);
+};
+
+}}} // namespace datastax::internal::core
+
+EXTERNAL_TYPE(datastax::internal::core::CompletionQueue, CassCompletionQueue)
+
+#endif
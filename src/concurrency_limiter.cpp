@@ -0,0 +1,124 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "concurrency_limiter.hpp"
+
+#include "cassandra.h"
+#include "scoped_lock.hpp"
+#include "spin_lock.hpp"
+
+#include <algorithm>
+
+using namespace datastax::internal::core;
+
+SaturatedHostTracker::SaturatedHostTracker()
+    : count_(0) {
+  uv_mutex_init(&mutex_);
+}
+
+SaturatedHostTracker::~SaturatedHostTracker() { uv_mutex_destroy(&mutex_); }
+
+void SaturatedHostTracker::add_listener(Listener* listener) {
+  ScopedMutex l(&mutex_);
+  listeners_.push_back(listener);
+}
+
+void SaturatedHostTracker::remove_listener(Listener* listener) {
+  ScopedMutex l(&mutex_);
+  listeners_.erase(std::remove(listeners_.begin(), listeners_.end(), listener), listeners_.end());
+}
+
+void SaturatedHostTracker::on_host_unsaturated() {
+  count_.fetch_sub(1);
+  ScopedMutex l(&mutex_);
+  for (Vector<Listener*>::iterator it = listeners_.begin(), end = listeners_.end(); it != end;
+       ++it) {
+    (*it)->on_host_unsaturated();
+  }
+}
+
+ConcurrencyLimiter::ConcurrencyLimiter(const ConcurrencyLimiterSettings& settings,
+                                       const SaturatedHostTracker::Ptr& tracker)
+    : settings_(settings)
+    , estimated_limit_(settings.initial_limit)
+    , min_rtt_ns_(0)
+    , window_min_rtt_ns_(CASS_UINT64_MAX)
+    , window_end_ns_(uv_hrtime() + settings.min_rtt_window_ns)
+    , last_decrease_ns_(0)
+    , limit_(static_cast<int32_t>(settings.initial_limit))
+    , is_saturated_(false)
+    , tracker_(tracker) {}
+
+ConcurrencyLimiter::~ConcurrencyLimiter() {
+  if (tracker_ && is_saturated_.load()) {
+    tracker_->on_host_unsaturated();
+  }
+}
+
+void ConcurrencyLimiter::update(uint64_t latency_ns, int32_t inflight, bool is_dropped) {
+  uint64_t now = uv_hrtime();
+
+  ScopedSpinlock l(SpinlockPool<ConcurrencyLimiter>::get_spinlock(this));
+
+  if (!is_dropped) {
+    if (min_rtt_ns_ == 0 || latency_ns < min_rtt_ns_) min_rtt_ns_ = latency_ns;
+    if (latency_ns < window_min_rtt_ns_) window_min_rtt_ns_ = latency_ns;
+    if (now >= window_end_ns_) {
+      min_rtt_ns_ = window_min_rtt_ns_;
+      window_min_rtt_ns_ = CASS_UINT64_MAX;
+      window_end_ns_ = now + settings_.min_rtt_window_ns;
+    }
+  }
+
+  bool is_congested =
+      is_dropped || (min_rtt_ns_ > 0 && latency_ns > settings_.latency_tolerance * min_rtt_ns_);
+
+  if (is_congested) {
+    // Responses to requests sent before the last decrease don't reflect it so
+    // only decrease once per round trip.
+    if (now - last_decrease_ns_ >= latency_ns) {
+      estimated_limit_ *= settings_.backoff_ratio;
+      if (estimated_limit_ < settings_.min_limit) estimated_limit_ = settings_.min_limit;
+      last_decrease_ns_ = now;
+    }
+  } else if (2 * static_cast<double>(inflight) >= estimated_limit_) {
+    estimated_limit_ += 1.0 / estimated_limit_;
+    if (estimated_limit_ > settings_.max_limit) estimated_limit_ = settings_.max_limit;
+  }
+
+  limit_.store(static_cast<int32_t>(estimated_limit_), MEMORY_ORDER_RELAXED);
+}
+
+void ConcurrencyLimiter::update_saturation(const Atomic<int32_t>& inflight) {
+  // The number of in-flight requests and the limit change concurrently. Retry
+  // until the recorded state matches the one observed after the last change
+  // so that the tracker isn't left with a stale count.
+  while (true) {
+    bool is_saturated = inflight.load() >= limit();
+    bool was_saturated = !is_saturated;
+    if (is_saturated_.compare_exchange_strong(was_saturated, is_saturated)) {
+      if (tracker_) {
+        if (is_saturated) {
+          tracker_->on_host_saturated();
+        } else {
+          tracker_->on_host_unsaturated();
+        }
+      }
+    } else if (was_saturated == is_saturated) {
+      return;
+    }
+  }
+}
@@ -0,0 +1,148 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_CONCURRENCY_LIMITER_HPP
+#define DATASTAX_INTERNAL_CONCURRENCY_LIMITER_HPP
+
+#include "allocated.hpp"
+#include "atomic.hpp"
+#include "macros.hpp"
+#include "ref_counted.hpp"
+#include "vector.hpp"
+
+#include <stdint.h>
+#include <uv.h>
+
+namespace datastax { namespace internal { namespace core {
+
+struct ConcurrencyLimiterSettings {
+  ConcurrencyLimiterSettings()
+      : enabled(false)
+      , queue_excess_requests(true)
+      , initial_limit(20)
+      , min_limit(1)
+      , max_limit(1000)
+      , backoff_ratio(0.9)
+      , latency_tolerance(2.0)
+      , min_rtt_window_ns(10LL * 1000LL * 1000LL * 1000LL) {}
+
+  bool enabled;
+  bool queue_excess_requests;
+  unsigned initial_limit;
+  unsigned min_limit;
+  unsigned max_limit;
+  double backoff_ratio;
+  double latency_tolerance;
+  uint64_t min_rtt_window_ns;
+};
+
+/**
+ * Counts a session's hosts that are at their concurrency limit. Request
+ * processors compare the count with their number of connected hosts instead
+ * of checking every host, and are notified when a host drops below its limit
+ * so that they can process the requests they left in their queues.
+ */
+class SaturatedHostTracker : public RefCounted<SaturatedHostTracker> {
+public:
+  typedef SharedRefPtr<SaturatedHostTracker> Ptr;
+
+  class Listener {
+  public:
+    virtual ~Listener() {}
+
+    /**
+     * A host dropped below its limit. This can be called on any thread.
+     */
+    virtual void on_host_unsaturated() = 0;
+  };
+
+  SaturatedHostTracker();
+  ~SaturatedHostTracker();
+
+  size_t count() const { return count_.load(); }
+
+  void add_listener(Listener* listener);
+  void remove_listener(Listener* listener);
+
+  void on_host_saturated() { count_.fetch_add(1); }
+  void on_host_unsaturated();
+
+private:
+  Atomic<size_t> count_;
+  uv_mutex_t mutex_;
+  Vector<Listener*> listeners_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(SaturatedHostTracker);
+};
+
+/**
+ * An adaptive limit on the number of in-flight requests to a host using
+ * additive-increase/multiplicative-decrease (AIMD) driven by the measured
+ * round-trip time (RTT).
+ *
+ * The limit grows by about one for every "limit" responses while the host is
+ * using at least half of it, and shrinks by the backoff ratio (at most once
+ * per round trip) when a request is dropped (e.g. timed out or overloaded) or
+ * its RTT exceeds the minimum RTT by more than the latency tolerance. The
+ * minimum RTT is re-measured every window so that the limit adapts to a
+ * changing baseline.
+ */
+class ConcurrencyLimiter : public Allocated {
+public:
+  ConcurrencyLimiter(const ConcurrencyLimiterSettings& settings,
+                     const SaturatedHostTracker::Ptr& tracker);
+  ~ConcurrencyLimiter();
+
+  int32_t limit() const { return limit_.load(MEMORY_ORDER_RELAXED); }
+
+  /**
+   * Update the limit with a request's result.
+   *
+   * @param latency_ns The request's RTT in nanoseconds.
+   * @param inflight The number of in-flight requests to the host.
+   * @param is_dropped true if the request timed out or was rejected by the
+   * host.
+   */
+  void update(uint64_t latency_ns, int32_t inflight, bool is_dropped);
+
+  /**
+   * Update the tracker when the host reaches or drops below its limit. This
+   * must be called after the number of in-flight requests or the limit
+   * changes.
+   *
+   * @param inflight The host's number of in-flight requests.
+   */
+  void update_saturation(const Atomic<int32_t>& inflight);
+
+private:
+  const ConcurrencyLimiterSettings settings_;
+  double estimated_limit_;
+  uint64_t min_rtt_ns_;
+  uint64_t window_min_rtt_ns_;
+  uint64_t window_end_ns_;
+  uint64_t last_decrease_ns_;
+  Atomic<int32_t> limit_;
+  Atomic<bool> is_saturated_;
+  SaturatedHostTracker::Ptr tracker_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ConcurrencyLimiter);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
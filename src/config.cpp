@@ -29,6 +29,10 @@ void Config::init_profiles() {
       it->second.set_request_timeout(default_profile_.request_timeout_ms());
     }
 
+    if (it->second.priority() == CASS_REQUEST_PRIORITY_UNKNOWN) {
+      it->second.set_priority(default_profile_.priority());
+    }
+
     if (!it->second.retry_policy()) {
       it->second.set_retry_policy(default_profile_.retry_policy().get());
     }
@@ -37,5 +41,8 @@ void Config::init_profiles() {
       it->second.set_speculative_execution_policy(
           default_profile_.speculative_execution_policy()->new_instance());
     }
+
+    // Each session has its own rate limit budget
+    it->second.build_rate_limit_budget();
   }
 }
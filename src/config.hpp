@@ -21,10 +21,13 @@
 #include "cassandra.h"
 #include "cloud_secure_connection_config.hpp"
 #include "cluster_metadata_resolver.hpp"
+#include "concurrency_limiter.hpp"
 #include "constants.hpp"
 #include "execution_profile.hpp"
+#include "priority_lane.hpp"
 #include "protocol.hpp"
 #include "reconnection_policy.hpp"
+#include "retry_budget.hpp"
 #include "speculative_execution.hpp"
 #include "ssl.hpp"
 #include "string.hpp"
@@ -48,6 +51,9 @@ public:
       , reconnection_policy_(new ExponentialReconnectionPolicy())
       , connect_timeout_ms_(CASS_DEFAULT_CONNECT_TIMEOUT_MS)
       , resolve_timeout_ms_(CASS_DEFAULT_RESOLVE_TIMEOUT_MS)
+      , resolve_cache_ttl_ms_(CASS_DEFAULT_RESOLVE_CACHE_TTL_MS)
+      , contact_point_connect_delay_ms_(CASS_DEFAULT_CONTACT_POINT_CONNECT_DELAY_MS)
+      , local_hosts_first_connect_(CASS_DEFAULT_LOCAL_HOSTS_FIRST_CONNECT)
       , max_schema_wait_time_ms_(CASS_DEFAULT_MAX_SCHEMA_WAIT_TIME_MS)
       , max_tracing_wait_time_ms_(CASS_DEFAULT_MAX_TRACING_DATA_WAIT_TIME_MS)
       , retry_tracing_wait_time_ms_(CASS_DEFAULT_RETRY_TRACING_DATA_WAIT_TIME_MS)
@@ -70,6 +76,10 @@ public:
       , max_reusable_write_objects_(CASS_DEFAULT_MAX_REUSABLE_WRITE_OBJECTS)
       , prepare_on_all_hosts_(CASS_DEFAULT_PREPARE_ON_ALL_HOSTS)
       , prepare_on_up_or_add_host_(CASS_DEFAULT_PREPARE_ON_UP_OR_ADD_HOST)
+      , prepare_on_up_or_add_host_hot_statements_(
+            CASS_DEFAULT_PREPARE_ON_UP_OR_ADD_HOST_HOT_STATEMENTS)
+      , auto_prepare_threshold_(CASS_DEFAULT_AUTO_PREPARE_THRESHOLD)
+      , auto_prepare_max_statements_(CASS_DEFAULT_AUTO_PREPARE_MAX_STATEMENTS)
       , no_compact_(CASS_DEFAULT_NO_COMPACT)
       , is_client_id_set_(false)
       , host_listener_(new DefaultHostListener())
@@ -80,6 +90,7 @@ public:
     // Assign the defaults to the cluster profile
     default_profile_.set_serial_consistency(CASS_DEFAULT_SERIAL_CONSISTENCY);
     default_profile_.set_request_timeout(CASS_DEFAULT_REQUEST_TIMEOUT_MS);
+    default_profile_.set_priority(CASS_REQUEST_PRIORITY_NORMAL);
     default_profile_.set_load_balancing_policy(new DCAwarePolicy());
     default_profile_.set_retry_policy(new DefaultRetryPolicy());
     default_profile_.set_speculative_execution_policy(new NoSpeculativeExecutionPolicy());
@@ -88,6 +99,7 @@ public:
   Config new_instance() const {
     Config config = *this;
     config.default_profile_.build_load_balancing_policy();
+    config.default_profile_.build_rate_limit_budget();
     config.init_profiles(); // Initializes the profiles from default (if needed)
     config.set_speculative_execution_policy(
         default_profile_.speculative_execution_policy()->new_instance());
@@ -105,6 +117,9 @@ public:
     default_profile_.set_serial_consistency(serial_consistency);
   }
 
+  CassRequestPriority priority() const { return default_profile_.priority(); }
+  void set_priority(CassRequestPriority priority) { default_profile_.set_priority(priority); }
+
   unsigned thread_count_io() const { return thread_count_io_; }
 
   void set_thread_count_io(unsigned num_threads) { thread_count_io_ = num_threads; }
@@ -166,6 +181,20 @@ public:
 
   void set_resolve_timeout(unsigned timeout_ms) { resolve_timeout_ms_ = timeout_ms; }
 
+  unsigned resolve_cache_ttl_ms() const { return resolve_cache_ttl_ms_; }
+
+  void set_resolve_cache_ttl(unsigned ttl_ms) { resolve_cache_ttl_ms_ = ttl_ms; }
+
+  unsigned contact_point_connect_delay_ms() const { return contact_point_connect_delay_ms_; }
+
+  void set_contact_point_connect_delay_ms(unsigned delay_ms) {
+    contact_point_connect_delay_ms_ = delay_ms;
+  }
+
+  bool local_hosts_first_connect() const { return local_hosts_first_connect_; }
+
+  void set_local_hosts_first_connect(bool enabled) { local_hosts_first_connect_ = enabled; }
+
   const AddressVec& contact_points() const { return contact_points_; }
 
   AddressVec& contact_points() { return contact_points_; }
@@ -251,6 +280,22 @@ public:
     default_profile_.set_latency_aware_routing_settings(settings);
   }
 
+  void set_peak_ewma_routing(bool is_peak_ewma) {
+    default_profile_.set_peak_ewma_routing(is_peak_ewma);
+  }
+
+  void set_peak_ewma_routing_settings(const PeakEwmaPolicy::Settings& settings) {
+    default_profile_.set_peak_ewma_routing_settings(settings);
+  }
+
+  void set_outlier_detection(bool is_enabled) {
+    default_profile_.set_outlier_detection(is_enabled);
+  }
+
+  void set_outlier_detection_settings(const OutlierDetectionPolicy::Settings& settings) {
+    default_profile_.set_outlier_detection_settings(settings);
+  }
+
   bool tcp_nodelay_enable() const { return tcp_nodelay_enable_; }
 
   void set_tcp_nodelay(bool enable) { tcp_nodelay_enable_ = enable; }
@@ -291,6 +336,9 @@ public:
   bool use_schema() const { return use_schema_; }
   void set_use_schema(bool enable) { use_schema_ = enable; }
 
+  const KeyspaceList& schema_keyspaces() const { return schema_keyspaces_; }
+  KeyspaceList& schema_keyspaces() { return schema_keyspaces_; }
+
   bool use_hostname_resolution() const { return use_hostname_resolution_; }
   void set_use_hostname_resolution(bool enable) { use_hostname_resolution_ = enable; }
 
@@ -314,6 +362,26 @@ public:
     profiles_[name] = copy;
   }
 
+  const RetryBudget::Settings& retry_budget_settings() const { return retry_budget_settings_; }
+
+  const ConcurrencyLimiterSettings& concurrency_limiter_settings() const {
+    return concurrency_limiter_settings_;
+  }
+
+  void set_concurrency_limiter_settings(const ConcurrencyLimiterSettings& settings) {
+    concurrency_limiter_settings_ = settings;
+  }
+
+  const PriorityLaneSettings& priority_lane_settings() const { return priority_lane_settings_; }
+
+  void set_priority_lane_settings(const PriorityLaneSettings& settings) {
+    priority_lane_settings_ = settings;
+  }
+
+  void set_retry_budget_settings(const RetryBudget::Settings& settings) {
+    retry_budget_settings_ = settings;
+  }
+
   bool prepare_on_all_hosts() const { return prepare_on_all_hosts_; }
 
   void set_prepare_on_all_hosts(bool enabled) { prepare_on_all_hosts_ = enabled; }
@@ -322,6 +390,23 @@ public:
 
   void set_prepare_on_up_or_add_host(bool enabled) { prepare_on_up_or_add_host_ = enabled; }
 
+  unsigned prepare_on_up_or_add_host_hot_statements() const {
+    return prepare_on_up_or_add_host_hot_statements_;
+  }
+
+  void set_prepare_on_up_or_add_host_hot_statements(unsigned count) {
+    prepare_on_up_or_add_host_hot_statements_ = count;
+  }
+
+  unsigned auto_prepare_threshold() const { return auto_prepare_threshold_; }
+
+  unsigned auto_prepare_max_statements() const { return auto_prepare_max_statements_; }
+
+  void set_auto_prepare(unsigned threshold, unsigned max_statements) {
+    auto_prepare_threshold_ = threshold;
+    auto_prepare_max_statements_ = max_statements;
+  }
+
   const Address& local_address() const { return local_address_; }
 
   void set_local_address(const Address& address) { local_address_ = address; }
@@ -342,6 +427,10 @@ public:
     application_version_ = application_version;
   }
 
+  const String& prepared_snapshot_path() const { return prepared_snapshot_path_; }
+
+  void set_prepared_snapshot_path(const String& path) { prepared_snapshot_path_ = path; }
+
   CassUuid client_id() const { return client_id_; }
   bool is_client_id_set() const { return is_client_id_set_; }
 
@@ -406,6 +495,9 @@ private:
   SharedRefPtr<ReconnectionPolicy> reconnection_policy_;
   unsigned connect_timeout_ms_;
   unsigned resolve_timeout_ms_;
+  unsigned resolve_cache_ttl_ms_;
+  unsigned contact_point_connect_delay_ms_;
+  bool local_hosts_first_connect_;
   unsigned max_schema_wait_time_ms_;
   unsigned max_tracing_wait_time_ms_;
   unsigned retry_tracing_wait_time_ms_;
@@ -424,17 +516,25 @@ private:
   unsigned connection_heartbeat_interval_secs_;
   SharedRefPtr<TimestampGenerator> timestamp_gen_;
   bool use_schema_;
+  KeyspaceList schema_keyspaces_;
   bool use_hostname_resolution_;
   bool use_randomized_contact_points_;
   unsigned max_reusable_write_objects_;
   ExecutionProfile default_profile_;
   ExecutionProfile::Map profiles_;
+  RetryBudget::Settings retry_budget_settings_;
+  ConcurrencyLimiterSettings concurrency_limiter_settings_;
+  PriorityLaneSettings priority_lane_settings_;
   bool prepare_on_all_hosts_;
   bool prepare_on_up_or_add_host_;
+  unsigned prepare_on_up_or_add_host_hot_statements_;
+  unsigned auto_prepare_threshold_;
+  unsigned auto_prepare_max_statements_;
   Address local_address_;
   bool no_compact_;
   String application_name_;
   String application_version_;
+  String prepared_snapshot_path_;
   bool is_client_id_set_;
   CassUuid client_id_;
   DefaultHostListener::Ptr host_listener_;
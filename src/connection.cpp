@@ -320,7 +320,7 @@ void Connection::restart_heartbeat_timer() {
   }
 }
 
-void Connection::on_heartbeat(Timer* timer) {
+void Connection::on_heartbeat(WheelTimer* timer) {
   if (!heartbeat_outstanding_ && !socket_->is_closing()) {
     RequestCallback::Ptr callback(new HeartbeatCallback(this));
     if (write_and_flush(callback) < 0) {
@@ -347,7 +347,7 @@ void Connection::restart_terminate_timer() {
   }
 }
 
-void Connection::on_terminate(Timer* timer) {
+void Connection::on_terminate(WheelTimer* timer) {
   LOG_ERROR("Failed to send a heartbeat within connection idle interval. "
             "Terminating connection...");
   defunct();
@@ -18,6 +18,7 @@
 #include "request_callback.hpp"
 #include "socket.hpp"
 #include "stream_manager.hpp"
+#include "timing_wheel.hpp"
 
 #ifndef DATASTAX_INTERNAL_CONNECTION_HPP
 #define DATASTAX_INTERNAL_CONNECTION_HPP
@@ -222,10 +223,10 @@ private:
 
 private:
   void restart_heartbeat_timer();
-  void on_heartbeat(Timer* timer);
+  void on_heartbeat(WheelTimer* timer);
 
   void restart_terminate_timer();
-  void on_terminate(Timer* timer);
+  void on_terminate(WheelTimer* timer);
 
 private:
   Socket::Ptr socket_;
@@ -244,8 +245,8 @@ private:
   unsigned int idle_timeout_secs_;
   unsigned int heartbeat_interval_secs_;
   bool heartbeat_outstanding_;
-  Timer heartbeat_timer_;
-  Timer terminate_timer_;
+  WheelTimer heartbeat_timer_;
+  WheelTimer terminate_timer_;
 };
 
 }}} // namespace datastax::internal::core
@@ -119,6 +119,9 @@
 #define CASS_DEFAULT_NUM_CONNECTIONS_PER_HOST 1
 #define CASS_DEFAULT_PREPARE_ON_ALL_HOSTS true
 #define CASS_DEFAULT_PREPARE_ON_UP_OR_ADD_HOST true
+#define CASS_DEFAULT_PREPARE_ON_UP_OR_ADD_HOST_HOT_STATEMENTS 0
+#define CASS_DEFAULT_AUTO_PREPARE_THRESHOLD 0
+#define CASS_DEFAULT_AUTO_PREPARE_MAX_STATEMENTS 1024
 #define CASS_DEFAULT_PORT 9042
 #define CASS_DEFAULT_QUEUE_SIZE_IO 8192
 #define CASS_DEFAULT_CONSTANT_RECONNECT_WAIT_TIME_MS 2000u
@@ -126,6 +129,9 @@
   CASS_DEFAULT_CONSTANT_RECONNECT_WAIT_TIME_MS
 #define CASS_DEFAULT_EXPONENTIAL_RECONNECT_MAX_DELAY_MS 600000u // 10 minutes
 #define CASS_DEFAULT_RESOLVE_TIMEOUT_MS 5000
+#define CASS_DEFAULT_RESOLVE_CACHE_TTL_MS 0
+#define CASS_DEFAULT_CONTACT_POINT_CONNECT_DELAY_MS 0
+#define CASS_DEFAULT_LOCAL_HOSTS_FIRST_CONNECT false
 #define CASS_DEFAULT_TCP_KEEPALIVE_DELAY_SECS 0
 #define CASS_DEFAULT_TCP_KEEPALIVE_ENABLED true
 #define CASS_DEFAULT_TCP_NO_DELAY_ENABLED true
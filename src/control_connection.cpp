@@ -312,9 +312,36 @@ ControlConnectionSettings::ControlConnectionSettings()
 ControlConnectionSettings::ControlConnectionSettings(const Config& config)
     : connection_settings(config)
     , use_schema(config.use_schema())
+    , schema_keyspaces(config.schema_keyspaces())
     , use_token_aware_routing(config.token_aware_routing())
     , address_factory(create_address_factory_from_config(config)) {}
 
+bool ControlConnectionSettings::is_schema_keyspace(const StringRef& keyspace_name) const {
+  if (schema_keyspaces.empty()) return true;
+  for (KeyspaceList::const_iterator it = schema_keyspaces.begin(), end = schema_keyspaces.end();
+       it != end; ++it) {
+    if (keyspace_name == *it) return true;
+  }
+  return false;
+}
+
+String ControlConnectionSettings::schema_keyspaces_where_clause() const {
+  if (schema_keyspaces.empty()) return String();
+  String clause(" WHERE keyspace_name IN (");
+  for (KeyspaceList::const_iterator it = schema_keyspaces.begin(), end = schema_keyspaces.end();
+       it != end; ++it) {
+    if (it != schema_keyspaces.begin()) clause.append(",");
+    clause.append("'");
+    for (String::const_iterator c = it->begin(), c_end = it->end(); c != c_end; ++c) {
+      if (*c == '\'') clause.push_back('\''); // Escape single quotes
+      clause.push_back(*c);
+    }
+    clause.append("'");
+  }
+  clause.append(")");
+  return clause;
+}
+
 ControlConnector::ControlConnector(const Host::Ptr& host, ProtocolVersion protocol_version,
                                    const Callback& callback)
     : connector_(
@@ -741,6 +768,12 @@ void ControlConnection::on_event(const EventResponse::Ptr& response) {
         return;
       }
 
+      // Only keyspace metadata is kept for keyspaces that aren't schema keyspaces
+      if (response->schema_change_target() != EventResponse::KEYSPACE &&
+          !settings_.is_schema_keyspace(response->keyspace())) {
+        return;
+      }
+
       LOG_DEBUG("Schema change (%d): %.*s %.*s", response->schema_change(),
                 (int)response->keyspace().size(), response->keyspace().data(),
                 (int)response->target().size(), response->target().data());
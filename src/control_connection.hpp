@@ -176,6 +176,30 @@ struct ControlConnectionSettings {
    */
   bool use_schema;
 
+  /**
+   * The keyspaces that table, column, type, function and aggregate metadata
+   * is retrieved for. All keyspaces are used if empty. Keyspace metadata
+   * (including replication) is always retrieved for every keyspace.
+   */
+  KeyspaceList schema_keyspaces;
+
+  /**
+   * Determines if schema metadata (other than keyspace metadata) is retrieved
+   * for a keyspace.
+   *
+   * @param keyspace_name The name of the keyspace.
+   * @return true if the keyspace's metadata is retrieved.
+   */
+  bool is_schema_keyspace(const StringRef& keyspace_name) const;
+
+  /**
+   * Get the where clause that restricts a schema query to the schema
+   * keyspaces.
+   *
+   * @return The where clause or an empty string if all keyspaces are used.
+   */
+  String schema_keyspaces_where_clause() const;
+
   /**
    * If true then the control connection will listen for keyspace schema
    * events. This is needed for the keyspaces replication strategy.
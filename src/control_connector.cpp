@@ -242,37 +242,41 @@ void ControlConnector::handle_query_hosts(HostsConnectorRequestCallback* callbac
 void ControlConnector::query_schema() {
   ChainedRequestCallback::Ptr callback;
 
+  // Keyspaces are always queried in full because they're needed for the
+  // token map's replication strategies.
+  String where(settings_.schema_keyspaces_where_clause());
+
   if (server_version_ >= VersionNumber(3, 0, 0)) {
     callback = ChainedRequestCallback::Ptr(
         new SchemaConnectorRequestCallback("keyspaces", SELECT_KEYSPACES_30, this));
     if (settings_.use_schema) {
-      callback = callback->chain("tables", SELECT_TABLES_30)
-                     ->chain("views", SELECT_VIEWS_30)
-                     ->chain("columns", SELECT_COLUMNS_30)
-                     ->chain("indexes", SELECT_INDEXES_30)
-                     ->chain("user_types", SELECT_USERTYPES_30)
-                     ->chain("functions", SELECT_FUNCTIONS_30)
-                     ->chain("aggregates", SELECT_AGGREGATES_30);
+      callback = callback->chain("tables", SELECT_TABLES_30 + where)
+                     ->chain("views", SELECT_VIEWS_30 + where)
+                     ->chain("columns", SELECT_COLUMNS_30 + where)
+                     ->chain("indexes", SELECT_INDEXES_30 + where)
+                     ->chain("user_types", SELECT_USERTYPES_30 + where)
+                     ->chain("functions", SELECT_FUNCTIONS_30 + where)
+                     ->chain("aggregates", SELECT_AGGREGATES_30 + where);
 
       if (server_version_ >= VersionNumber(4, 0, 0)) {
         callback = callback->chain("virtual_keyspaces", SELECT_VIRTUAL_KEYSPACES_40)
-                       ->chain("virtual_tables", SELECT_VIRTUAL_TABLES_40)
-                       ->chain("virtual_columns", SELECT_VIRTUAL_COLUMNS_40);
+                       ->chain("virtual_tables", SELECT_VIRTUAL_TABLES_40 + where)
+                       ->chain("virtual_columns", SELECT_VIRTUAL_COLUMNS_40 + where);
       }
     }
   } else {
     callback = ChainedRequestCallback::Ptr(
         new SchemaConnectorRequestCallback("keyspaces", SELECT_KEYSPACES_20, this));
     if (settings_.use_schema) {
-      callback =
-          callback->chain("tables", SELECT_COLUMN_FAMILIES_20)->chain("columns", SELECT_COLUMNS_20);
+      callback = callback->chain("tables", SELECT_COLUMN_FAMILIES_20 + where)
+                     ->chain("columns", SELECT_COLUMNS_20 + where);
 
       if (server_version_ >= VersionNumber(2, 1, 0)) {
-        callback = callback->chain("user_types", SELECT_USERTYPES_21);
+        callback = callback->chain("user_types", SELECT_USERTYPES_21 + where);
       }
       if (server_version_ >= VersionNumber(2, 2, 0)) {
-        callback = callback->chain("functions", SELECT_FUNCTIONS_22)
-                       ->chain("aggregates", SELECT_AGGREGATES_22);
+        callback = callback->chain("functions", SELECT_FUNCTIONS_22 + where)
+                       ->chain("aggregates", SELECT_AGGREGATES_22 + where);
       }
     }
   }
@@ -397,6 +397,78 @@ const DataType::ConstPtr& SimpleDataTypeCache::by_value_type(uint16_t value_type
   return data_type;
 }
 
+String VectorType::to_string() const {
+  OStringStream ss;
+  ss << "vector<" << element_type_->to_string() << ", " << dimension_ << ">";
+  return ss.str();
+}
+
+static void append_hex(const String& value, internal::OStringStream* ss) {
+  static const char digits[] = "0123456789abcdef";
+  for (String::const_iterator it = value.begin(), end = value.end(); it != end; ++it) {
+    unsigned char c = static_cast<unsigned char>(*it);
+    *ss << digits[c >> 4] << digits[c & 0x0F];
+  }
+}
+
+// Appends the marshal class name of a type including its parameters, e.g.
+// "org.apache.cassandra.db.marshal.ListType(org.apache.cassandra.db.marshal.Int32Type)".
+static void append_class_name(const DataType::ConstPtr& data_type, internal::OStringStream* ss) {
+  if (data_type->is_custom()) {
+    *ss << static_cast<const CustomType*>(data_type.get())->class_name();
+    return;
+  }
+
+  if (data_type->is_frozen()) *ss << "org.apache.cassandra.db.marshal.FrozenType(";
+
+  if (data_type->is_user_type()) {
+    const UserType* user_type = static_cast<const UserType*>(data_type.get());
+    *ss << "org.apache.cassandra.db.marshal.UserType(" << user_type->keyspace() << ",";
+    append_hex(user_type->type_name(), ss);
+    const UserType::FieldVec& fields(user_type->fields());
+    for (UserType::FieldVec::const_iterator it = fields.begin(), end = fields.end(); it != end;
+         ++it) {
+      *ss << ",";
+      append_hex(it->name, ss);
+      *ss << ":";
+      append_class_name(it->type, ss);
+    }
+    *ss << ")";
+  } else if (data_type->value_type() == CASS_VALUE_TYPE_VARCHAR) { // Alias for "text"
+    *ss << "org.apache.cassandra.db.marshal.UTF8Type";
+  } else {
+    switch (data_type->value_type()) {
+#define XX_VALUE_TYPE(name, type, cql, klass) \
+  case name:                                  \
+    *ss << klass;                             \
+    break;
+      CASS_VALUE_TYPE_MAPPING(XX_VALUE_TYPE)
+#undef XX_VALUE_TYPE
+      default:
+        break;
+    }
+    if (data_type->is_collection() || data_type->is_tuple()) {
+      const DataType::Vec& types(static_cast<const CompositeType*>(data_type.get())->types());
+      *ss << "(";
+      for (DataType::Vec::const_iterator it = types.begin(), end = types.end(); it != end; ++it) {
+        if (it != types.begin()) *ss << ",";
+        append_class_name(*it, ss);
+      }
+      *ss << ")";
+    }
+  }
+
+  if (data_type->is_frozen()) *ss << ")";
+}
+
+String VectorType::build_class_name(const DataType::ConstPtr& element_type, size_t dimension) {
+  OStringStream ss;
+  ss << VECTOR_TYPE << "(";
+  append_class_name(element_type, &ss);
+  ss << ", " << dimension << ")";
+  return ss.str();
+}
+
 bool IsValidDataType<const Collection*>::operator()(const Collection* value,
                                                     const DataType::ConstPtr& data_type) const {
   return value->data_type()->equals(data_type);
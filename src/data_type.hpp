@@ -28,6 +28,8 @@
 #include "types.hpp"
 #include "vector.hpp"
 
+#define VECTOR_TYPE "org.apache.cassandra.db.marshal.VectorType"
+
 namespace datastax { namespace internal { namespace core {
 
 class Collection;
@@ -87,6 +89,9 @@ public:
   bool is_user_type() const { return value_type_ == CASS_VALUE_TYPE_UDT; }
   bool is_custom() const { return value_type_ == CASS_VALUE_TYPE_CUSTOM; }
 
+  // Vectors are sent as custom types ("VectorType(<element>, <dimension>)")
+  virtual bool is_vector() const { return false; }
+
   bool is_frozen() const { return is_frozen_; }
 
   virtual bool equals(const DataType::ConstPtr& data_type) const {
@@ -155,6 +160,47 @@ private:
   String class_name_;
 };
 
+class VectorType : public CustomType {
+public:
+  typedef SharedRefPtr<const VectorType> ConstPtr;
+
+  VectorType(const DataType::ConstPtr& element_type, size_t dimension)
+      : CustomType(build_class_name(element_type, dimension))
+      , element_type_(element_type)
+      , dimension_(dimension) {}
+
+  VectorType(const String& class_name, const DataType::ConstPtr& element_type, size_t dimension)
+      : CustomType(class_name)
+      , element_type_(element_type)
+      , dimension_(dimension) {}
+
+  const DataType::ConstPtr& element_type() const { return element_type_; }
+  size_t dimension() const { return dimension_; }
+
+  virtual bool is_vector() const { return true; }
+
+  virtual bool equals(const DataType::ConstPtr& data_type) const {
+    if (!data_type->is_vector()) {
+      return CustomType::equals(data_type);
+    }
+    const ConstPtr& vector_type(data_type);
+    return dimension_ == vector_type->dimension_ &&
+           element_type_->equals(vector_type->element_type_);
+  }
+
+  virtual DataType::Ptr copy() const {
+    return DataType::Ptr(new VectorType(class_name(), element_type_, dimension_));
+  }
+
+  virtual String to_string() const;
+
+  static String build_class_name(const DataType::ConstPtr& element_type, size_t dimension);
+
+private:
+  DataType::ConstPtr element_type_;
+  size_t dimension_;
+};
+
 class CompositeType : public DataType {
 public:
   CompositeType(CassValueType type, bool is_frozen)
@@ -546,6 +592,26 @@ struct IsValidDataType<CassDuration> {
   }
 };
 
+template <>
+struct IsValidDataType<CassFloatVector> {
+  bool operator()(const CassFloatVector& vector, const DataType::ConstPtr& data_type) const {
+    if (!data_type->is_vector()) return false;
+    VectorType::ConstPtr vector_type(data_type);
+    return vector_type->element_type()->value_type() == CASS_VALUE_TYPE_FLOAT &&
+           vector_type->dimension() == vector.count;
+  }
+};
+
+template <>
+struct IsValidDataType<CassDoubleVector> {
+  bool operator()(const CassDoubleVector& vector, const DataType::ConstPtr& data_type) const {
+    if (!data_type->is_vector()) return false;
+    VectorType::ConstPtr vector_type(data_type);
+    return vector_type->element_type()->value_type() == CASS_VALUE_TYPE_DOUBLE &&
+           vector_type->dimension() == vector.count;
+  }
+};
+
 template <>
 struct IsValidDataType<const Collection*> {
   bool operator()(const Collection* value, const DataType::ConstPtr& data_type) const;
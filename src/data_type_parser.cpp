@@ -21,6 +21,9 @@
 #include "string_ref.hpp"
 #include "utils.hpp"
 
+#include <limits>
+#include <stdlib.h>
+
 #define REVERSED_TYPE "org.apache.cassandra.db.marshal.ReversedType"
 #define FROZEN_TYPE "org.apache.cassandra.db.marshal.FrozenType"
 #define COMPOSITE_TYPE "org.apache.cassandra.db.marshal.CompositeType"
@@ -35,6 +38,16 @@
 using namespace datastax;
 using namespace datastax::internal::core;
 
+static bool parse_dimension(const String& str, int* dimension) {
+  char* end = NULL;
+  long value = strtol(str.c_str(), &end, 10);
+  if (str.empty() || *end != '\0' || value <= 0 || value > std::numeric_limits<int32_t>::max()) {
+    return false;
+  }
+  *dimension = static_cast<int>(value);
+  return true;
+}
+
 int hex_value(int c) {
   if (c >= '0' && c <= '9') {
     return c - '0';
@@ -121,6 +134,21 @@ DataType::ConstPtr DataTypeCqlNameParser::parse(const String& type, SimpleDataTy
     return DataType::ConstPtr(new TupleType(types, is_frozen));
   }
 
+  if (iequals(type_name, "vector")) {
+    parser.parse_type_parameters(&params);
+    if (params.size() != 2) {
+      LOG_ERROR("Expecting two parameters for vector %s", type.c_str());
+      return DataType::NIL;
+    }
+    DataType::ConstPtr element_type = parse(params[0], cache, keyspace);
+    int dimension = 0;
+    if (!element_type || !parse_dimension(params[1], &dimension)) {
+      LOG_ERROR("Invalid element type or dimension for vector %s", type.c_str());
+      return DataType::NIL;
+    }
+    return DataType::ConstPtr(new VectorType(element_type, dimension));
+  }
+
   if (iequals(type_name, "frozen")) {
     parser.parse_type_parameters(&params);
     if (params.size() != 1) {
@@ -279,6 +307,10 @@ bool DataTypeClassNameParser::is_tuple_type(const String& type) {
   return starts_with(type, TUPLE_TYPE);
 }
 
+bool DataTypeClassNameParser::is_vector_type(const String& type) {
+  return starts_with(type, VECTOR_TYPE);
+}
+
 DataType::ConstPtr DataTypeClassNameParser::parse_one(const String& type,
                                                       SimpleDataTypeCache& cache) {
   bool is_frozen = DataTypeClassNameParser::is_frozen(type);
@@ -331,6 +363,19 @@ DataType::ConstPtr DataTypeClassNameParser::parse_one(const String& type,
     return CollectionType::map(key_type, value_type, is_frozen);
   }
 
+  if (is_vector_type(next)) {
+    TypeParamsVec params;
+    if (!parser.get_type_params(&params) || params.size() != 2) {
+      return DataType::ConstPtr();
+    }
+    DataType::ConstPtr element_type(parse_one(params[0], cache));
+    int dimension = 0;
+    if (!element_type || !parse_dimension(params[1], &dimension)) {
+      return DataType::ConstPtr();
+    }
+    return DataType::ConstPtr(new VectorType(class_name, element_type, dimension));
+  }
+
   if (is_frozen) {
     LOG_WARN("Got a frozen type for something other than a collection, "
              "this driver might be too old for your version of Cassandra");
@@ -138,6 +138,7 @@ public:
 
   static bool is_user_type(const String& type);
   static bool is_tuple_type(const String& type);
+  static bool is_vector_type(const String& type);
 
   static DataType::ConstPtr parse_one(const String& type, SimpleDataTypeCache& cache);
   static ParseResult::Ptr parse_with_composite(const String& type, SimpleDataTypeCache& cache);
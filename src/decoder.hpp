@@ -226,6 +226,36 @@ public:
     return true;
   }
 
+  inline bool as_float_array(float* output, size_t count) const {
+    CHECK_REMAINING(count * sizeof(int32_t), "float array");
+    internal::decode_float_array(input_, output, count);
+    return true;
+  }
+
+  inline bool as_double_array(double* output, size_t count) const {
+    CHECK_REMAINING(count * sizeof(int64_t), "double array");
+    internal::decode_double_array(input_, output, count);
+    return true;
+  }
+
+  // Decodes a run of size prefixed collection elements that are all exactly
+  // 4 (or 8) bytes wide. Fails, without advancing, if any element isn't.
+  inline bool decode_uint32_elements(void* output, size_t count) {
+    CHECK_REMAINING(count * 2 * sizeof(int32_t), "collection elements");
+    if (!internal::decode_uint32_elements(input_, output, count)) return false;
+    input_ += count * 2 * sizeof(int32_t);
+    remaining_ -= count * 2 * sizeof(int32_t);
+    return true;
+  }
+
+  inline bool decode_uint64_elements(void* output, size_t count) {
+    CHECK_REMAINING(count * (sizeof(int32_t) + sizeof(int64_t)), "collection elements");
+    if (!internal::decode_uint64_elements(input_, output, count)) return false;
+    input_ += count * (sizeof(int32_t) + sizeof(int64_t));
+    remaining_ -= count * (sizeof(int32_t) + sizeof(int64_t));
+    return true;
+  }
+
   inline bool decode_string(const char** output, size_t& size) {
     CHECK_REMAINING(sizeof(uint16_t), "length of string");
 
@@ -0,0 +1,19 @@
+#ifndef DATASTAX_INTERNAL_DRIVER_CONFIG_HPP
+#define DATASTAX_INTERNAL_DRIVER_CONFIG_HPP
+
+/* #undef HAVE_KERBEROS */
+#define HAVE_OPENSSL
+#define HAVE_STD_ATOMIC
+/* #undef HAVE_BOOST_ATOMIC */
+/* #undef HAVE_NOSIGPIPE */
+#define HAVE_SIGTIMEDWAIT
+/* #undef HASH_IN_TR1 */
+#define HAVE_BUILTIN_BSWAP32
+/* #undef HAVE_BUILTIN_BSWAP64 */
+/* #undef HAVE_ARC4RANDOM */
+#define HAVE_GETRANDOM
+#define HAVE_TIMERFD
+#define HAVE_EVENTFD
+#define HAVE_ZLIB
+
+#endif
@@ -133,6 +133,20 @@ inline Buffer encode_with_length(CassDecimal value) {
   return buf;
 }
 
+inline Buffer encode_with_length(CassFloatVector value) {
+  Buffer buf(sizeof(int32_t) + value.count * sizeof(float));
+  size_t pos = buf.encode_int32(0, static_cast<int32_t>(value.count * sizeof(float)));
+  buf.encode_float_array(pos, value.data, value.count);
+  return buf;
+}
+
+inline Buffer encode_with_length(CassDoubleVector value) {
+  Buffer buf(sizeof(int32_t) + value.count * sizeof(double));
+  size_t pos = buf.encode_int32(0, static_cast<int32_t>(value.count * sizeof(double)));
+  buf.encode_double_array(pos, value.data, value.count);
+  return buf;
+}
+
 inline Buffer encode(cass_int8_t value) {
   Buffer buf(sizeof(cass_int8_t));
   buf.encode_int8(0, value);
@@ -218,6 +232,18 @@ inline Buffer encode(CassDecimal value) {
   return buf;
 }
 
+inline Buffer encode(CassFloatVector value) {
+  Buffer buf(value.count * sizeof(float));
+  buf.encode_float_array(0, value.data, value.count);
+  return buf;
+}
+
+inline Buffer encode(CassDoubleVector value) {
+  Buffer buf(value.count * sizeof(double));
+  buf.encode_double_array(0, value.data, value.count);
+  return buf;
+}
+
 Buffer encode(CassDuration value);
 
 Buffer encode_with_length(CassDuration value);
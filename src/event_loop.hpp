@@ -27,6 +27,7 @@
 #include "macros.hpp"
 #include "scoped_lock.hpp"
 #include "scoped_ptr.hpp"
+#include "timing_wheel.hpp"
 #include "utils.hpp"
 
 #include <assert.h>
@@ -101,6 +102,13 @@ public:
    */
   uint64_t io_time_elapsed() const { return io_time_elapsed_; }
 
+  /**
+   * Get the timing wheel used by high-churn timers on this event loop.
+   *
+   * @return The event loop's timing wheel.
+   */
+  TimingWheel* timing_wheel() { return &timing_wheel_; }
+
   /**
    * Determines if we're running on this event loop.
    *
@@ -165,6 +173,7 @@ private:
   Atomic<bool> is_closing_;
 
   Check check_;
+  TimingWheel timing_wheel_;
   uint64_t io_time_start_;
   uint64_t io_time_elapsed_;
 
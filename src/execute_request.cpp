@@ -19,13 +19,62 @@
 #include "constants.hpp"
 #include "protocol.hpp"
 #include "request_callback.hpp"
+#include "serialization.hpp"
 
+using namespace datastax;
+using namespace datastax::internal;
 using namespace datastax::internal::core;
 
 ExecuteRequest::ExecuteRequest(const Prepared* prepared)
     : Statement(prepared)
     , prepared_(prepared) {}
 
+ExecuteRequest::ExecuteRequest(const Prepared* prepared, const Statement* statement)
+    : Statement(prepared)
+    , prepared_(prepared) {
+  set_settings(statement->settings());
+  if (keyspace().empty()) {
+    set_keyspace(prepared->result()->quoted_keyspace());
+  }
+  set_tracing((statement->flags() & CASS_FLAG_TRACING) != 0);
+  set_timestamp(statement->timestamp());
+  set_deadline_ms(statement->deadline_ms());
+  set_record_attempted_addresses(statement->record_attempted_addresses());
+  set_execution_profile_name(statement->execution_profile_name());
+  if (statement->host()) {
+    set_host(*statement->host());
+  }
+  set_page_size(statement->page_size());
+  set_paging_state(statement->paging_state());
+  set_elements(statement->elements());
+}
+
+static void append_int32(int32_t value, String* key) {
+  char buf[sizeof(int32_t)];
+  encode_int32(buf, value);
+  key->append(buf, sizeof(int32_t));
+}
+
+bool ExecuteRequest::get_singleflight_key(CassConsistency consistency,
+                                          CassConsistency serial_consistency, String* key) const {
+  key->clear();
+  append_int32(static_cast<int32_t>(prepared_->id().size()), key);
+  key->append(prepared_->id());
+  append_int32(consistency, key);
+  append_int32(serial_consistency, key);
+  append_int32(page_size(), key);
+  append_int32(static_cast<int32_t>(paging_state().size()), key);
+  key->append(paging_state());
+  for (size_t i = 0; i < elements().size(); ++i) {
+    const Element& element = elements()[i];
+    if (element.is_unset()) return false;
+    // Values are encoded with their length
+    Buffer buffer(element.get_buffer());
+    key->append(buffer.data(), buffer.size());
+  }
+  return true;
+}
+
 int ExecuteRequest::encode(ProtocolVersion version, RequestCallback* callback,
                            BufferVec* bufs) const {
   int32_t length = encode_query_or_id(bufs);
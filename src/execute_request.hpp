@@ -30,6 +30,17 @@ class ExecuteRequest : public Statement {
 public:
   ExecuteRequest(const Prepared* prepared);
 
+  /**
+   * Create a bound statement that's equivalent to a simple statement using the
+   * simple statement's values, settings and options. The simple statement must
+   * bind values by index and have the same number of values as the prepared
+   * statement.
+   *
+   * @param prepared The prepared statement for the simple statement's query.
+   * @param statement The simple statement.
+   */
+  ExecuteRequest(const Prepared* prepared, const Statement* statement);
+
   const Prepared::ConstPtr& prepared() const { return prepared_; }
 
   virtual int encode(ProtocolVersion version, RequestCallback* callback, BufferVec* bufs) const;
@@ -38,6 +49,26 @@ public:
     return calculate_routing_key(prepared_->key_indices(), routing_key);
   }
 
+  /**
+   * Determines if the prepared statement is a read (returns rows).
+   */
+  bool is_read() const {
+    const ResultMetadata::Ptr& result_metadata = prepared_->result()->result_metadata();
+    return result_metadata && result_metadata->column_count() > 0;
+  }
+
+  /**
+   * Get a key that's the same for requests that produce the same results: the
+   * prepared ID and the parts of the EXECUTE body that affect the results.
+   *
+   * @param consistency The request's consistency.
+   * @param serial_consistency The request's serial consistency.
+   * @param key The resulting key.
+   * @return false if a value isn't set.
+   */
+  bool get_singleflight_key(CassConsistency consistency, CassConsistency serial_consistency,
+                            String* key) const;
+
 private:
   virtual size_t get_indices(StringRef name, IndexVec* indices) {
     return prepared_->result()->metadata()->get_indices(name, indices);
@@ -34,6 +34,36 @@ CassError cass_execution_profile_set_request_timeout(CassExecProfile* profile,
   return CASS_OK;
 }
 
+CassError cass_execution_profile_set_priority(CassExecProfile* profile,
+                                              CassRequestPriority priority) {
+  if (priority >= CASS_REQUEST_PRIORITY_LAST_ENTRY && priority != CASS_REQUEST_PRIORITY_UNKNOWN) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  profile->set_priority(priority);
+  return CASS_OK;
+}
+
+CassError cass_execution_profile_set_rate_limit(CassExecProfile* profile,
+                                                cass_double_t requests_per_second,
+                                                cass_uint64_t bytes_per_second,
+                                                cass_bool_t queue_excess_requests) {
+  if (requests_per_second < 0.0 || bytes_per_second > static_cast<cass_uint64_t>(CASS_INT64_MAX)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  RateLimitSettings settings;
+  settings.requests_per_second = requests_per_second;
+  settings.bytes_per_second = bytes_per_second;
+  settings.queue_excess_requests = queue_excess_requests == cass_true;
+  profile->set_rate_limit_settings(settings);
+  return CASS_OK;
+}
+
+CassError cass_execution_profile_set_singleflight_reads(CassExecProfile* profile,
+                                                       cass_bool_t enabled) {
+  profile->set_singleflight_reads(enabled == cass_true);
+  return CASS_OK;
+}
+
 CassError cass_execution_profile_set_consistency(CassExecProfile* profile,
                                                  CassConsistency consistency) {
   profile->set_consistency(consistency);
@@ -105,6 +135,48 @@ CassError cass_execution_profile_set_latency_aware_routing_settings(
   return CASS_OK;
 }
 
+CassError cass_execution_profile_set_peak_ewma_routing(CassExecProfile* profile,
+                                                       cass_bool_t enabled) {
+  profile->set_peak_ewma_routing(enabled == cass_true);
+  return CASS_OK;
+}
+
+CassError cass_execution_profile_set_peak_ewma_routing_settings(CassExecProfile* profile,
+                                                                cass_uint64_t decay_ms,
+                                                                unsigned max_candidates) {
+  if (decay_ms == 0 || decay_ms > PeakEwmaPolicy::MAX_DECAY_MS || max_candidates == 0) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  PeakEwmaPolicy::Settings settings;
+  settings.decay_ns = decay_ms * 1000 * 1000;
+  settings.max_candidates = max_candidates;
+  profile->set_peak_ewma_routing_settings(settings);
+  return CASS_OK;
+}
+
+CassError cass_execution_profile_set_outlier_detection(CassExecProfile* profile,
+                                                      cass_bool_t enabled) {
+  profile->set_outlier_detection(enabled == cass_true);
+  return CASS_OK;
+}
+
+CassError cass_execution_profile_set_outlier_detection_settings(
+    CassExecProfile* profile, cass_double_t failure_rate_threshold, unsigned min_requests,
+    cass_uint64_t interval_ms, cass_uint64_t base_ejection_ms, cass_uint64_t max_ejection_ms) {
+  if (failure_rate_threshold <= 0.0 || failure_rate_threshold > 1.0 || interval_ms == 0 ||
+      base_ejection_ms == 0 || max_ejection_ms < base_ejection_ms) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  OutlierDetectionPolicy::Settings settings;
+  settings.failure_rate_threshold = failure_rate_threshold;
+  settings.min_requests = min_requests;
+  settings.interval_ns = interval_ms * 1000 * 1000;
+  settings.base_ejection_ns = base_ejection_ms * 1000 * 1000;
+  settings.max_ejection_ns = max_ejection_ms * 1000 * 1000;
+  profile->set_outlier_detection_settings(settings);
+  return CASS_OK;
+}
+
 CassError cass_execution_profile_set_whitelist_filtering(CassExecProfile* profile,
                                                          const char* hosts) {
   return cass_execution_profile_set_whitelist_filtering_n(profile, hosts, SAFE_STRLEN(hosts));
@@ -182,6 +254,18 @@ CassError cass_execution_profile_set_constant_speculative_execution_policy(
   return CASS_OK;
 }
 
+CassError cass_execution_profile_set_percentile_speculative_execution_policy(
+    CassExecProfile* profile, cass_double_t percentile, int max_speculative_executions,
+    cass_double_t max_speculative_ratio) {
+  if (percentile <= 0.0 || percentile > 100.0 || max_speculative_executions < 0 ||
+      max_speculative_ratio < 0.0 || max_speculative_ratio > 1.0) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  profile->set_speculative_execution_policy(new PercentileSpeculativeExecutionPolicy(
+      percentile, max_speculative_executions, max_speculative_ratio));
+  return CASS_OK;
+}
+
 CassError cass_execution_profile_set_no_speculative_execution_policy(CassExecProfile* profile) {
   profile->set_speculative_execution_policy(new NoSpeculativeExecutionPolicy());
   return CASS_OK;
@@ -25,6 +25,9 @@
 #include "dc_aware_policy.hpp"
 #include "dense_hash_map.hpp"
 #include "latency_aware_policy.hpp"
+#include "outlier_detection_policy.hpp"
+#include "peak_ewma_policy.hpp"
+#include "rate_limiter.hpp"
 #include "speculative_execution.hpp"
 #include "string.hpp"
 #include "token_aware_policy.hpp"
@@ -42,9 +45,13 @@ public:
       : request_timeout_ms_(CASS_UINT64_MAX)
       , consistency_(CASS_CONSISTENCY_UNKNOWN)
       , serial_consistency_(CASS_CONSISTENCY_UNKNOWN)
+      , priority_(CASS_REQUEST_PRIORITY_UNKNOWN)
       , latency_aware_routing_(false)
+      , peak_ewma_routing_(false)
+      , outlier_detection_(false)
       , token_aware_routing_(true)
-      , token_aware_routing_shuffle_replicas_(true) {}
+      , token_aware_routing_shuffle_replicas_(true)
+      , singleflight_reads_(false) {}
 
   uint64_t request_timeout_ms() const { return request_timeout_ms_; }
 
@@ -60,6 +67,10 @@ public:
     serial_consistency_ = serial_consistency;
   }
 
+  CassRequestPriority priority() const { return priority_; }
+
+  void set_priority(CassRequestPriority priority) { priority_ = priority; }
+
   ContactPointList& blacklist() { return blacklist_; }
   const ContactPointList& blacklist() const { return blacklist_; }
 
@@ -80,6 +91,30 @@ public:
     return latency_aware_routing_settings_;
   }
 
+  bool peak_ewma_routing() const { return peak_ewma_routing_; }
+
+  void set_peak_ewma_routing(bool is_peak_ewma) { peak_ewma_routing_ = is_peak_ewma; }
+
+  void set_peak_ewma_routing_settings(const PeakEwmaPolicy::Settings& settings) {
+    peak_ewma_routing_settings_ = settings;
+  }
+
+  const PeakEwmaPolicy::Settings& peak_ewma_routing_settings() const {
+    return peak_ewma_routing_settings_;
+  }
+
+  bool outlier_detection() const { return outlier_detection_; }
+
+  void set_outlier_detection(bool is_enabled) { outlier_detection_ = is_enabled; }
+
+  void set_outlier_detection_settings(const OutlierDetectionPolicy::Settings& settings) {
+    outlier_detection_settings_ = settings;
+  }
+
+  const OutlierDetectionPolicy::Settings& outlier_detection_settings() const {
+    return outlier_detection_settings_;
+  }
+
   bool token_aware_routing() const { return token_aware_routing_; }
 
   void set_token_aware_routing(bool is_token_aware) { token_aware_routing_ = is_token_aware; }
@@ -118,7 +153,7 @@ public:
 
   void build_load_balancing_policy() {
     // The base LBP can be augmented by special wrappers (whitelist,
-    // token aware, latency aware)
+    // token aware, peak EWMA, latency aware, outlier detection)
     if (base_load_balancing_policy_) {
       LoadBalancingPolicy* chain = base_load_balancing_policy_->new_instance();
 
@@ -137,14 +172,52 @@ public:
       if (token_aware_routing()) {
         chain = new TokenAwarePolicy(chain, token_aware_routing_shuffle_replicas_);
       }
+      if (peak_ewma_routing()) {
+        chain = new PeakEwmaPolicy(chain, peak_ewma_routing_settings_);
+      }
       if (latency_aware()) {
         chain = new LatencyAwarePolicy(chain, latency_aware_routing_settings_);
       }
+      if (outlier_detection()) {
+        chain = new OutlierDetectionPolicy(chain, outlier_detection_settings_);
+      }
 
       load_balancing_policy_.reset(chain);
     }
   }
 
+  bool singleflight_reads() const { return singleflight_reads_; }
+
+  void set_singleflight_reads(bool singleflight_reads) { singleflight_reads_ = singleflight_reads; }
+
+  const RateLimitSettings& rate_limit_settings() const { return rate_limit_settings_; }
+
+  void set_rate_limit_settings(const RateLimitSettings& settings) {
+    rate_limit_settings_ = settings;
+  }
+
+  /**
+   * Create the rate limit budget shared by all the copies of the profile
+   * (one per I/O thread). This is done once per session.
+   */
+  void build_rate_limit_budget() {
+    if (rate_limit_settings_.is_enabled()) {
+      rate_limit_budget_.reset(new RateLimitBudget(rate_limit_settings_));
+    }
+  }
+
+  const RateLimiter::Ptr& rate_limiter() const { return rate_limiter_; }
+
+  /**
+   * Create this copy's rate limiter from the shared rate limit budget. This
+   * is done by each I/O thread.
+   */
+  void build_rate_limiter() {
+    if (rate_limit_budget_) {
+      rate_limiter_.reset(new RateLimiter(rate_limit_budget_));
+    }
+  }
+
   const RetryPolicy::Ptr& retry_policy() const { return retry_policy_; }
 
   void set_retry_policy(RetryPolicy* retry_policy) { retry_policy_.reset(retry_policy); }
@@ -162,16 +235,25 @@ private:
   cass_uint64_t request_timeout_ms_;
   CassConsistency consistency_;
   CassConsistency serial_consistency_;
+  CassRequestPriority priority_;
   ContactPointList blacklist_;
   DcList blacklist_dc_;
   bool latency_aware_routing_;
   LatencyAwarePolicy::Settings latency_aware_routing_settings_;
+  bool peak_ewma_routing_;
+  PeakEwmaPolicy::Settings peak_ewma_routing_settings_;
+  bool outlier_detection_;
+  OutlierDetectionPolicy::Settings outlier_detection_settings_;
   bool token_aware_routing_;
   bool token_aware_routing_shuffle_replicas_;
+  bool singleflight_reads_;
   ContactPointList whitelist_;
   DcList whitelist_dc_;
   LoadBalancingPolicy::Ptr load_balancing_policy_;
   LoadBalancingPolicy::Ptr base_load_balancing_policy_;
+  RateLimitSettings rate_limit_settings_;
+  RateLimitBudget::Ptr rate_limit_budget_;
+  RateLimiter::Ptr rate_limiter_;
   RetryPolicy::Ptr retry_policy_;
   SpeculativeExecutionPolicy::Ptr speculative_execution_policy_;
 };
@@ -56,13 +56,13 @@ const CassResult* cass_future_get_result(CassFuture* future) {
     return NULL;
   }
 
-  Response::Ptr response(static_cast<ResponseFuture*>(future->from())->response());
+  Response::ConstPtr response(static_cast<ResponseFuture*>(future->from())->response());
   if (!response || response->opcode() == CQL_OPCODE_ERROR) {
     return NULL;
   }
 
   response->inc_ref();
-  return CassResult::to(static_cast<ResultResponse*>(response.get()));
+  return CassResult::to(static_cast<const ResultResponse*>(response.get()));
 }
 
 const CassPrepared* cass_future_get_prepared(CassFuture* future) {
@@ -71,7 +71,7 @@ const CassPrepared* cass_future_get_prepared(CassFuture* future) {
   }
   ResponseFuture* response_future = static_cast<ResponseFuture*>(future->from());
 
-  SharedRefPtr<ResultResponse> result(response_future->response());
+  ResultResponse::ConstPtr result(response_future->response());
   if (!result || result->kind() != CASS_RESULT_KIND_PREPARED) {
     return NULL;
   }
@@ -87,13 +87,13 @@ const CassErrorResult* cass_future_get_error_result(CassFuture* future) {
     return NULL;
   }
 
-  Response::Ptr response(static_cast<ResponseFuture*>(future->from())->response());
+  Response::ConstPtr response(static_cast<ResponseFuture*>(future->from())->response());
   if (!response || response->opcode() != CQL_OPCODE_ERROR) {
     return NULL;
   }
 
   response->inc_ref();
-  return CassErrorResult::to(static_cast<ErrorResponse*>(response.get()));
+  return CassErrorResult::to(static_cast<const ErrorResponse*>(response.get()));
 }
 
 CassError cass_future_error_code(CassFuture* future) {
@@ -122,7 +122,7 @@ CassError cass_future_tracing_id(CassFuture* future, CassUuid* tracing_id) {
     return CASS_ERROR_LIB_INVALID_FUTURE_TYPE;
   }
 
-  Response::Ptr response(static_cast<ResponseFuture*>(future->from())->response());
+  Response::ConstPtr response(static_cast<ResponseFuture*>(future->from())->response());
   if (!response || !response->has_tracing_id()) {
     return CASS_ERROR_LIB_NO_TRACING_ID;
   }
@@ -136,7 +136,7 @@ size_t cass_future_custom_payload_item_count(CassFuture* future) {
   if (future->type() != Future::FUTURE_TYPE_RESPONSE) {
     return 0;
   }
-  Response::Ptr response(static_cast<ResponseFuture*>(future->from())->response());
+  Response::ConstPtr response(static_cast<ResponseFuture*>(future->from())->response());
   if (!response) return 0;
   return response->custom_payload().size();
 }
@@ -147,7 +147,7 @@ CassError cass_future_custom_payload_item(CassFuture* future, size_t index, cons
   if (future->type() != Future::FUTURE_TYPE_RESPONSE) {
     return CASS_ERROR_LIB_INVALID_FUTURE_TYPE;
   }
-  Response::Ptr response(static_cast<ResponseFuture*>(future->from())->response());
+  Response::ConstPtr response(static_cast<ResponseFuture*>(future->from())->response());
   if (!response) return CASS_ERROR_LIB_NO_CUSTOM_PAYLOAD;
 
   const CustomPayloadVec& custom_payload = response->custom_payload();
@@ -197,7 +197,19 @@ void Future::internal_set(ScopedMutex& lock) {
     callback(CassFuture::to(this), data);
     lock.lock();
   }
+  if (completion_queue_) {
+    // The completion queue's reference to the future is handed to the
+    // application when the future is drained.
+    CompletionQueue::Ptr completion_queue(completion_queue_);
+    completion_queue_.reset();
+    inc_ref();
+    lock.unlock();
+    completion_queue->push(this);
+    lock.lock();
+  }
   // Broadcast after we've run the callback so that threads waiting
   // on this future see the side effects of the callback.
-  uv_cond_broadcast(&cond_);
+  if (has_cond_) {
+    uv_cond_broadcast(&cond_);
+  }
 }
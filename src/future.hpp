@@ -19,9 +19,11 @@
 
 #include "atomic.hpp"
 #include "cassandra.h"
+#include "completion_queue.hpp"
 #include "external.hpp"
 #include "host.hpp"
 #include "macros.hpp"
+#include "mpsc_queue.hpp"
 #include "ref_counted.hpp"
 #include "scoped_lock.hpp"
 #include "scoped_ptr.hpp"
@@ -34,7 +36,9 @@ namespace datastax { namespace internal { namespace core {
 
 struct Error;
 
-class Future : public RefCounted<Future> {
+class Future
+    : public RefCounted<Future>
+    , public MPSCQueueNode {
 public:
   typedef SharedRefPtr<Future> Ptr;
   typedef void (*Callback)(CassFuture*, void*);
@@ -52,15 +56,18 @@ public:
 
   Future(Type type)
       : is_set_(false)
+      , has_cond_(false)
       , type_(type)
-      , callback_(NULL) {
+      , callback_(NULL)
+      , completion_tag_(NULL) {
     uv_mutex_init(&mutex_);
-    uv_cond_init(&cond_);
   }
 
   virtual ~Future() {
     uv_mutex_destroy(&mutex_);
-    uv_cond_destroy(&cond_);
+    if (has_cond_) {
+      uv_cond_destroy(&cond_);
+    }
   }
 
   Type type() const { return type_; }
@@ -102,10 +109,22 @@ public:
 
   bool set_callback(Callback callback, void* data);
 
+  // The future is posted to the completion queue, with the tag, once it's
+  // set. This must be done before the future can be set.
+  void set_completion_queue(const CompletionQueue::Ptr& completion_queue, void* tag) {
+    completion_queue_ = completion_queue;
+    completion_tag_ = tag;
+  }
+
+  void* completion_tag() const { return completion_tag_; }
+
 protected:
   bool is_set() const { return is_set_; }
 
   void internal_wait(ScopedMutex& lock) {
+    if (!is_set_) {
+      init_cond();
+    }
     while (!is_set_) {
       uv_cond_wait(&cond_, lock.get());
     }
@@ -113,6 +132,7 @@ protected:
 
   bool internal_wait_for(ScopedMutex& lock, uint64_t timeout_us) {
     if (!is_set_) {
+      init_cond();
       if (uv_cond_timedwait(&cond_, lock.get(), timeout_us * 1000) != 0) { // Expects nanos
         return false;
       }
@@ -129,13 +149,27 @@ protected:
 
   uv_mutex_t mutex_;
 
+private:
+  // The condition variable is only needed if a thread waits on the future.
+  // Futures that complete through a callback or a completion queue skip its
+  // setup and teardown.
+  void init_cond() {
+    if (!has_cond_) {
+      uv_cond_init(&cond_);
+      has_cond_ = true;
+    }
+  }
+
 private:
   bool is_set_;
+  bool has_cond_;
   uv_cond_t cond_;
   Type type_;
   ScopedPtr<Error> error_;
   Callback callback_;
   void* data_;
+  CompletionQueue::Ptr completion_queue_;
+  void* completion_tag_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(Future);
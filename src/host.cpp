@@ -20,6 +20,8 @@
 #include "row.hpp"
 #include "value.hpp"
 
+#include <math.h>
+
 using namespace datastax;
 using namespace datastax::internal::core;
 
@@ -55,6 +57,43 @@ bool remove_host(CopyOnWriteHostVec& hosts, const Address& address) {
 
 }}} // namespace datastax::internal::core
 
+void Host::update_peak_ewma(uint64_t latency_ns) {
+  uint64_t decay_ns = peak_ewma_decay_ns_.load(MEMORY_ORDER_RELAXED);
+  if (decay_ns == 0) return;
+
+  uint64_t now = uv_hrtime();
+  uint64_t previous = peak_ewma_timestamp_.exchange(now, MEMORY_ORDER_RELAXED);
+
+  // The first latency is used as is. Concurrent updates with the same (or an
+  // older) timestamp only raise the peak.
+  double weight = 0.0;
+  if (previous != 0) {
+    weight = now > previous ? exp(-static_cast<double>(now - previous) / decay_ns) : 1.0;
+  }
+
+  int64_t latency = static_cast<int64_t>(latency_ns);
+  int64_t current = peak_ewma_ns_.load(MEMORY_ORDER_RELAXED);
+  int64_t next;
+  do {
+    if (latency > current) {
+      next = latency;
+    } else {
+      next = static_cast<int64_t>(weight * current + (1.0 - weight) * latency);
+    }
+  } while (!peak_ewma_ns_.compare_exchange_weak(current, next, MEMORY_ORDER_RELAXED));
+}
+
+int64_t Host::peak_ewma() const {
+  int64_t current = peak_ewma_ns_.load(MEMORY_ORDER_RELAXED);
+  if (current <= 0) return 0;
+
+  uint64_t decay_ns = peak_ewma_decay_ns_.load(MEMORY_ORDER_RELAXED);
+  uint64_t timestamp = peak_ewma_timestamp_.load(MEMORY_ORDER_RELAXED);
+  uint64_t now = uv_hrtime();
+  if (decay_ns == 0 || now <= timestamp) return current;
+  return static_cast<int64_t>(current * exp(-static_cast<double>(now - timestamp) / decay_ns));
+}
+
 void Host::LatencyTracker::update(uint64_t latency_ns) {
   uint64_t now = uv_hrtime();
 
@@ -82,6 +121,70 @@ void Host::LatencyTracker::update(uint64_t latency_ns) {
   current_.timestamp = now;
 }
 
+uint64_t Host::OutlierTracker::record(bool is_failure) {
+  uint64_t now = uv_hrtime();
+
+  ScopedSpinlock l(SpinlockPool<OutlierTracker>::get_spinlock(this));
+
+  if (is_failure) {
+    failures_++;
+  } else {
+    successes_++;
+  }
+
+  if (interval_end_ns_ == 0) {
+    interval_end_ns_ = now + settings_.interval_ns;
+    return 0;
+  }
+
+  if (now < interval_end_ns_) {
+    return 0;
+  }
+
+  uint64_t ejection_ns = 0;
+  uint64_t total = successes_ + failures_;
+  if (now >= ejected_until_ns_ && total >= settings_.min_requests &&
+      failures_ >= settings_.failure_rate_threshold * total) {
+    // Each consecutive ejection doubles the ejection time
+    unsigned shift = ejections_ < 16 ? ejections_ : 16;
+    ejection_ns = settings_.base_ejection_ns << shift;
+    if (ejection_ns > settings_.max_ejection_ns) {
+      ejection_ns = settings_.max_ejection_ns;
+    }
+    ejected_until_ns_ = now + ejection_ns;
+    recovery_end_ns_ = ejected_until_ns_ + settings_.base_ejection_ns;
+    ejections_++;
+  } else if (ejections_ > 0 && now >= recovery_end_ns_) {
+    // A healthy interval after recovering reduces the next ejection time
+    ejections_--;
+  }
+
+  successes_ = 0;
+  failures_ = 0;
+  interval_end_ns_ = now + settings_.interval_ns;
+
+  return ejection_ns;
+}
+
+bool Host::OutlierTracker::is_ejected() {
+  uint64_t now = uv_hrtime();
+
+  ScopedSpinlock l(SpinlockPool<OutlierTracker>::get_spinlock(this));
+
+  if (now < ejected_until_ns_) {
+    return true;
+  }
+
+  if (now < recovery_end_ns_) {
+    // The percentage of requests that are allowed to use the host increases
+    // linearly over the recovery period.
+    uint64_t allowed = ((now - ejected_until_ns_) * 100) / (recovery_end_ns_ - ejected_until_ns_);
+    return (probes_++ % 100) > allowed;
+  }
+
+  return false;
+}
+
 bool VersionNumber::parse(const String& version) {
   return sscanf(version.c_str(), "%d.%d.%d", &major_version_, &minor_version_, &patch_version_) >=
          2;
@@ -20,6 +20,7 @@
 #include "address.hpp"
 #include "allocated.hpp"
 #include "atomic.hpp"
+#include "concurrency_limiter.hpp"
 #include "copy_on_write_ptr.hpp"
 #include "get_time.hpp"
 #include "logger.hpp"
@@ -28,6 +29,7 @@
 #include "ref_counted.hpp"
 #include "scoped_ptr.hpp"
 #include "spin_lock.hpp"
+#include "token_bucket.hpp"
 #include "vector.hpp"
 
 #include <math.h>
@@ -48,6 +50,21 @@ struct TimestampedAverage {
   uint64_t num_measured;
 };
 
+struct OutlierDetectionSettings {
+  OutlierDetectionSettings()
+      : failure_rate_threshold(0.5)
+      , min_requests(20)
+      , interval_ns(1000LL * 1000LL * 1000LL)
+      , base_ejection_ns(10LL * 1000LL * 1000LL * 1000LL)
+      , max_ejection_ns(300LL * 1000LL * 1000LL * 1000LL) {}
+
+  double failure_rate_threshold;
+  uint64_t min_requests;
+  uint64_t interval_ns;
+  uint64_t base_ejection_ns;
+  uint64_t max_ejection_ns;
+};
+
 class VersionNumber {
 public:
   VersionNumber()
@@ -101,7 +118,17 @@ public:
       , dc_id_(0)
       , address_string_(address.to_string())
       , connection_count_(0)
-      , inflight_request_count_(0) {}
+      , inflight_request_count_(0)
+      , peak_ewma_decay_ns_(0)
+      , peak_ewma_ns_(0)
+      , peak_ewma_timestamp_(0)
+      , outlier_tracker_(NULL)
+      , concurrency_limiter_(NULL) {}
+
+  ~Host() {
+    delete outlier_tracker_.load();
+    delete concurrency_limiter_.load();
+  }
 
   const Address& address() const { return address_; }
   const String& address_string() const { return address_string_; }
@@ -161,15 +188,153 @@ public:
     return TimestampedAverage();
   }
 
+  /**
+   * Enable the host's peak EWMA. The first decay is kept when it's enabled
+   * more than once.
+   *
+   * @param decay_ns The decay of the moving average in nanoseconds.
+   * @return The decay used by the host.
+   */
+  uint64_t enable_peak_ewma(uint64_t decay_ns) {
+    uint64_t expected = 0;
+    if (peak_ewma_decay_ns_.compare_exchange_strong(expected, decay_ns, MEMORY_ORDER_RELAXED)) {
+      return decay_ns;
+    }
+    return expected;
+  }
+
+  /**
+   * Record a response latency in the host's peak EWMA (exponentially weighted
+   * moving average). Latencies above the current value replace it immediately
+   * (peak), lower latencies are averaged in based on the time since the last
+   * update. This is lock-free and a no-op unless `enable_peak_ewma()` was
+   * called.
+   *
+   * @param latency_ns The response latency in nanoseconds.
+   */
+  void update_peak_ewma(uint64_t latency_ns);
+
+  /**
+   * The current peak EWMA latency decayed by the time since it was last
+   * updated, so that a host that stopped receiving requests is eventually
+   * tried again.
+   *
+   * @return The latency in nanoseconds or 0 if none has been recorded.
+   */
+  int64_t peak_ewma() const;
+
+  /**
+   * Enable outlier detection for the host. This can be called concurrently
+   * from several threads; the first tracker installed is kept.
+   *
+   * @param settings The outlier detection settings.
+   */
+  void enable_outlier_detection(const OutlierDetectionSettings& settings) {
+    if (outlier_tracker_.load(MEMORY_ORDER_ACQUIRE) != NULL) return;
+    OutlierTracker* tracker = new OutlierTracker(settings);
+    OutlierTracker* expected = NULL;
+    if (!outlier_tracker_.compare_exchange_strong(expected, tracker)) {
+      delete tracker;
+    }
+  }
+
+  /**
+   * Record the result of a request for outlier detection. Hosts with a failure
+   * rate over the configured threshold for an interval are ejected for an
+   * exponentially increasing amount of time.
+   *
+   * @param is_failure true if the request failed because of the host (e.g.
+   * a timeout, a connection error or an overloaded error).
+   */
+  void record_request_result(bool is_failure) {
+    OutlierTracker* tracker = outlier_tracker_.load(MEMORY_ORDER_ACQUIRE);
+    if (tracker) {
+      uint64_t ejection_ns = tracker->record(is_failure);
+      if (ejection_ns > 0) {
+        LOG_WARN("Host %s ejected for %f ms because of its failure rate",
+                 to_string().c_str(), static_cast<double>(ejection_ns) / 1e6);
+      }
+    }
+  }
+
+  /**
+   * Determines if the host should be skipped by a query plan because it was
+   * ejected by outlier detection. After an ejection ends an increasing portion
+   * of requests are allowed to probe the host.
+   *
+   * @return true if the host should be avoided.
+   */
+  bool is_ejected() {
+    OutlierTracker* tracker = outlier_tracker_.load(MEMORY_ORDER_ACQUIRE);
+    if (tracker) {
+      return tracker->is_ejected();
+    }
+    return false;
+  }
+
+  TokenBucket& retry_budget() { return retry_budget_; }
+
+  /**
+   * Enable the adaptive concurrency limiter for the host. This can be called
+   * concurrently from several threads; the first limiter installed is kept.
+   *
+   * @param settings The concurrency limiter settings.
+   * @param tracker The tracker notified when the host becomes (un)saturated.
+   */
+  void enable_concurrency_limiter(const ConcurrencyLimiterSettings& settings,
+                                  const SaturatedHostTracker::Ptr& tracker) {
+    if (concurrency_limiter_.load(MEMORY_ORDER_ACQUIRE) != NULL) return;
+    ConcurrencyLimiter* limiter = new ConcurrencyLimiter(settings, tracker);
+    ConcurrencyLimiter* expected = NULL;
+    if (!concurrency_limiter_.compare_exchange_strong(expected, limiter)) {
+      delete limiter;
+    }
+  }
+
+  void update_concurrency_limit(uint64_t latency_ns, bool is_dropped) {
+    ConcurrencyLimiter* limiter = concurrency_limiter_.load(MEMORY_ORDER_ACQUIRE);
+    if (limiter) {
+      limiter->update(latency_ns, inflight_request_count(), is_dropped);
+      limiter->update_saturation(inflight_request_count_);
+    }
+  }
+
+  /**
+   * The adaptive limit on the number of in-flight requests to the host.
+   *
+   * @return The limit or -1 if the concurrency limiter isn't enabled.
+   */
+  int32_t concurrency_limit() const {
+    ConcurrencyLimiter* limiter = concurrency_limiter_.load(MEMORY_ORDER_ACQUIRE);
+    return limiter ? limiter->limit() : -1;
+  }
+
+  bool is_at_concurrency_limit() const {
+    ConcurrencyLimiter* limiter = concurrency_limiter_.load(MEMORY_ORDER_ACQUIRE);
+    return limiter && inflight_request_count() >= limiter->limit();
+  }
+
   void increment_connection_count() { connection_count_.fetch_add(1, MEMORY_ORDER_RELAXED); }
 
   void decrement_connection_count() { connection_count_.fetch_sub(1, MEMORY_ORDER_RELAXED); }
 
   int32_t connection_count() const { return connection_count_.load(MEMORY_ORDER_RELAXED); }
 
-  void increment_inflight_requests() { inflight_request_count_.fetch_add(1, MEMORY_ORDER_RELAXED); }
+  void increment_inflight_requests() {
+    inflight_request_count_.fetch_add(1, MEMORY_ORDER_RELAXED);
+    ConcurrencyLimiter* limiter = concurrency_limiter_.load(MEMORY_ORDER_ACQUIRE);
+    if (limiter) {
+      limiter->update_saturation(inflight_request_count_);
+    }
+  }
 
-  void decrement_inflight_requests() { inflight_request_count_.fetch_sub(1, MEMORY_ORDER_RELAXED); }
+  void decrement_inflight_requests() {
+    inflight_request_count_.fetch_sub(1, MEMORY_ORDER_RELAXED);
+    ConcurrencyLimiter* limiter = concurrency_limiter_.load(MEMORY_ORDER_ACQUIRE);
+    if (limiter) {
+      limiter->update_saturation(inflight_request_count_);
+    }
+  }
 
   int32_t inflight_request_count() const {
     return inflight_request_count_.load(MEMORY_ORDER_RELAXED);
@@ -198,6 +363,36 @@ private:
     DISALLOW_COPY_AND_ASSIGN(LatencyTracker);
   };
 
+  class OutlierTracker : public Allocated {
+  public:
+    OutlierTracker(const OutlierDetectionSettings& settings)
+        : settings_(settings)
+        , interval_end_ns_(0)
+        , successes_(0)
+        , failures_(0)
+        , ejections_(0)
+        , ejected_until_ns_(0)
+        , recovery_end_ns_(0)
+        , probes_(0) {}
+
+    // Returns the ejection time if the host was ejected, otherwise 0
+    uint64_t record(bool is_failure);
+    bool is_ejected();
+
+  private:
+    OutlierDetectionSettings settings_;
+    uint64_t interval_end_ns_;
+    uint64_t successes_;
+    uint64_t failures_;
+    unsigned ejections_;
+    uint64_t ejected_until_ns_;
+    uint64_t recovery_end_ns_;
+    uint64_t probes_;
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(OutlierTracker);
+  };
+
 private:
   Address address_;
   Address rpc_address_;
@@ -212,8 +407,14 @@ private:
   Vector<String> tokens_;
   Atomic<int32_t> connection_count_;
   Atomic<int32_t> inflight_request_count_;
+  Atomic<uint64_t> peak_ewma_decay_ns_;
+  Atomic<int64_t> peak_ewma_ns_;
+  Atomic<uint64_t> peak_ewma_timestamp_;
+  TokenBucket retry_budget_;
 
   ScopedPtr<LatencyTracker> latency_tracker_;
+  Atomic<OutlierTracker*> outlier_tracker_;
+  Atomic<ConcurrencyLimiter*> concurrency_limiter_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(Host);
@@ -112,6 +112,23 @@ const CassValue* cass_iterator_get_value(const CassIterator* iterator) {
   return CassValue::to(static_cast<const ValueIterator*>(iterator->from())->value());
 }
 
+#define CASS_ITERATOR_NEXT_ARRAY(Name, Type)                                             \
+  CassError cass_iterator_next_##Name##_array(CassIterator* iterator, Type* output,      \
+                                              size_t output_count, size_t* count_read) { \
+    if (iterator->type() != CASS_ITERATOR_TYPE_COLLECTION) {                             \
+      return CASS_ERROR_LIB_BAD_PARAMS;                                                  \
+    }                                                                                    \
+    return static_cast<CollectionIterator*>(iterator->from())                            \
+        ->next_##Name##_array(output, output_count, count_read);                         \
+  }
+
+CASS_ITERATOR_NEXT_ARRAY(int32, cass_int32_t)
+CASS_ITERATOR_NEXT_ARRAY(int64, cass_int64_t)
+CASS_ITERATOR_NEXT_ARRAY(float, cass_float_t)
+CASS_ITERATOR_NEXT_ARRAY(double, cass_double_t)
+
+#undef CASS_ITERATOR_NEXT_ARRAY
+
 const CassValue* cass_iterator_get_map_key(const CassIterator* iterator) {
   if (iterator->type() != CASS_ITERATOR_TYPE_MAP) {
     return NULL;
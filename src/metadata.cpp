@@ -719,7 +719,7 @@ const T& as_const(const T& x) {
 const KeyspaceMetadata* Metadata::SchemaSnapshot::get_keyspace(const String& name) const {
   KeyspaceMetadata::Map::const_iterator i = keyspaces_->find(name);
   if (i == keyspaces_->end()) return NULL;
-  return &i->second;
+  return i->second.get();
 }
 
 const UserType* Metadata::SchemaSnapshot::get_user_type(const String& keyspace_name,
@@ -728,7 +728,7 @@ const UserType* Metadata::SchemaSnapshot::get_user_type(const String& keyspace_n
   if (i == keyspaces_->end()) {
     return NULL;
   }
-  return i->second.get_user_type(type_name);
+  return i->second->get_user_type(type_name);
 }
 
 String Metadata::full_function_name(const String& name, const StringVec& signature) {
@@ -757,7 +757,9 @@ void Metadata::update_keyspaces(const ResultResponse* result, bool is_virtual) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_keyspaces(server_version_, result, is_virtual);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_keyspaces(server_version_, result, is_virtual);
   }
@@ -768,7 +770,9 @@ void Metadata::update_tables(const ResultResponse* result) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_tables(server_version_, result);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_tables(server_version_, result);
   }
@@ -779,7 +783,9 @@ void Metadata::update_views(const ResultResponse* result) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_views(server_version_, result);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_views(server_version_, result);
   }
@@ -790,10 +796,12 @@ void Metadata::update_columns(const ResultResponse* result) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_columns(server_version_, cache_, result);
     if (server_version_ < VersionNumber(3, 0, 0)) {
       updating_->update_legacy_indexes(server_version_, result);
     }
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_columns(server_version_, cache_, result);
     if (server_version_ < VersionNumber(3, 0, 0)) {
@@ -807,7 +815,9 @@ void Metadata::update_indexes(const ResultResponse* result) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_indexes(server_version_, result);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_indexes(server_version_, result);
   }
@@ -818,7 +828,9 @@ void Metadata::update_user_types(const ResultResponse* result) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_user_types(server_version_, cache_, result);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_user_types(server_version_, cache_, result);
   }
@@ -829,7 +841,9 @@ void Metadata::update_functions(const ResultResponse* result) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_functions(server_version_, cache_, result);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_functions(server_version_, cache_, result);
   }
@@ -840,7 +854,9 @@ void Metadata::update_aggregates(const ResultResponse* result) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->update_aggregates(server_version_, cache_, result);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->update_aggregates(server_version_, cache_, result);
   }
@@ -851,7 +867,9 @@ void Metadata::drop_keyspace(const String& keyspace_name) {
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->drop_keyspace(keyspace_name);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->drop_keyspace(keyspace_name);
   }
@@ -862,7 +880,9 @@ void Metadata::drop_table_or_view(const String& keyspace_name, const String& tab
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->drop_table_or_view(keyspace_name, table_or_view_name);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->drop_table_or_view(keyspace_name, table_or_view_name);
   }
@@ -873,7 +893,9 @@ void Metadata::drop_user_type(const String& keyspace_name, const String& type_na
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->drop_user_type(keyspace_name, type_name);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->drop_user_type(keyspace_name, type_name);
   }
@@ -884,7 +906,9 @@ void Metadata::drop_function(const String& keyspace_name, const String& full_fun
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->drop_function(keyspace_name, full_function_name);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->drop_function(keyspace_name, full_function_name);
   }
@@ -895,7 +919,9 @@ void Metadata::drop_aggregate(const String& keyspace_name, const String& full_ag
 
   if (is_front_buffer()) {
     ScopedMutex l(&mutex_);
+    const KeyspaceMetadata::MapPtr previous(front_.keyspaces());
     updating_->drop_aggregate(keyspace_name, full_aggregate_name);
+    front_.diff(*previous, &schema_changes_);
   } else {
     updating_->drop_aggregate(keyspace_name, full_aggregate_name);
   }
@@ -911,6 +937,9 @@ void Metadata::clear_and_update_back(const VersionNumber& server_version) {
 }
 
 void Metadata::swap_to_back_and_update_front() {
+  // The back buffer isn't visible to snapshots so it can be diffed (and share
+  // the unchanged parts of the front buffer) without holding the lock.
+  back_.diff(*front_.keyspaces(), &schema_changes_);
   {
     ScopedMutex l(&mutex_);
     schema_snapshot_version_++;
@@ -926,13 +955,36 @@ void Metadata::clear() {
     schema_snapshot_version_ = 0;
     front_.clear();
   }
+  schema_changes_.clear();
   back_.clear();
 }
 
+namespace {
+
+struct FieldNameLess {
+  bool operator()(const MetadataField& field, const String& name) const {
+    return field.name() < name;
+  }
+};
+
+} // namespace
+
 const Value* MetadataBase::get_field(const String& name) const {
-  MetadataField::Map::const_iterator it = fields_.find(name);
-  if (it == fields_.end()) return NULL;
-  return it->second.value();
+  MetadataField::Vec::const_iterator it =
+      std::lower_bound(fields_.begin(), fields_.end(), name, FieldNameLess());
+  if (it == fields_.end() || it->name() != name) return NULL;
+  return it->value();
+}
+
+const Value* MetadataBase::set_field(const MetadataField& field) {
+  MetadataField::Vec::iterator it =
+      std::lower_bound(fields_.begin(), fields_.end(), field.name(), FieldNameLess());
+  if (it != fields_.end() && it->name() == field.name()) {
+    *it = field;
+  } else {
+    it = fields_.insert(it, field);
+  }
+  return it->value();
 }
 
 String MetadataBase::get_string_field(const String& name) const {
@@ -941,28 +993,51 @@ String MetadataBase::get_string_field(const String& name) const {
   return value->to_string();
 }
 
+bool MetadataBase::has_same_fields(const MetadataBase& other) const {
+  if (fields_.size() != other.fields_.size()) return false;
+  for (size_t i = 0; i < fields_.size(); ++i) {
+    const Value* value = fields_[i].value();
+    const Value* other_value = other.fields_[i].value();
+    if (fields_[i].name() != other.fields_[i].name() ||
+        value->is_null() != other_value->is_null() ||
+        value->to_string_ref() != other_value->to_string_ref()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Vec>
+static bool all_same_fields(const Vec& vec, const Vec& other) {
+  if (vec.size() != other.size()) return false;
+  for (size_t i = 0; i < vec.size(); ++i) {
+    if (vec[i]->name() != other[i]->name() || !vec[i]->has_same_fields(*other[i])) return false;
+  }
+  return true;
+}
+
 const Value* MetadataBase::add_field(const RefBuffer::Ptr& buffer, const Row* row,
                                      const String& name) {
   const Value* value = row->get_by_name(name);
   if (value == NULL) return NULL;
   if (value->is_null()) {
-    fields_[name] = MetadataField(name);
+    set_field(MetadataField(name));
     return NULL; // Return NULL for "null" columns
   } else {
-    fields_[name] = MetadataField(name, *value, buffer);
+    set_field(MetadataField(name, *value, buffer));
     return value;
   }
 }
 
 void MetadataBase::add_field(const RefBuffer::Ptr& buffer, const Value& value, const String& name) {
-  fields_[name] = MetadataField(name, value, buffer);
+  set_field(MetadataField(name, value, buffer));
 }
 
 void MetadataBase::add_json_list_field(const Row* row, const String& name) {
   const Value* value = row->get_by_name(name);
   if (value == NULL) return;
   if (value->is_null()) {
-    fields_[name] = MetadataField(name);
+    set_field(MetadataField(name));
     return;
   }
 
@@ -977,7 +1052,7 @@ void MetadataBase::add_json_list_field(const Row* row, const String& name) {
 
   if (!d.IsArray()) {
     LOG_DEBUG("Expected JSON array for column '%s' (probably null or empty)", name.c_str());
-    fields_[name] = MetadataField(name);
+    set_field(MetadataField(name));
     return;
   }
 
@@ -994,14 +1069,14 @@ void MetadataBase::add_json_list_field(const Row* row, const String& name) {
 
   Value list(collection.data_type(), d.Size(),
              Decoder(encoded->data(), encoded_size, value->protocol_version()));
-  fields_[name] = MetadataField(name, list, encoded);
+  set_field(MetadataField(name, list, encoded));
 }
 
 const Value* MetadataBase::add_json_map_field(const Row* row, const String& name) {
   const Value* value = row->get_by_name(name);
   if (value == NULL) return NULL;
   if (value->is_null()) {
-    return (fields_[name] = MetadataField(name)).value();
+    return set_field(MetadataField(name));
   }
 
   Vector<char> buf = value->decoder().as_vector();
@@ -1010,13 +1085,12 @@ const Value* MetadataBase::add_json_map_field(const Row* row, const String& name
 
   if (d.HasParseError()) {
     LOG_ERROR("Unable to parse JSON (object) for column '%s'", name.c_str());
-    return (fields_[name] = MetadataField(name)).value();
+    return set_field(MetadataField(name));
   }
 
   if (!d.IsObject()) {
     LOG_DEBUG("Expected JSON object for column '%s' (probably null or empty)", name.c_str());
-    fields_[name] = MetadataField(name);
-    return (fields_[name] = MetadataField(name)).value();
+    return set_field(MetadataField(name));
   }
 
   Collection collection(CollectionType::map(DataType::Ptr(new DataType(CASS_VALUE_TYPE_TEXT)),
@@ -1036,7 +1110,7 @@ const Value* MetadataBase::add_json_map_field(const Row* row, const String& name
   Value map(collection.data_type(), d.MemberCount(),
             Decoder(encoded->data(), encoded_size, value->protocol_version()));
 
-  return (fields_[name] = MetadataField(name, map, encoded)).value();
+  return set_field(MetadataField(name, map, encoded));
 }
 
 const TableMetadata* KeyspaceMetadata::get_table(const String& name) const {
@@ -1173,6 +1247,91 @@ void KeyspaceMetadata::update(const VersionNumber& server_version, const RefBuff
   }
 }
 
+static bool is_equal(const TableMetadata::Ptr& a, const TableMetadata::Ptr& b) {
+  return a->equals(*b);
+}
+
+static bool is_equal(const ViewMetadata::Ptr& a, const ViewMetadata::Ptr& b) {
+  return a->equals(*b);
+}
+
+static bool is_equal(const UserType::Ptr& a, const UserType::Ptr& b) { return a->equals(b); }
+
+static bool is_equal(const FunctionMetadata::Ptr& a, const FunctionMetadata::Ptr& b) {
+  return a->has_same_fields(*b);
+}
+
+static bool is_equal(const AggregateMetadata::Ptr& a, const AggregateMetadata::Ptr& b) {
+  return a->has_same_fields(*b);
+}
+
+// Records the differences between two versions of a keyspace's tables, views,
+// types, functions or aggregates. Items that are equal, but are different
+// instances, are added to `unchanged` (if not NULL).
+template <class Map>
+static bool diff_map(const Map& previous, const Map& current, SchemaChange::Target target,
+                     const String& keyspace_name, SchemaChange::Vec* changes,
+                     Vector<typename Map::mapped_type>* unchanged) {
+  bool is_unchanged = true;
+  typename Map::const_iterator prev = previous.begin(), prev_end = previous.end();
+  typename Map::const_iterator curr = current.begin(), curr_end = current.end();
+  while (prev != prev_end || curr != curr_end) {
+    if (curr == curr_end || (prev != prev_end && prev->first < curr->first)) {
+      changes->push_back(SchemaChange(SchemaChange::DROPPED, target, keyspace_name, prev->first));
+      is_unchanged = false;
+      ++prev;
+    } else if (prev == prev_end || curr->first < prev->first) {
+      changes->push_back(SchemaChange(SchemaChange::CREATED, target, keyspace_name, curr->first));
+      is_unchanged = false;
+      ++curr;
+    } else {
+      if (prev->second.get() != curr->second.get()) {
+        if (!is_equal(prev->second, curr->second)) {
+          changes->push_back(
+              SchemaChange(SchemaChange::UPDATED, target, keyspace_name, curr->first));
+          is_unchanged = false;
+        } else if (unchanged != NULL) {
+          unchanged->push_back(prev->second);
+        }
+      }
+      ++prev;
+      ++curr;
+    }
+  }
+  return is_unchanged;
+}
+
+bool KeyspaceMetadata::diff(const KeyspaceMetadata& previous, SchemaChange::Vec* changes) {
+  bool is_unchanged = true;
+  if (!has_same_fields(previous)) {
+    changes->push_back(SchemaChange(SchemaChange::UPDATED, SchemaChange::KEYSPACE, name()));
+    is_unchanged = false;
+  }
+
+  TableMetadata::Vec unchanged_tables;
+  is_unchanged &= diff_map(*previous.tables_, *as_const(tables_), SchemaChange::TABLE, name(),
+                           changes, &unchanged_tables);
+  is_unchanged &= diff_map(*previous.views_, *as_const(views_), SchemaChange::VIEW, name(),
+                           changes, NULL);
+  is_unchanged &= diff_map(*previous.user_types_, *as_const(user_types_), SchemaChange::USER_TYPE,
+                           name(), changes, NULL);
+  is_unchanged &= diff_map(*previous.functions_, *as_const(functions_), SchemaChange::FUNCTION,
+                           name(), changes, NULL);
+  is_unchanged &= diff_map(*previous.aggregates_, *as_const(aggregates_), SchemaChange::AGGREGATE,
+                           name(), changes, NULL);
+
+  // Tables with views aren't shared because their views refer back to them
+  for (TableMetadata::Vec::const_iterator i = unchanged_tables.begin(),
+                                          end = unchanged_tables.end();
+       i != end; ++i) {
+    if ((*i)->views().empty()) {
+      (*tables_)[(*i)->name()] = *i;
+    }
+  }
+
+  return is_unchanged;
+}
+
 void KeyspaceMetadata::drop_user_type(const String& type_name) { user_types_->erase(type_name); }
 
 void KeyspaceMetadata::add_function(const FunctionMetadata::Ptr& function) {
@@ -1283,6 +1442,10 @@ size_t get_column_count(const ColumnMetadata::Vec& columns, CassColumnType type)
   return count;
 }
 
+bool TableMetadataBase::equals(const TableMetadataBase& other) const {
+  return has_same_fields(other) && all_same_fields(columns_, other.columns_);
+}
+
 void TableMetadataBase::build_keys_and_sort(const VersionNumber& server_version,
                                             SimpleDataTypeCache& cache) {
   // Also, Reorders columns so that the order is:
@@ -1459,6 +1622,19 @@ void TableMetadata::add_view(const ViewMetadata::Ptr& view) { views_.push_back(v
 
 void TableMetadata::sort_views() { std::sort(views_.begin(), views_.end()); }
 
+bool TableMetadata::equals(const TableMetadata& other) const {
+  if (!TableMetadataBase::equals(other) || !all_same_fields(indexes_, other.indexes_) ||
+      views_.size() != other.views_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < views_.size(); ++i) {
+    if (views_[i]->name() != other.views_[i]->name() || !views_[i]->equals(*other.views_[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void TableMetadata::key_aliases(SimpleDataTypeCache& cache, KeyAliases* output) const {
   const Value* aliases = get_field("key_aliases");
   if (aliases != NULL) {
@@ -2099,31 +2275,63 @@ void Metadata::InternalData::drop_keyspace(const String& keyspace_name) {
   keyspaces_->erase(keyspace_name);
 }
 
+void Metadata::InternalData::diff(const KeyspaceMetadata::Map& previous,
+                                  SchemaChange::Vec* changes) {
+  const KeyspaceMetadata::Map& current = *as_const(keyspaces_);
+  KeyspaceMetadata::Vec unchanged;
+
+  KeyspaceMetadata::Map::const_iterator prev = previous.begin(), prev_end = previous.end();
+  KeyspaceMetadata::Map::const_iterator curr = current.begin(), curr_end = current.end();
+  while (prev != prev_end || curr != curr_end) {
+    if (curr == curr_end || (prev != prev_end && prev->first < curr->first)) {
+      changes->push_back(SchemaChange(SchemaChange::DROPPED, SchemaChange::KEYSPACE, prev->first));
+      ++prev;
+    } else if (prev == prev_end || curr->first < prev->first) {
+      changes->push_back(SchemaChange(SchemaChange::CREATED, SchemaChange::KEYSPACE, curr->first));
+      ++curr;
+    } else {
+      // A keyspace that's a different instance was either rebuilt or copied
+      // before being modified so it's not yet visible to snapshots.
+      if (prev->second.get() != curr->second.get() &&
+          curr->second->diff(*prev->second, changes)) {
+        unchanged.push_back(prev->second);
+      }
+      ++prev;
+      ++curr;
+    }
+  }
+
+  for (KeyspaceMetadata::Vec::const_iterator i = unchanged.begin(), end = unchanged.end(); i != end;
+       ++i) {
+    (*keyspaces_)[(*i)->name()] = *i;
+  }
+}
+
 void Metadata::InternalData::drop_table_or_view(const String& keyspace_name,
                                                 const String& table_or_view_name) {
-  KeyspaceMetadata::Map::iterator i = keyspaces_->find(keyspace_name);
-  if (i == keyspaces_->end()) return;
-  i->second.drop_table_or_view(table_or_view_name);
+  KeyspaceMetadata* keyspace = get_keyspace(keyspace_name);
+  if (keyspace == NULL) return;
+  keyspace->drop_table_or_view(table_or_view_name);
 }
 
 void Metadata::InternalData::drop_user_type(const String& keyspace_name, const String& type_name) {
-  KeyspaceMetadata::Map::iterator i = keyspaces_->find(keyspace_name);
-  if (i == keyspaces_->end()) return;
-  i->second.drop_user_type(type_name);
+  KeyspaceMetadata* keyspace = get_keyspace(keyspace_name);
+  if (keyspace == NULL) return;
+  keyspace->drop_user_type(type_name);
 }
 
 void Metadata::InternalData::drop_function(const String& keyspace_name,
                                            const String& full_function_name) {
-  KeyspaceMetadata::Map::iterator i = keyspaces_->find(keyspace_name);
-  if (i == keyspaces_->end()) return;
-  i->second.drop_function(full_function_name);
+  KeyspaceMetadata* keyspace = get_keyspace(keyspace_name);
+  if (keyspace == NULL) return;
+  keyspace->drop_function(full_function_name);
 }
 
 void Metadata::InternalData::drop_aggregate(const String& keyspace_name,
                                             const String& full_aggregate_name) {
-  KeyspaceMetadata::Map::iterator i = keyspaces_->find(keyspace_name);
-  if (i == keyspaces_->end()) return;
-  i->second.drop_aggregate(full_aggregate_name);
+  KeyspaceMetadata* keyspace = get_keyspace(keyspace_name);
+  if (keyspace == NULL) return;
+  keyspace->drop_aggregate(full_aggregate_name);
 }
 
 void Metadata::InternalData::update_columns(const VersionNumber& server_version,
@@ -2280,11 +2488,26 @@ void Metadata::InternalData::update_indexes(const VersionNumber& server_version,
   }
 }
 
+// Keyspaces are shared between snapshots so they're copied before they're modified
+static KeyspaceMetadata* detach(KeyspaceMetadata::Ptr* keyspace) {
+  if ((*keyspace)->ref_count() > 1) {
+    *keyspace = KeyspaceMetadata::Ptr(new KeyspaceMetadata(**keyspace));
+  }
+  return keyspace->get();
+}
+
 KeyspaceMetadata* Metadata::InternalData::get_or_create_keyspace(const String& name,
                                                                  bool is_virtual) {
   KeyspaceMetadata::Map::iterator i = keyspaces_->find(name);
   if (i == keyspaces_->end()) {
-    i = keyspaces_->insert(std::make_pair(name, KeyspaceMetadata(name, is_virtual))).first;
+    KeyspaceMetadata::Ptr keyspace(new KeyspaceMetadata(name, is_virtual));
+    i = keyspaces_->insert(std::make_pair(name, keyspace)).first;
   }
-  return &i->second;
+  return detach(&i->second);
+}
+
+KeyspaceMetadata* Metadata::InternalData::get_keyspace(const String& name) {
+  KeyspaceMetadata::Map::iterator i = keyspaces_->find(name);
+  if (i == keyspaces_->end()) return NULL;
+  return detach(&i->second);
 }
@@ -94,9 +94,11 @@ private:
   typename Collection::const_iterator end_;
 };
 
+// Each field owns a copy of its name; names are not interned. Metadata objects
+// keep their fields sorted by name so lookups are a binary search.
 class MetadataField {
 public:
-  typedef internal::Map<String, MetadataField> Map;
+  typedef Vector<MetadataField> Vec;
 
   MetadataField() {}
 
@@ -120,17 +122,17 @@ private:
 
 class MetadataFieldIterator : public Iterator {
 public:
-  typedef MapIteratorImpl<MetadataField>::Collection Map;
+  typedef VecIteratorImpl<MetadataField>::Collection Vec;
 
-  MetadataFieldIterator(const Map& map)
+  MetadataFieldIterator(const Vec& fields)
       : Iterator(CASS_ITERATOR_TYPE_META_FIELD)
-      , impl_(map) {}
+      , impl_(fields) {}
 
   virtual bool next() { return impl_.next(); }
   const MetadataField* field() const { return &impl_.item(); }
 
 private:
-  MapIteratorImpl<MetadataField> impl_;
+  VecIteratorImpl<MetadataField> impl_;
 };
 
 class MetadataBase {
@@ -144,6 +146,8 @@ public:
   String get_string_field(const String& name) const;
   Iterator* iterator_fields() const { return new MetadataFieldIterator(fields_); }
 
+  bool has_same_fields(const MetadataBase& other) const;
+
   void swap_fields(MetadataBase& meta) { fields_.swap(meta.fields_); }
 
 protected:
@@ -152,7 +156,10 @@ protected:
   void add_json_list_field(const Row* row, const String& name);
   const Value* add_json_map_field(const Row* row, const String& name);
 
-  MetadataField::Map fields_;
+  // Replaces an existing field with the same name or inserts it in name order
+  const Value* set_field(const MetadataField& field);
+
+  MetadataField::Vec fields_; // Sorted by name
 
 private:
   const String name_;
@@ -368,6 +375,8 @@ public:
   void clear_columns();
   void build_keys_and_sort(const VersionNumber& server_version, SimpleDataTypeCache& cache);
 
+  bool equals(const TableMetadataBase& other) const;
+
 protected:
   const bool is_virtual_;
 
@@ -488,15 +497,44 @@ public:
 
   void key_aliases(SimpleDataTypeCache& cache, KeyAliases* output) const;
 
+  bool equals(const TableMetadata& other) const;
+
 private:
   ViewMetadata::Vec views_;
   IndexMetadata::Vec indexes_;
   IndexMetadata::Map indexes_by_name_;
 };
 
-class KeyspaceMetadata : public MetadataBase {
+/**
+ * A change to the schema metadata between two snapshots.
+ */
+struct SchemaChange {
+  typedef Vector<SchemaChange> Vec;
+
+  enum Type { CREATED, UPDATED, DROPPED };
+
+  enum Target { KEYSPACE, TABLE, VIEW, USER_TYPE, FUNCTION, AGGREGATE };
+
+  SchemaChange(Type type, Target target, const String& keyspace_name,
+               const String& name = String())
+      : type(type)
+      , target(target)
+      , keyspace_name(keyspace_name)
+      , name(name) {}
+
+  Type type;
+  Target target;
+  String keyspace_name;
+  String name; // Empty for keyspace changes
+};
+
+class KeyspaceMetadata
+    : public MetadataBase
+    , public RefCounted<KeyspaceMetadata> {
 public:
-  typedef internal::Map<String, KeyspaceMetadata> Map;
+  typedef SharedRefPtr<KeyspaceMetadata> Ptr;
+  typedef internal::Map<String, Ptr> Map;
+  typedef Vector<Ptr> Vec;
   typedef CopyOnWritePtr<KeyspaceMetadata::Map> MapPtr;
 
   class TableIterator : public MetadataIteratorImpl<MapIteratorImpl<TableMetadata::Ptr> > {
@@ -540,8 +578,32 @@ public:
       , functions_(new FunctionMetadata::Map())
       , aggregates_(new AggregateMetadata::Map()) {}
 
+  KeyspaceMetadata(const KeyspaceMetadata& other)
+      : MetadataBase(other)
+      , RefCounted<KeyspaceMetadata>()
+      , is_virtual_(other.is_virtual_)
+      , strategy_class_(other.strategy_class_)
+      , strategy_options_(other.strategy_options_)
+      , tables_(other.tables_)
+      , views_(other.views_)
+      , user_types_(other.user_types_)
+      , functions_(other.functions_)
+      , aggregates_(other.aggregates_) {}
+
   void update(const VersionNumber& server_version, const RefBuffer::Ptr& buffer, const Row* row);
 
+  /**
+   * Records the differences from a previous version of this keyspace. Tables
+   * that are unchanged are replaced by their previous version so that they're
+   * shared between snapshots.
+   *
+   * @param previous The previous version of the keyspace.
+   * @param changes The changes to the keyspace and its tables, views, types,
+   * functions and aggregates are appended to this.
+   * @return true if the keyspace is unchanged.
+   */
+  bool diff(const KeyspaceMetadata& previous, SchemaChange::Vec* changes);
+
   bool is_virtual() const { return is_virtual_; }
 
   const FunctionMetadata::Map& functions() const { return *functions_; }
@@ -594,12 +656,12 @@ private:
 
 class Metadata {
 public:
-  class KeyspaceIterator : public MetadataIteratorImpl<MapIteratorImpl<KeyspaceMetadata> > {
+  class KeyspaceIterator : public MetadataIteratorImpl<MapIteratorImpl<KeyspaceMetadata::Ptr> > {
   public:
     KeyspaceIterator(const KeyspaceIterator::Collection& collection)
-        : MetadataIteratorImpl<MapIteratorImpl<KeyspaceMetadata> >(CASS_ITERATOR_TYPE_KEYSPACE_META,
-                                                                   collection) {}
-    const KeyspaceMetadata* keyspace() const { return &impl_.item(); }
+        : MetadataIteratorImpl<MapIteratorImpl<KeyspaceMetadata::Ptr> >(
+              CASS_ITERATOR_TYPE_KEYSPACE_META, collection) {}
+    const KeyspaceMetadata* keyspace() const { return impl_.item().get(); }
   };
 
   class SchemaSnapshot : public Allocated {
@@ -660,6 +722,13 @@ public:
   // happen directly to the front buffer.
   void swap_to_back_and_update_front();
 
+  // Moves the changes made to the front buffer since the last call into
+  // `changes`. Full refreshes are diffed against the previous front buffer.
+  void take_schema_changes(SchemaChange::Vec* changes) {
+    changes->clear();
+    changes->swap(schema_changes_);
+  }
+
   void clear();
 
 private:
@@ -694,6 +763,9 @@ private:
     void drop_function(const String& keyspace_name, const String& full_function_name);
     void drop_aggregate(const String& keyspace_name, const String& full_aggregate_name);
 
+    // Unchanged keyspaces are replaced by their previous version
+    void diff(const KeyspaceMetadata::Map& previous, SchemaChange::Vec* changes);
+
     void clear() { keyspaces_->clear(); }
 
     void swap(InternalData& other) {
@@ -704,6 +776,7 @@ private:
 
   private:
     KeyspaceMetadata* get_or_create_keyspace(const String& name, bool is_virtual = false);
+    KeyspaceMetadata* get_keyspace(const String& name);
 
   private:
     CopyOnWritePtr<KeyspaceMetadata::Map> keyspaces_;
@@ -725,6 +798,7 @@ private:
   // Only used internally on a single thread, there's
   // no need for copy-on-write.
   SimpleDataTypeCache cache_;
+  SchemaChange::Vec schema_changes_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(Metadata);
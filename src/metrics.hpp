@@ -420,7 +420,9 @@ public:
       , request_rates(&thread_state_)
       , total_connections(&thread_state_)
       , connection_timeouts(&thread_state_)
-      , request_timeouts(&thread_state_) {}
+      , request_timeouts(&thread_state_)
+      , retries(&thread_state_)
+      , throttled_retries(&thread_state_) {}
 
   void record_request(uint64_t latency_ns) {
     // Final measurement is in microseconds
@@ -447,6 +449,9 @@ public:
   Counter connection_timeouts;
   Counter request_timeouts;
 
+  Counter retries;
+  Counter throttled_retries;
+
 private:
   DISALLOW_COPY_AND_ASSIGN(Metrics);
 };
@@ -89,6 +89,49 @@ public:
     return false;
   }
 
+  // Enqueues as many of the entries as there are free slots for, in order,
+  // using a single reservation of consecutive slots. Returns the number of
+  // entries enqueued.
+  size_t enqueue_bulk(const T* data, size_t count) {
+    size_t pos = tail_.load(MEMORY_ORDER_RELAXED);
+
+    for (;;) {
+      // find how many consecutive slots, starting at the tail, are empty
+      size_t available = 0;
+      bool is_stale = false;
+      while (available < count) {
+        Node* node = &buffer_[(pos + available) & mask_];
+        size_t node_seq = node->seq.load(MEMORY_ORDER_ACQUIRE);
+        intptr_t dif = (intptr_t)node_seq - (intptr_t)(pos + available);
+        if (dif < 0) break;  // full
+        if (dif > 0) {       // another producer moved the tail
+          is_stale = available == 0;
+          break;
+        }
+        ++available;
+      }
+
+      if (is_stale) {
+        pos = tail_.load(MEMORY_ORDER_RELAXED);
+        continue;
+      }
+
+      if (available == 0) {
+        return 0;
+      }
+
+      // claim all the slots at once
+      if (tail_.compare_exchange_weak(pos, pos + available, MEMORY_ORDER_RELAXED)) {
+        for (size_t i = 0; i < available; ++i) {
+          Node* node = &buffer_[(pos + i) & mask_];
+          node->data = data[i];
+          node->seq.store(pos + i + 1, MEMORY_ORDER_RELEASE);
+        }
+        return available;
+      }
+    }
+  }
+
   bool dequeue(T& data) {
     size_t pos = head_.load(MEMORY_ORDER_RELAXED);
 
@@ -0,0 +1,119 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+/*
+  Implementation of Dmitry Vyukov's intrusive MPSC algorithm
+  http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+*/
+
+#ifndef DATASTAX_INTERNAL_MPSC_QUEUE
+#define DATASTAX_INTERNAL_MPSC_QUEUE
+
+#include "allocated.hpp"
+#include "atomic.hpp"
+#include "macros.hpp"
+
+#include <stddef.h>
+
+namespace datastax { namespace internal { namespace core {
+
+class MPSCQueueNode {
+public:
+  MPSCQueueNode()
+      : mpsc_next_(NULL) {}
+
+private:
+  template <class T>
+  friend class MPSCQueue;
+
+  Atomic<MPSCQueueNode*> mpsc_next_;
+};
+
+/**
+ * An unbounded, intrusive queue with wait-free producers and a single
+ * consumer. Entries must derive from MPSCQueueNode and can only be in one
+ * queue at a time.
+ */
+template <class T>
+class MPSCQueue : public Allocated {
+public:
+  MPSCQueue()
+      : head_(&stub_)
+      , tail_(&stub_) {}
+
+  void enqueue(T* entry) {
+    MPSCQueueNode* node = entry;
+    node->mpsc_next_.store(NULL, MEMORY_ORDER_RELAXED);
+    MPSCQueueNode* prev = head_.exchange(node, MEMORY_ORDER_ACQ_REL);
+    // There's a short window here where the entry isn't reachable by the
+    // consumer. dequeue() returns NULL in that case, but is_empty() won't.
+    prev->mpsc_next_.store(node, MEMORY_ORDER_RELEASE);
+  }
+
+  // Only safe to call from the consumer thread
+  T* dequeue() {
+    MPSCQueueNode* tail = tail_;
+    MPSCQueueNode* next = tail->mpsc_next_.load(MEMORY_ORDER_ACQUIRE);
+    if (tail == &stub_) {
+      if (next == NULL) return NULL;
+      tail_ = next;
+      tail = next;
+      next = next->mpsc_next_.load(MEMORY_ORDER_ACQUIRE);
+    }
+    if (next != NULL) {
+      tail_ = next;
+      return static_cast<T*>(tail);
+    }
+    if (tail != head_.load(MEMORY_ORDER_ACQUIRE)) {
+      return NULL; // A producer is in the middle of an enqueue
+    }
+    // The last entry can't be handed out until another node follows it
+    enqueue_stub();
+    next = tail->mpsc_next_.load(MEMORY_ORDER_ACQUIRE);
+    if (next != NULL) {
+      tail_ = next;
+      return static_cast<T*>(tail);
+    }
+    return NULL;
+  }
+
+  // Only safe to call from the consumer thread
+  bool is_empty() const { return tail_ == &stub_ && head_.load(MEMORY_ORDER_ACQUIRE) == &stub_; }
+
+private:
+  void enqueue_stub() {
+    stub_.mpsc_next_.store(NULL, MEMORY_ORDER_RELAXED);
+    MPSCQueueNode* prev = head_.exchange(&stub_, MEMORY_ORDER_ACQ_REL);
+    prev->mpsc_next_.store(&stub_, MEMORY_ORDER_RELEASE);
+  }
+
+private:
+  // it's either 32 or 64 so 64 is good enough
+  typedef char CachePad[64];
+
+  CachePad pad0_;
+  Atomic<MPSCQueueNode*> head_;
+  CachePad pad1_;
+  MPSCQueueNode* tail_;
+  MPSCQueueNode stub_;
+  CachePad pad2_;
+
+  DISALLOW_COPY_AND_ASSIGN(MPSCQueue);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
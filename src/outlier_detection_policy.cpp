@@ -0,0 +1,57 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "outlier_detection_policy.hpp"
+
+using namespace datastax;
+using namespace datastax::internal;
+using namespace datastax::internal::core;
+
+void OutlierDetectionPolicy::init(const Host::Ptr& connected_host, const HostMap& hosts,
+                                  Random* random, const String& local_dc) {
+  for (HostMap::const_iterator i = hosts.begin(), end = hosts.end(); i != end; ++i) {
+    i->second->enable_outlier_detection(settings_);
+  }
+  ChainedLoadBalancingPolicy::init(connected_host, hosts, random, local_dc);
+}
+
+QueryPlan* OutlierDetectionPolicy::new_query_plan(const String& keyspace,
+                                                  RequestHandler* request_handler,
+                                                  const TokenMap* token_map) {
+  return new OutlierDetectionQueryPlan(
+      child_policy_->new_query_plan(keyspace, request_handler, token_map));
+}
+
+void OutlierDetectionPolicy::on_host_added(const Host::Ptr& host) {
+  host->enable_outlier_detection(settings_);
+  ChainedLoadBalancingPolicy::on_host_added(host);
+}
+
+Host::Ptr OutlierDetectionPolicy::OutlierDetectionQueryPlan::compute_next() {
+  Host::Ptr host;
+  while ((host = child_plan_->compute_next())) {
+    if (!host->is_ejected()) {
+      return host;
+    }
+    skipped_.push_back(host);
+  }
+
+  if (skipped_index_ < skipped_.size()) {
+    return skipped_[skipped_index_++];
+  }
+
+  return Host::Ptr();
+}
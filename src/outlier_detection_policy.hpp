@@ -0,0 +1,82 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_OUTLIER_DETECTION_POLICY_HPP
+#define DATASTAX_INTERNAL_OUTLIER_DETECTION_POLICY_HPP
+
+#include "load_balancing.hpp"
+#include "macros.hpp"
+#include "scoped_ptr.hpp"
+
+namespace datastax { namespace internal { namespace core {
+
+/**
+ * A load balancing policy that moves hosts ejected by outlier detection to the
+ * end of its child policy's query plans. Hosts that are UP according to the
+ * cluster, but fail (time out, return overloaded errors, etc.) a large portion
+ * of their requests, are avoided while they're ejected and are gradually
+ * given more requests once the ejection ends.
+ *
+ * Ejected hosts are still tried as a last resort and their distance and UP
+ * state are unchanged so that their connection pools are kept.
+ */
+class OutlierDetectionPolicy : public ChainedLoadBalancingPolicy {
+public:
+  typedef OutlierDetectionSettings Settings;
+
+  OutlierDetectionPolicy(LoadBalancingPolicy* child_policy, const Settings& settings)
+      : ChainedLoadBalancingPolicy(child_policy)
+      , settings_(settings) {}
+
+  virtual ~OutlierDetectionPolicy() {}
+
+  virtual void init(const Host::Ptr& connected_host, const HostMap& hosts, Random* random,
+                    const String& local_dc);
+
+  virtual QueryPlan* new_query_plan(const String& keyspace, RequestHandler* request_handler,
+                                    const TokenMap* token_map);
+
+  virtual LoadBalancingPolicy* new_instance() {
+    return new OutlierDetectionPolicy(child_policy_->new_instance(), settings_);
+  }
+
+  virtual void on_host_added(const Host::Ptr& host);
+
+private:
+  class OutlierDetectionQueryPlan : public QueryPlan {
+  public:
+    OutlierDetectionQueryPlan(QueryPlan* child_plan)
+        : child_plan_(child_plan)
+        , skipped_index_(0) {}
+
+    Host::Ptr compute_next();
+
+  private:
+    ScopedPtr<QueryPlan> child_plan_;
+
+    HostVec skipped_;
+    size_t skipped_index_;
+  };
+
+  Settings settings_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(OutlierDetectionPolicy);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
@@ -0,0 +1,106 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "peak_ewma_policy.hpp"
+
+#include "logger.hpp"
+
+using namespace datastax;
+using namespace datastax::internal;
+using namespace datastax::internal::core;
+
+// The latency assumed for a host with in-flight requests but no recorded
+// latency (1 second).
+static const double PENALTY_NS = 1000.0 * 1000.0 * 1000.0;
+
+const uint64_t PeakEwmaPolicy::MAX_DECAY_MS;
+
+void PeakEwmaPolicy::init(const Host::Ptr& connected_host, const HostMap& hosts, Random* random,
+                          const String& local_dc) {
+  uint64_t ignored_decay_ns = 0;
+  for (HostMap::const_iterator i = hosts.begin(), end = hosts.end(); i != end; ++i) {
+    uint64_t decay_ns = i->second->enable_peak_ewma(settings_.decay_ns);
+    if (decay_ns != settings_.decay_ns) ignored_decay_ns = decay_ns;
+  }
+  if (ignored_decay_ns != 0) warn_decay_ignored(ignored_decay_ns);
+  ChainedLoadBalancingPolicy::init(connected_host, hosts, random, local_dc);
+}
+
+QueryPlan* PeakEwmaPolicy::new_query_plan(const String& keyspace, RequestHandler* request_handler,
+                                          const TokenMap* token_map) {
+  return new PeakEwmaQueryPlan(settings_,
+                               child_policy_->new_query_plan(keyspace, request_handler, token_map));
+}
+
+void PeakEwmaPolicy::on_host_added(const Host::Ptr& host) {
+  uint64_t decay_ns = host->enable_peak_ewma(settings_.decay_ns);
+  if (decay_ns != settings_.decay_ns) warn_decay_ignored(decay_ns);
+  ChainedLoadBalancingPolicy::on_host_added(host);
+}
+
+void PeakEwmaPolicy::warn_decay_ignored(uint64_t decay_ns) const {
+  // A host has a single moving average that's shared by all the execution
+  // profiles so the decay of the first profile to enable it is used.
+  LOG_WARN("Ignoring peak EWMA decay of %llu ms because hosts are already using a decay of %llu "
+           "ms (set by another execution profile)",
+           static_cast<unsigned long long>(settings_.decay_ns / (1000 * 1000)),
+           static_cast<unsigned long long>(decay_ns / (1000 * 1000)));
+}
+
+double PeakEwmaPolicy::score(const Host::Ptr& host) {
+  int32_t inflight = host->inflight_request_count();
+  if (inflight < 0) inflight = 0;
+  int64_t latency = host->peak_ewma();
+  if (latency == 0) {
+    return inflight == 0 ? 0.0 : PENALTY_NS * (inflight + 1);
+  }
+  return static_cast<double>(latency) * (inflight + 1);
+}
+
+Host::Ptr PeakEwmaPolicy::PeakEwmaQueryPlan::compute_next() {
+  if (!is_ranked_) {
+    rank();
+  }
+
+  if (index_ < candidates_.size()) {
+    return candidates_[index_++].host;
+  }
+
+  return child_plan_->compute_next();
+}
+
+void PeakEwmaPolicy::PeakEwmaQueryPlan::rank() {
+  is_ranked_ = true;
+
+  Host::Ptr host;
+  while (candidates_.size() < settings_.max_candidates && (host = child_plan_->compute_next())) {
+    Candidate candidate;
+    candidate.host = host;
+    candidate.score = score(host);
+    candidates_.push_back(candidate);
+  }
+
+  // A stable insertion sort; the number of candidates is small and ties keep
+  // the child policy's order (e.g. replica shuffling or round-robin).
+  for (size_t i = 1; i < candidates_.size(); ++i) {
+    Candidate candidate = candidates_[i];
+    size_t j = i;
+    for (; j > 0 && candidate.score < candidates_[j - 1].score; --j) {
+      candidates_[j] = candidates_[j - 1];
+    }
+    candidates_[j] = candidate;
+  }
+}
@@ -0,0 +1,114 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_PEAK_EWMA_POLICY_HPP
+#define DATASTAX_INTERNAL_PEAK_EWMA_POLICY_HPP
+
+#include "load_balancing.hpp"
+#include "macros.hpp"
+#include "scoped_ptr.hpp"
+#include "small_vector.hpp"
+
+namespace datastax { namespace internal { namespace core {
+
+/**
+ * A load balancing policy that reorders the first few hosts of its child
+ * policy's query plan (e.g. the local replicas when chained with token-aware
+ * routing) by a load score: the host's peak EWMA latency multiplied by its
+ * number of in-flight requests plus one. The peak EWMA is updated on every
+ * response without locks and immediately reflects latency spikes, so traffic
+ * moves away from a slow or overloaded host within a few requests.
+ */
+class PeakEwmaPolicy : public ChainedLoadBalancingPolicy {
+public:
+  // The maximum decay accepted by the settings functions (1 day)
+  static const uint64_t MAX_DECAY_MS = 24ULL * 60 * 60 * 1000;
+
+  struct Settings {
+    Settings()
+        : decay_ns(10LL * 1000LL * 1000LL * 1000LL)
+        , max_candidates(3) {}
+
+    uint64_t decay_ns;
+    unsigned max_candidates;
+  };
+
+  PeakEwmaPolicy(LoadBalancingPolicy* child_policy, const Settings& settings)
+      : ChainedLoadBalancingPolicy(child_policy)
+      , settings_(settings) {}
+
+  virtual ~PeakEwmaPolicy() {}
+
+  virtual void init(const Host::Ptr& connected_host, const HostMap& hosts, Random* random,
+                    const String& local_dc);
+
+  virtual QueryPlan* new_query_plan(const String& keyspace, RequestHandler* request_handler,
+                                    const TokenMap* token_map);
+
+  virtual LoadBalancingPolicy* new_instance() {
+    return new PeakEwmaPolicy(child_policy_->new_instance(), settings_);
+  }
+
+  virtual void on_host_added(const Host::Ptr& host);
+
+  /**
+   * The load score of a host; lower is better. Hosts without a recorded
+   * latency are scored with a penalty while they have in-flight requests so
+   * that new hosts are probed without being flooded.
+   */
+  static double score(const Host::Ptr& host);
+
+private:
+  void warn_decay_ignored(uint64_t decay_ns) const;
+
+private:
+  class PeakEwmaQueryPlan : public QueryPlan {
+  public:
+    PeakEwmaQueryPlan(const Settings& settings, QueryPlan* child_plan)
+        : settings_(settings)
+        , child_plan_(child_plan)
+        , index_(0)
+        , is_ranked_(false) {}
+
+    Host::Ptr compute_next();
+
+  private:
+    void rank();
+
+  private:
+    struct Candidate {
+      Host::Ptr host;
+      double score;
+    };
+
+    typedef SmallVector<Candidate, 4> CandidateVec;
+
+    const Settings& settings_;
+    ScopedPtr<QueryPlan> child_plan_;
+    CandidateVec candidates_;
+    size_t index_;
+    bool is_ranked_;
+  };
+
+  Settings settings_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(PeakEwmaPolicy);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
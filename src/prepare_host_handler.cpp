@@ -33,21 +33,69 @@ struct CompareEntryKeyspace {
   }
 };
 
+typedef std::pair<uint64_t, PreparedMetadata::Entry::Ptr> LastUsedEntry;
+
+struct CompareEntryLastUsed {
+  explicit CompareEntryLastUsed(bool sort_by_keyspace)
+      : sort_by_keyspace(sort_by_keyspace) {}
+
+  bool operator()(const LastUsedEntry& lhs, const LastUsedEntry& rhs) const {
+    if (lhs.first != rhs.first) {
+      return lhs.first > rhs.first; // Most recently used first
+    }
+    return sort_by_keyspace && lhs.second->keyspace() < rhs.second->keyspace();
+  }
+
+  bool sort_by_keyspace;
+};
+
 PrepareHostHandler::PrepareHostHandler(
     const Host::Ptr& host, const PreparedMetadata::Entry::Vec& prepared_metadata_entries,
-    const Callback& callback, ProtocolVersion protocol_version, unsigned max_requests_per_flush)
+    const Callback& callback, ProtocolVersion protocol_version, unsigned max_requests_per_flush,
+    unsigned num_connections, unsigned num_hot_entries)
     : host_(host)
     , protocol_version_(protocol_version)
     , callback_(callback)
-    , connection_(NULL)
-    , prepares_outstanding_(0)
+    , is_notified_(false)
+    , max_requests_per_flush_(max_requests_per_flush)
+    , num_connections_(std::max(num_connections, 1u))
+    , connecting_count_(0)
+    , closed_count_(0)
     , max_prepares_outstanding_(CASS_MAX_STREAMS)
-    , prepared_metadata_entries_(prepared_metadata_entries) {
+    , hot_prepared_count_(0) {
+  // Sort by the most recent use so that the statements that are likely to be
+  // executed next are prepared first. The last used times are copied because
+  // they can be updated concurrently and are bucketed by the granularity they're
+  // recorded at. Statements in the same bucket are sorted by keyspace to
+  // minimize the number of times the keyspace needs to be changed.
+  Vector<LastUsedEntry> entries;
+  entries.reserve(prepared_metadata_entries.size());
+  for (PreparedMetadata::Entry::Vec::const_iterator it = prepared_metadata_entries.begin(),
+                                                    end = prepared_metadata_entries.end();
+       it != end; ++it) {
+    uint64_t bucket = (*it)->last_used_ns() / PreparedMetadata::Entry::LAST_USED_GRANULARITY_NS;
+    entries.push_back(LastUsedEntry(bucket, *it));
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+                   CompareEntryLastUsed(!protocol_version_.supports_set_keyspace()));
+
+  prepared_metadata_entries_.reserve(entries.size());
+  for (Vector<LastUsedEntry>::const_iterator it = entries.begin(), end = entries.end(); it != end;
+       ++it) {
+    prepared_metadata_entries_.push_back(it->second);
+  }
+
+  num_hot_entries_ = prepared_metadata_entries_.size();
+  if (num_hot_entries > 0 && num_hot_entries < num_hot_entries_) {
+    num_hot_entries_ = num_hot_entries;
+  }
 
-  // Sort by keyspace to minimize the number of times the keyspace
-  // needs to be changed.
-  std::sort(prepared_metadata_entries_.begin(), prepared_metadata_entries_.end(),
-            CompareEntryKeyspace());
+  // The order of the remaining statements doesn't matter so they're sorted by
+  // keyspace only.
+  if (!protocol_version_.supports_set_keyspace()) {
+    std::stable_sort(prepared_metadata_entries_.begin() + num_hot_entries_,
+                     prepared_metadata_entries_.end(), CompareEntryKeyspace());
+  }
 
   current_entry_it_ = prepared_metadata_entries_.begin();
 }
@@ -60,88 +108,126 @@ void PrepareHostHandler::prepare(uv_loop_t* loop, const ConnectionSettings& sett
 
   inc_ref(); // Reference for the event loop
 
-  Connector::Ptr connector(new Connector(host_, protocol_version_,
-                                         bind_callback(&PrepareHostHandler::on_connect, this)));
+  connections_.reserve(num_connections_);
+  connecting_count_ = num_connections_;
+  for (unsigned i = 0; i < num_connections_; ++i) {
+    Connector::Ptr connector(new Connector(host_, protocol_version_,
+                                           bind_callback(&PrepareHostHandler::on_connect, this)));
 
-  connector->with_settings(settings)->with_listener(this)->connect(loop);
+    connector->with_settings(settings)->with_listener(this)->connect(loop);
+  }
 }
 
 void PrepareHostHandler::on_close(Connection* connection) {
-  callback_(this);
-
-  dec_ref(); // The event loop is done with this handler
+  for (PrepareConnectionVec::iterator it = connections_.begin(), end = connections_.end();
+       it != end; ++it) {
+    if (it->connection == connection) {
+      it->connection = NULL;
+    }
+  }
+  closed_count_++;
+  maybe_finish();
 }
 
 void PrepareHostHandler::on_connect(Connector* connector) {
+  connecting_count_--;
   if (connector->is_ok()) {
-    connection_ = connector->release_connection().get();
-    prepare_next();
+    connections_.push_back(PrepareConnection(connector->release_connection().get()));
+    if (is_done()) {
+      // The other connections have already prepared all the statements
+      connections_.back().connection->close();
+    } else {
+      prepare_next(connections_.size() - 1);
+    }
   } else {
-    callback_(this);
-    dec_ref(); // The event loop is done with this handler
+    maybe_finish();
   }
 }
 
-// This is the main loop for preparing statements. It's called after each
-// request successfully completes, either setting the keyspace or preparing
-// a statement. It attempts to group prepare requests into a single batch as
-// long as the keyspace is the same and the number of outstanding requests is
-// under the maximum.
-void PrepareHostHandler::prepare_next() {
-  // Finish current prepares before continuing
-  if (--prepares_outstanding_ > 0) {
-    return;
-  }
-
-  // Check to see if we're done
-  if (is_done()) {
-    close();
-    return;
-  }
-
-  prepares_outstanding_ = 0;
+// This is the main loop for preparing statements on a connection. It's called
+// after each request on the connection successfully completes, either setting
+// the keyspace or preparing a statement. It attempts to keep as many prepare
+// requests in flight as the connection allows as long as the keyspace is the
+// same. The connections share the list of statements so they're prepared in
+// order of most recent use.
+void PrepareHostHandler::prepare_next(size_t index) {
+  Connection* connection = connections_[index].connection;
+  if (connection == NULL) return;
 
   // Write prepare requests until there's no more left, the keyspace changes,
   // or the maximum number of outstanding prepares is reached.
-  while (!is_done() && check_and_set_keyspace() &&
-         prepares_outstanding_ < max_prepares_outstanding_) {
+  unsigned requests_written = 0;
+  while (!is_done() && connections_[index].prepares_outstanding < max_prepares_outstanding_ &&
+         check_and_set_keyspace(index)) {
     const String& query((*current_entry_it_)->query());
     PrepareRequest::Ptr prepare_request(new PrepareRequest(query));
 
     // Set the keyspace in case per request keyspaces are supported
-    prepare_request->set_keyspace(current_keyspace_);
-
-    PrepareCallback::Ptr callback(new PrepareCallback(prepare_request, Ptr(this)));
-    if (connection_->write(callback) < 0) {
+    prepare_request->set_keyspace((*current_entry_it_)->keyspace());
+
+    bool is_hot = static_cast<size_t>(current_entry_it_ - prepared_metadata_entries_.begin()) <
+                  num_hot_entries_;
+    PrepareCallback::Ptr callback(new PrepareCallback(prepare_request, Ptr(this), index, is_hot));
+    int32_t result = connection->write(callback);
+    if (result == Request::REQUEST_ERROR_NO_AVAILABLE_STREAM_IDS &&
+        connections_[index].prepares_outstanding > 0) {
+      break; // Continue once some of the outstanding prepares complete
+    } else if (result < 0) {
       LOG_WARN("Failed to write prepare request while preparing all queries on host %s",
                host_->address_string().c_str());
       close();
       return;
     }
 
-    prepares_outstanding_++;
+    connections_[index].prepares_outstanding++;
     current_entry_it_++;
+
+    if (max_requests_per_flush_ > 0 && ++requests_written % max_requests_per_flush_ == 0) {
+      connection->flush();
+    }
+  }
+
+  connection->flush();
+
+  // Check to see if we're done with this connection
+  if (is_done() && connections_[index].prepares_outstanding == 0) {
+    connection->close();
   }
+}
 
-  connection_->flush();
+void PrepareHostHandler::finish_request(size_t index, bool is_hot) {
+  connections_[index].prepares_outstanding--;
+  if (is_hot && ++hot_prepared_count_ == num_hot_entries_) {
+    LOG_DEBUG("Prepared %u most recently used queries on host %s",
+              static_cast<unsigned>(num_hot_entries_), host_->address_string().c_str());
+    notify();
+  }
+  prepare_next(index);
 }
 
-bool PrepareHostHandler::check_and_set_keyspace() {
+bool PrepareHostHandler::check_and_set_keyspace(size_t index) {
   if (protocol_version_.supports_set_keyspace()) {
     return true;
   }
 
+  PrepareConnection& prepare_connection = connections_[index];
   const String& keyspace((*current_entry_it_)->keyspace());
 
-  if (keyspace != current_keyspace_) {
-    PrepareCallback::Ptr callback(new SetKeyspaceCallback(keyspace, Ptr(this)));
-    if (connection_->write_and_flush(callback) < 0) {
+  if (keyspace != prepare_connection.keyspace) {
+    // Finish current prepares before changing the keyspace
+    if (prepare_connection.prepares_outstanding > 0) {
+      return false;
+    }
+
+    PrepareCallback::Ptr callback(new SetKeyspaceCallback(keyspace, Ptr(this), index));
+    if (prepare_connection.connection->write_and_flush(callback) < 0) {
       LOG_WARN("Failed to write \"USE\" keyspace request while preparing all queries on host %s",
                host_->address_string().c_str());
       close();
       return false;
     }
-    current_keyspace_ = keyspace;
+    prepare_connection.keyspace = keyspace;
+    prepare_connection.prepares_outstanding++;
     return false;
   }
 
@@ -152,18 +238,43 @@ bool PrepareHostHandler::is_done() const {
   return current_entry_it_ == prepared_metadata_entries_.end();
 }
 
-void PrepareHostHandler::close() { connection_->close(); }
+void PrepareHostHandler::notify() {
+  if (!is_notified_) {
+    is_notified_ = true;
+    callback_(this);
+  }
+}
+
+void PrepareHostHandler::maybe_finish() {
+  if (connecting_count_ == 0 && closed_count_ == connections_.size()) {
+    notify(); // In case not all the hot statements were prepared
+    dec_ref(); // The event loop is done with this handler
+  }
+}
+
+void PrepareHostHandler::close() {
+  // Stop preparing the remaining statements, including on connections that
+  // are still connecting.
+  current_entry_it_ = prepared_metadata_entries_.end();
+  for (PrepareConnectionVec::const_iterator it = connections_.begin(), end = connections_.end();
+       it != end; ++it) {
+    if (it->connection) it->connection->close();
+  }
+}
 
 PrepareHostHandler::PrepareCallback::PrepareCallback(
-    const PrepareRequest::ConstPtr& prepare_request, const PrepareHostHandler::Ptr& handler)
+    const PrepareRequest::ConstPtr& prepare_request, const PrepareHostHandler::Ptr& handler,
+    size_t index, bool is_hot)
     : SimpleRequestCallback(prepare_request)
-    , handler_(handler) {}
+    , handler_(handler)
+    , index_(index)
+    , is_hot_(is_hot) {}
 
 void PrepareHostHandler::PrepareCallback::on_internal_set(ResponseMessage* response) {
   LOG_DEBUG("Successfully prepared query \"%s\" on host %s while preparing all queries",
             static_cast<const PrepareRequest*>(request())->query().c_str(),
             handler_->host()->address_string().c_str());
-  handler_->prepare_next();
+  handler_->finish_request(index_, is_hot_);
 }
 
 void PrepareHostHandler::PrepareCallback::on_internal_error(CassError code, const String& message) {
@@ -179,14 +290,17 @@ void PrepareHostHandler::PrepareCallback::on_internal_timeout() {
 }
 
 PrepareHostHandler::SetKeyspaceCallback::SetKeyspaceCallback(const String& keyspace,
-                                                             const PrepareHostHandler::Ptr& handler)
+                                                             const PrepareHostHandler::Ptr& handler,
+                                                             size_t index)
     : SimpleRequestCallback(Request::ConstPtr(new QueryRequest("USE " + keyspace)))
-    , handler_(handler) {}
+    , keyspace_(keyspace)
+    , handler_(handler)
+    , index_(index) {}
 
 void PrepareHostHandler::SetKeyspaceCallback::on_internal_set(ResponseMessage* response) {
   LOG_TRACE("Successfully set keyspace to \"%s\" on host %s while preparing all queries",
-            handler_->current_keyspace_.c_str(), handler_->host()->address_string().c_str());
-  handler_->prepare_next();
+            keyspace_.c_str(), handler_->host()->address_string().c_str());
+  handler_->finish_request(index_, false);
 }
 
 void PrepareHostHandler::SetKeyspaceCallback::on_internal_error(CassError code,
@@ -23,13 +23,19 @@
 #include "prepared.hpp"
 #include "ref_counted.hpp"
 #include "string.hpp"
+#include "vector.hpp"
 
 namespace datastax { namespace internal { namespace core {
 
 class Connector;
 
 /**
- * A handler for pre-preparing statements on a newly available host.
+ * A handler for pre-preparing statements on a newly available host. The
+ * statements are prepared in order of most recent use and are spread over
+ * multiple temporary connections, keeping as many prepare requests in flight
+ * as each connection allows. The callback is called once the most recently
+ * used ("hot") statements are prepared, or if an error occurs, and the
+ * remaining statements continue to be prepared in the background.
  */
 class PrepareHostHandler
     : public RefCounted<PrepareHostHandler>
@@ -39,10 +45,27 @@ public:
 
   typedef SharedRefPtr<PrepareHostHandler> Ptr;
 
+  /**
+   * Constructor.
+   *
+   * @param host The host to prepare the statements on.
+   * @param prepared_metadata_entries The cached prepared statements.
+   * @param callback A callback that's called once the hot statements are
+   * prepared or an error occurred.
+   * @param protocol_version The protocol version to use for the connections.
+   * @param max_requests_per_flush The maximum number of prepare requests
+   * written to a connection per flush.
+   * @param num_connections The number of connections used to prepare the
+   * statements.
+   * @param num_hot_entries The number of most recently used statements that
+   * need to be prepared before the callback is called. If zero then all the
+   * statements need to be prepared.
+   */
   PrepareHostHandler(const Host::Ptr& host,
                      const PreparedMetadata::Entry::Vec& prepared_metadata_entries,
                      const Callback& callback, ProtocolVersion protocol_version,
-                     unsigned max_requests_per_flush);
+                     unsigned max_requests_per_flush, unsigned num_connections = 1,
+                     unsigned num_hot_entries = 0);
 
   const Host::Ptr host() const { return host_; }
 
@@ -57,12 +80,12 @@ private:
   /**
    * A callback for preparing a single statement on a host. It continues the
    * preparation process on success, otherwise it closes the temporary
-   * connection and logs a warning.
+   * connections and logs a warning.
    */
   class PrepareCallback : public SimpleRequestCallback {
   public:
     PrepareCallback(const PrepareRequest::ConstPtr& prepare_request,
-                    const PrepareHostHandler::Ptr& handler);
+                    const PrepareHostHandler::Ptr& handler, size_t index, bool is_hot);
 
     virtual void on_internal_set(ResponseMessage* response);
 
@@ -72,17 +95,20 @@ private:
 
   private:
     PrepareHostHandler::Ptr handler_;
+    size_t index_;
+    bool is_hot_;
   };
 
   /**
    * A callback for setting the keyspace on a connection. This is requrired
    * pre-V5/DSEv2 because the keyspace state is per connection.  It continues
    * the preparation process on success, otherwise it closes the temporary
-   * connection and logs a warning.
+   * connections and logs a warning.
    */
   class SetKeyspaceCallback : public SimpleRequestCallback {
   public:
-    SetKeyspaceCallback(const String& keyspace, const PrepareHostHandler::Ptr& handler);
+    SetKeyspaceCallback(const String& keyspace, const PrepareHostHandler::Ptr& handler,
+                        size_t index);
 
     virtual void on_internal_set(ResponseMessage* response);
 
@@ -91,28 +117,56 @@ private:
     virtual void on_internal_timeout();
 
   private:
+    String keyspace_;
     PrepareHostHandler::Ptr handler_;
+    size_t index_;
   };
 
+  /**
+   * The state of a temporary connection used for preparing statements.
+   */
+  struct PrepareConnection {
+    PrepareConnection(Connection* connection)
+        : connection(connection)
+        , prepares_outstanding(0) {}
+
+    Connection* connection;
+    String keyspace;
+    int prepares_outstanding;
+  };
+
+  typedef Vector<PrepareConnection> PrepareConnectionVec;
+
 private:
   // This is the main method for iterating over the list of prepared statements
-  void prepare_next();
+  void prepare_next(size_t index);
+
+  // Called when a request on the connection at the given index completes
+  void finish_request(size_t index, bool is_hot);
 
   // Returns true if the keyspace is current or using protocol v5/DSEv2
-  bool check_and_set_keyspace();
+  bool check_and_set_keyspace(size_t index);
 
   bool is_done() const;
 
+  void notify();
+  void maybe_finish();
+
   void close();
 
 private:
   const Host::Ptr host_;
   const ProtocolVersion protocol_version_;
   Callback callback_;
-  Connection* connection_;
-  String current_keyspace_;
-  int prepares_outstanding_;
+  bool is_notified_;
+  const unsigned max_requests_per_flush_;
+  const unsigned num_connections_;
+  unsigned connecting_count_;
+  unsigned closed_count_;
+  PrepareConnectionVec connections_;
   const int max_prepares_outstanding_;
+  size_t num_hot_entries_;
+  size_t hot_prepared_count_;
   PreparedMetadata::Entry::Vec prepared_metadata_entries_;
   PreparedMetadata::Entry::Vec::const_iterator current_entry_it_;
 };
@@ -74,7 +74,7 @@ const CassDataType* cass_prepared_parameter_data_type_by_name_n(const CassPrepar
 
 } // extern "C"
 
-Prepared::Prepared(const ResultResponse::Ptr& result,
+Prepared::Prepared(const ResultResponse::ConstPtr& result,
                    const PrepareRequest::ConstPtr& prepare_request,
                    const Metadata::SchemaSnapshot& schema_metadata)
     : result_(result)
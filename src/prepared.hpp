@@ -17,6 +17,7 @@
 #ifndef DATASTAX_INTERNAL_PREPARED_HPP
 #define DATASTAX_INTERNAL_PREPARED_HPP
 
+#include "atomic.hpp"
 #include "buffer.hpp"
 #include "dense_hash_map.hpp"
 #include "external.hpp"
@@ -37,7 +38,7 @@ class Prepared : public RefCounted<Prepared> {
 public:
   typedef SharedRefPtr<const Prepared> ConstPtr;
 
-  Prepared(const ResultResponse::Ptr& result, const PrepareRequest::ConstPtr& prepare_request,
+  Prepared(const ResultResponse::ConstPtr& result, const PrepareRequest::ConstPtr& prepare_request,
            const Metadata::SchemaSnapshot& schema_metadata);
 
   const ResultResponse::ConstPtr& result() const { return result_; }
@@ -68,7 +69,8 @@ public:
         : query_(query)
         , keyspace_(keyspace)
         , result_metadata_id_(sizeof(uint16_t) + result_metadata_id.size())
-        , result_(result) {
+        , result_(result)
+        , last_used_ns_(uv_hrtime()) {
       result_metadata_id_.encode_string(0, result_metadata_id.data(),
                                         static_cast<uint16_t>(result_metadata_id.size()));
     }
@@ -78,15 +80,37 @@ public:
     const Buffer& result_metadata_id() const { return result_metadata_id_; }
     const ResultResponse::ConstPtr& result() const { return result_; }
 
+    /**
+     * The last time the prepared statement was executed (or prepared).
+     */
+    uint64_t last_used_ns() const { return last_used_ns_.load(MEMORY_ORDER_RELAXED); }
+
+    /**
+     * Record that the prepared statement was executed. The time is only
+     * updated at a coarse granularity to avoid contention on statements that
+     * are executed frequently from many threads.
+     */
+    void mark_used() const {
+      uint64_t now = uv_hrtime();
+      if (now - last_used_ns_.load(MEMORY_ORDER_RELAXED) > LAST_USED_GRANULARITY_NS) {
+        last_used_ns_.store(now, MEMORY_ORDER_RELAXED);
+      }
+    }
+
+    static const uint64_t LAST_USED_GRANULARITY_NS = 100ULL * 1000 * 1000; // 100 ms
+
   private:
     String query_;
     String keyspace_;
     Buffer result_metadata_id_;
     ResultResponse::ConstPtr result_;
+    mutable Atomic<uint64_t> last_used_ns_;
   };
 
   PreparedMetadata() {
     metadata_.set_empty_key(String());
+    statements_.set_empty_key(String());
+    statements_.set_deleted_key(String(1, '\1'));
     uv_rwlock_init(&rwlock_);
   }
 
@@ -101,9 +125,53 @@ public:
     return Entry::Ptr();
   }
 
+  /**
+   * Get the most recent entry for a query and keyspace.
+   *
+   * @param keyspace The keyspace of the prepared statement's metadata.
+   * @param query The prepared statement's query.
+   * @return The entry or null if the statement isn't prepared.
+   */
+  Entry::Ptr find(const String& keyspace, const String& query) const {
+    ScopedReadLock rl(&rwlock_);
+    Map::const_iterator i = statements_.find(statement_key(keyspace, query));
+    if (i != statements_.end()) {
+      return i->second;
+    }
+    return Entry::Ptr();
+  }
+
   void set(const String& prepared_id, const PreparedMetadata::Entry::Ptr& entry) {
     ScopedWriteLock wl(&rwlock_);
     metadata_[prepared_id] = entry;
+    // Entries from a ROWS result's metadata change can't be used to complete a
+    // prepare so they don't replace the statement's prepared entry.
+    if (entry->result() && entry->result()->kind() == CASS_RESULT_KIND_PREPARED) {
+      statements_[statement_key(entry->keyspace(), entry->query())] = entry;
+    }
+  }
+
+  /**
+   * Remove a keyspace's statements from the index used to find a statement by
+   * its keyspace and query so that they're prepared again instead of reusing
+   * a (possibly stale) result. The entries are still available by prepared ID.
+   *
+   * @param keyspace The name of the keyspace (not quoted).
+   * @return The number of statements removed.
+   */
+  size_t remove_statements(const String& keyspace) {
+    String quoted_keyspace(keyspace);
+    escape_id(quoted_keyspace);
+    ScopedWriteLock wl(&rwlock_);
+    size_t count = 0;
+    for (Map::iterator it = statements_.begin(), end = statements_.end(); it != end; ++it) {
+      const Entry::Ptr& entry(it->second);
+      if (entry->keyspace() == quoted_keyspace || entry->result()->keyspace() == keyspace) {
+        statements_.erase(it); // Doesn't invalidate the iterator
+        ++count;
+      }
+    }
+    return count;
   }
 
   Entry::Vec copy() const {
@@ -116,11 +184,19 @@ public:
     return temp;
   }
 
+  static String statement_key(const String& keyspace, const String& query) {
+    String key(keyspace);
+    key.push_back('\0');
+    key.append(query);
+    return key;
+  }
+
 private:
   typedef DenseHashMap<String, Entry::Ptr> Map;
 
   mutable uv_rwlock_t rwlock_;
   Map metadata_;
+  Map statements_; // Keyed by keyspace and query
 };
 
 }}} // namespace datastax::internal::core
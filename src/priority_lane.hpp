@@ -0,0 +1,89 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_PRIORITY_LANE_HPP
+#define DATASTAX_INTERNAL_PRIORITY_LANE_HPP
+
+#include "cassandra.h"
+
+namespace datastax { namespace internal { namespace core {
+
+enum { NUM_PRIORITY_LANES = CASS_REQUEST_PRIORITY_LAST_ENTRY };
+
+struct PriorityLaneSettings {
+  PriorityLaneSettings()
+      : enabled(false) {
+    weights[CASS_REQUEST_PRIORITY_HIGH] = 16;
+    weights[CASS_REQUEST_PRIORITY_NORMAL] = 4;
+    weights[CASS_REQUEST_PRIORITY_LOW] = 1;
+    for (int i = 0; i < NUM_PRIORITY_LANES; ++i) {
+      max_inflight_requests[i] = 0; // No limit
+    }
+  }
+
+  bool enabled;
+  unsigned weights[NUM_PRIORITY_LANES];
+  unsigned max_inflight_requests[NUM_PRIORITY_LANES];
+};
+
+/**
+ * Selects the next lane to dequeue a request from using smooth weighted
+ * round-robin: over time each ready lane is selected in proportion to its
+ * weight and selections of the same lane are spread out instead of being
+ * dequeued in bursts.
+ */
+class PriorityLaneSelector {
+public:
+  PriorityLaneSelector(const PriorityLaneSettings& settings)
+      : settings_(settings) {
+    for (int i = 0; i < NUM_PRIORITY_LANES; ++i) {
+      current_[i] = 0;
+    }
+  }
+
+  /**
+   * Select the next lane.
+   *
+   * @param is_ready The lanes that have queued requests and are below their
+   * concurrency limit.
+   * @return The selected lane or -1 if no lanes are ready.
+   */
+  int select(const bool* is_ready) {
+    int selected = -1;
+    int total = 0;
+    for (int i = 0; i < NUM_PRIORITY_LANES; ++i) {
+      if (!is_ready[i]) continue;
+      int weight = static_cast<int>(settings_.weights[i]);
+      current_[i] += weight;
+      total += weight;
+      if (selected < 0 || current_[i] > current_[selected]) {
+        selected = i;
+      }
+    }
+    if (selected >= 0) {
+      current_[selected] -= total;
+    }
+    return selected;
+  }
+
+private:
+  const PriorityLaneSettings settings_;
+  int current_[NUM_PRIORITY_LANES];
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
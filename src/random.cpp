@@ -19,7 +19,6 @@
 #include "cassandra.h"
 #include "driver_config.hpp"
 #include "logger.hpp"
-#include "scoped_lock.hpp"
 
 #if defined(_WIN32)
 #ifndef _WINSOCKAPI_
@@ -43,27 +42,28 @@
 
 namespace datastax { namespace internal {
 
-Random::Random()
-    // Use high resolution time if we can't get a real random seed
-    : rng_(get_random_seed(uv_hrtime())) {
-  uv_mutex_init(&mutex_);
-}
-
-Random::~Random() { uv_mutex_destroy(&mutex_); }
-
 uint64_t Random::next(uint64_t max) {
-  ScopedMutex l(&mutex_);
-
   if (max == 0) {
     return 0;
   }
 
+  MT19937_64& r = rng();
   const uint64_t limit = CASS_UINT64_MAX - CASS_UINT64_MAX % max;
-  uint64_t r;
+  uint64_t value;
   do {
-    r = rng_();
-  } while (r >= limit);
-  return r % max;
+    value = r();
+  } while (value >= limit);
+  return value % max;
+}
+
+MT19937_64& Random::rng() {
+  Generator* generator = generators_.get();
+  if (generator == NULL) {
+    // Use high resolution time if we can't get a real random seed
+    generator = new Generator(get_random_seed(uv_hrtime()));
+    generators_.set(generator);
+  }
+  return generator->rng;
 }
 
 #if defined(_WIN32)
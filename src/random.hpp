@@ -18,6 +18,7 @@
 #define DATASTAX_INTERNAL_RANDOM_HPP
 
 #include "allocated.hpp"
+#include "thread_local.hpp"
 #include "third_party/mt19937_64/mt19937_64.hpp"
 
 #include <algorithm>
@@ -25,16 +26,23 @@
 
 namespace datastax { namespace internal {
 
+// Each thread draws from its own generator so that concurrent callers (e.g.
+// load balancing policies on different event loop threads) don't contend.
 class Random : public Allocated {
 public:
-  Random();
-  ~Random();
-
   uint64_t next(uint64_t max);
 
 private:
-  uv_mutex_t mutex_;
-  MT19937_64 rng_;
+  class Generator : public Allocated {
+  public:
+    Generator(uint64_t seed)
+        : rng(seed) {}
+    MT19937_64 rng;
+  };
+
+  MT19937_64& rng();
+
+  ThreadLocal<Generator> generators_;
 };
 
 uint64_t get_random_seed(uint64_t seed);
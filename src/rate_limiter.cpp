@@ -0,0 +1,127 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "rate_limiter.hpp"
+
+#include "get_time.hpp"
+
+#include <algorithm>
+#include <math.h>
+#include <uv.h>
+
+using namespace datastax::internal;
+using namespace datastax::internal::core;
+
+// Refilling more often than this only adds contention on the shared timestamps
+#define MIN_REFILL_INTERVAL_NS (1000LL * 1000LL)
+
+static int64_t max_request_units(int64_t units_per_second) {
+  // Rates under one request per second still need to hold a whole request
+  return units_per_second < RateLimitBudget::UNITS_PER_REQUEST ? RateLimitBudget::UNITS_PER_REQUEST
+                                                                : units_per_second;
+}
+
+static uint64_t wait_time_ns(const TokenBucket& bucket, int64_t units, int64_t units_per_second,
+                             int64_t max_units, const Atomic<uint64_t>& last_refill_ns) {
+  int64_t missing_units = units - bucket.units(max_units);
+  if (missing_units <= 0) return 0;
+  uint64_t now = uv_hrtime();
+  uint64_t ready_ns = last_refill_ns.load(MEMORY_ORDER_RELAXED) +
+                      static_cast<uint64_t>(static_cast<double>(missing_units) *
+                                            NANOSECONDS_PER_SECOND / units_per_second);
+  return ready_ns > now ? ready_ns - now : 0;
+}
+
+RateLimitBudget::RateLimitBudget(const RateLimitSettings& settings)
+    : settings_(settings)
+    , request_units_per_second_(
+          static_cast<int64_t>(settings.requests_per_second * UNITS_PER_REQUEST))
+    , max_request_units_(max_request_units(request_units_per_second_))
+    , max_bytes_(static_cast<int64_t>(settings.bytes_per_second))
+    , last_requests_refill_ns_(uv_hrtime())
+    , last_bytes_refill_ns_(last_requests_refill_ns_.load()) {}
+
+int64_t RateLimitBudget::acquire_requests(int64_t max_requests) {
+  if (settings_.requests_per_second <= 0.0) return max_requests;
+  refill(&requests_, request_units_per_second_, max_request_units_, &last_requests_refill_ns_);
+  for (int64_t requests = max_requests; requests > 0; requests /= 2) {
+    if (requests_.try_acquire(requests * UNITS_PER_REQUEST, max_request_units_)) {
+      return requests;
+    }
+  }
+  return 0;
+}
+
+bool RateLimitBudget::has_bytes() {
+  if (settings_.bytes_per_second == 0) return true;
+  refill(&bytes_, max_bytes_, max_bytes_, &last_bytes_refill_ns_);
+  return bytes_.units(max_bytes_) > 0;
+}
+
+uint64_t RateLimitBudget::request_wait_time_ns() const {
+  if (settings_.requests_per_second <= 0.0) return 0;
+  return wait_time_ns(requests_, UNITS_PER_REQUEST, request_units_per_second_, max_request_units_,
+                      last_requests_refill_ns_);
+}
+
+uint64_t RateLimitBudget::bytes_wait_time_ns() const {
+  if (settings_.bytes_per_second == 0) return 0;
+  return wait_time_ns(bytes_, 1, max_bytes_, max_bytes_, last_bytes_refill_ns_);
+}
+
+void RateLimitBudget::refill(TokenBucket* bucket, int64_t units_per_second, int64_t max_units,
+                             Atomic<uint64_t>* last_refill_ns) {
+  uint64_t now = uv_hrtime();
+  uint64_t last = last_refill_ns->load(MEMORY_ORDER_RELAXED);
+  if (now < last + MIN_REFILL_INTERVAL_NS) return;
+
+  double units = static_cast<double>(now - last) * units_per_second / NANOSECONDS_PER_SECOND;
+  uint64_t next = now;
+  if (units < max_units) {
+    // Only whole units are added, so the timestamp is only advanced by the
+    // time they took to accumulate and the remainder carries over.
+    units = floor(units);
+    if (units < 1.0) return;
+    next = last + static_cast<uint64_t>(units * NANOSECONDS_PER_SECOND / units_per_second);
+  }
+
+  if (!last_refill_ns->compare_exchange_strong(last, next, MEMORY_ORDER_RELAXED)) {
+    return; // Another thread is refilling
+  }
+  bucket->deposit(static_cast<int64_t>(units), max_units);
+}
+
+RateLimiter::RateLimiter(const RateLimitBudget::Ptr& budget)
+    : budget_(budget)
+    // Take about 10ms worth of requests from the shared budget at a time
+    , batch_size_(static_cast<int64_t>(budget->settings().requests_per_second / 100.0) + 1)
+    , requests_(0) {}
+
+bool RateLimiter::try_acquire() {
+  if (!budget_->has_bytes()) return false;
+  if (requests_ == 0) {
+    requests_ = budget_->acquire_requests(batch_size_);
+    if (requests_ == 0) return false;
+  }
+  requests_--;
+  return true;
+}
+
+uint64_t RateLimiter::wait_time_ns() const {
+  uint64_t bytes_wait_ns = budget_->bytes_wait_time_ns();
+  if (requests_ > 0) return bytes_wait_ns;
+  return std::max(budget_->request_wait_time_ns(), bytes_wait_ns);
+}
@@ -0,0 +1,151 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_RATE_LIMITER_HPP
+#define DATASTAX_INTERNAL_RATE_LIMITER_HPP
+
+#include "atomic.hpp"
+#include "macros.hpp"
+#include "ref_counted.hpp"
+#include "token_bucket.hpp"
+
+#include <stdint.h>
+
+namespace datastax { namespace internal { namespace core {
+
+struct RateLimitSettings {
+  RateLimitSettings()
+      : requests_per_second(0.0)
+      , bytes_per_second(0)
+      , queue_excess_requests(true) {}
+
+  bool is_enabled() const { return requests_per_second > 0.0 || bytes_per_second > 0; }
+
+  double requests_per_second; // 0 means no limit
+  uint64_t bytes_per_second;  // 0 means no limit
+  bool queue_excess_requests;
+};
+
+/**
+ * A rate limit budget shared by all the I/O threads of a session. It's
+ * refilled lazily (by the thread that takes units from it) based on the time
+ * elapsed since the last refill and holds at most one second worth of
+ * requests (but at least one request) and bytes. It doesn't use locks.
+ */
+class RateLimitBudget : public RefCounted<RateLimitBudget> {
+public:
+  typedef SharedRefPtr<RateLimitBudget> Ptr;
+
+  static const int64_t UNITS_PER_REQUEST = 1000; // Allow fractional rates
+
+  RateLimitBudget(const RateLimitSettings& settings);
+
+  const RateLimitSettings& settings() const { return settings_; }
+
+  /**
+   * Take up to a number of requests from the budget.
+   *
+   * @param max_requests The maximum number of requests to take.
+   * @return The number of requests taken.
+   */
+  int64_t acquire_requests(int64_t max_requests);
+
+  /**
+   * Take bytes from the budget. The budget can go into debt because the size
+   * of a request is only known after it's been admitted.
+   */
+  void withdraw_bytes(int64_t bytes) { bytes_.withdraw(bytes, max_bytes_); }
+
+  bool has_bytes();
+
+  /**
+   * The time until a request can be taken from the budget.
+   *
+   * @return The time in nanoseconds or 0 if a request is available.
+   */
+  uint64_t request_wait_time_ns() const;
+
+  /**
+   * The time until the budget is out of debt for bytes.
+   *
+   * @return The time in nanoseconds or 0 if bytes are available.
+   */
+  uint64_t bytes_wait_time_ns() const;
+
+private:
+  static void refill(TokenBucket* bucket, int64_t units_per_second, int64_t max_units,
+                     Atomic<uint64_t>* last_refill_ns);
+
+private:
+  const RateLimitSettings settings_;
+  const int64_t request_units_per_second_;
+  const int64_t max_request_units_;
+  const int64_t max_bytes_;
+  TokenBucket requests_;
+  TokenBucket bytes_;
+  Atomic<uint64_t> last_requests_refill_ns_;
+  Atomic<uint64_t> last_bytes_refill_ns_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(RateLimitBudget);
+};
+
+/**
+ * An I/O thread's rate limiter. It takes requests from the shared budget in
+ * small batches so that most requests are admitted without touching the
+ * shared budget. It must only be used on its I/O thread.
+ */
+class RateLimiter : public RefCounted<RateLimiter> {
+public:
+  typedef SharedRefPtr<RateLimiter> Ptr;
+
+  RateLimiter(const RateLimitBudget::Ptr& budget);
+
+  const RateLimitSettings& settings() const { return budget_->settings(); }
+
+  /**
+   * Admit a request.
+   *
+   * @return false if the rate limit has been reached.
+   */
+  bool try_acquire();
+
+  /**
+   * Record the number of bytes written for a request.
+   */
+  void record_bytes(int32_t bytes) {
+    if (settings().bytes_per_second > 0) budget_->withdraw_bytes(bytes);
+  }
+
+  /**
+   * The time until a request can be admitted.
+   *
+   * @return The time in nanoseconds or 0 if a request can be admitted now.
+   */
+  uint64_t wait_time_ns() const;
+
+private:
+  RateLimitBudget::Ptr budget_;
+  const int64_t batch_size_;
+  int64_t requests_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(RateLimiter);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
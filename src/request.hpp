@@ -64,10 +64,12 @@ struct RequestSettings {
       : consistency(CASS_CONSISTENCY_UNKNOWN)
       , serial_consistency(CASS_CONSISTENCY_UNKNOWN)
       , request_timeout_ms(CASS_UINT64_MAX)
+      , priority(CASS_REQUEST_PRIORITY_UNKNOWN)
       , is_idempotent(false) {}
   CassConsistency consistency;
   CassConsistency serial_consistency;
   uint64_t request_timeout_ms;
+  CassRequestPriority priority;
   RetryPolicy::Ptr retry_policy;
   bool is_idempotent;
   String keyspace;
@@ -89,6 +91,7 @@ public:
       : opcode_(opcode)
       , flags_(0)
       , timestamp_(CASS_INT64_MIN)
+      , deadline_ms_(0)
       , record_attempted_addresses_(false) {}
 
   virtual ~Request() {}
@@ -121,6 +124,10 @@ public:
 
   uint64_t request_timeout_ms() const { return settings_.request_timeout_ms; }
 
+  CassRequestPriority priority() const { return settings_.priority; }
+
+  void set_priority(CassRequestPriority priority) { settings_.priority = priority; }
+
   void set_request_timeout_ms(uint64_t request_timeout_ms) {
     settings_.request_timeout_ms = request_timeout_ms;
   }
@@ -145,6 +152,12 @@ public:
 
   void set_timestamp(int64_t timestamp) { timestamp_ = timestamp; }
 
+  // The absolute deadline in milliseconds since the Unix epoch (0 means no
+  // deadline).
+  uint64_t deadline_ms() const { return deadline_ms_; }
+
+  void set_deadline_ms(uint64_t deadline_ms) { deadline_ms_ = deadline_ms; }
+
   bool record_attempted_addresses() const { return record_attempted_addresses_; }
 
   void set_record_attempted_addresses(bool record_attempted_addresses) {
@@ -194,6 +207,7 @@ private:
   uint8_t flags_;
   RequestSettings settings_;
   int64_t timestamp_;
+  uint64_t deadline_ms_;
   bool record_attempted_addresses_;
   CustomPayload::ConstPtr custom_payload_;
   CustomPayload custom_payload_extra_;
@@ -22,11 +22,13 @@
 #include "constants.hpp"
 #include "error_response.hpp"
 #include "execute_request.hpp"
+#include "get_time.hpp"
 #include "metrics.hpp"
 #include "prepare_request.hpp"
 #include "protocol.hpp"
 #include "response.hpp"
 #include "result_response.hpp"
+#include "retry_budget.hpp"
 #include "row.hpp"
 #include "session.hpp"
 
@@ -50,6 +52,26 @@ static String to_hex(const String& byte_id) {
   return ss.str();
 }
 
+// Determines if a response indicates that the host itself is unhealthy. This
+// includes responses that arrive after the request has timed out.
+static bool is_host_failure(ResponseMessage* response, uint64_t latency_ns,
+                            uint64_t request_timeout_ms) {
+  if (request_timeout_ms > 0 && latency_ns >= request_timeout_ms * 1000 * 1000) {
+    return true;
+  }
+  if (response->opcode() == CQL_OPCODE_ERROR) {
+    switch (static_cast<ErrorResponse*>(response->response_body().get())->code()) {
+      case CQL_ERROR_OVERLOADED:
+      case CQL_ERROR_SERVER_ERROR:
+      case CQL_ERROR_IS_BOOTSTRAPPING:
+        return true;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
 class SingleHostQueryPlan : public QueryPlan {
 public:
   SingleHostQueryPlan(const Address& address)
@@ -151,21 +173,34 @@ public:
     return false;
   }
 
-  virtual void on_done() {}
+  virtual void on_done(RequestHandler* request_handler) {}
 };
 
 static NopRequestListener nop_request_listener__;
 
 RequestHandler::RequestHandler(const Request::ConstPtr& request, const ResponseFuture::Ptr& future,
-                               Metrics* metrics)
+                               Metrics* metrics, RetryBudget* retry_budget)
     : wrapper_(request)
     , future_(future)
     , is_done_(false)
     , running_executions_(0)
+    , priority_(CASS_REQUEST_PRIORITY_NORMAL)
     , start_time_ns_(uv_hrtime())
+    , deadline_ns_(0)
+    , is_deadline_explicit_(false)
     , listener_(&nop_request_listener__)
     , manager_(NULL)
-    , metrics_(metrics) {}
+    , metrics_(metrics)
+    , retry_budget_(retry_budget) {
+  uint64_t deadline_ms = request->deadline_ms();
+  if (deadline_ms > 0) {
+    // Convert the wall clock deadline to the monotonic clock
+    uint64_t now_us = get_time_since_epoch_us();
+    uint64_t deadline_us = deadline_ms * 1000;
+    deadline_ns_ = start_time_ns_ + (deadline_us > now_us ? (deadline_us - now_us) * 1000 : 0);
+    is_deadline_explicit_ = true;
+  }
+}
 
 RequestHandler::~RequestHandler() {
   if (Logger::log_level() >= CASS_LOG_TRACE) {
@@ -195,6 +230,22 @@ void RequestHandler::init(const ExecutionProfile& profile, ConnectionPoolManager
   manager_ = manager;
   listener_ = listener ? listener : &nop_request_listener__;
   wrapper_.init(profile, timestamp_generator);
+  rate_limiter_ = profile.rate_limiter();
+
+  // The request timeout is counted from when the request was executed so that
+  // the time spent waiting in the request queue is included.
+  uint64_t request_timeout_ms = wrapper_.request_timeout_ms();
+  if (request_timeout_ms > 0) { // 0 means no timeout
+    uint64_t timeout_deadline_ns = start_time_ns_ + request_timeout_ms * 1000 * 1000;
+    if (deadline_ns_ == 0 || timeout_deadline_ns < deadline_ns_) {
+      deadline_ns_ = timeout_deadline_ns;
+      is_deadline_explicit_ = false;
+    }
+  }
+
+  if (retry_budget_) {
+    retry_budget_->on_request();
+  }
 
   // Attempt to use the statement's keyspace first then if not set then use the session's keyspace
   const String& keyspace(!request()->keyspace().empty() ? request()->keyspace()
@@ -212,6 +263,29 @@ void RequestHandler::init(const ExecutionProfile& profile, ConnectionPoolManager
       profile.speculative_execution_policy()->new_plan(keyspace, wrapper_.request().get()));
 }
 
+bool RequestHandler::get_singleflight_key(String* key) const {
+  const Request* request = this->request();
+  if (request->opcode() != CQL_OPCODE_EXECUTE || !request->is_idempotent() || request->host() ||
+      (request->flags() & CASS_FLAG_TRACING) || request->has_custom_payload()) {
+    return false;
+  }
+  const ExecuteRequest* execute_request = static_cast<const ExecuteRequest*>(request);
+  if (!execute_request->is_read() ||
+      !execute_request->get_singleflight_key(wrapper_.consistency(),
+                                             wrapper_.serial_consistency(), key)) {
+    return false;
+  }
+  // Requests using different execution profiles can have different policies
+  key->append(request->execution_profile_name());
+  return true;
+}
+
+void RequestHandler::add_follower(const Ptr& request_handler, uv_loop_t* loop) {
+  // The follower fails on its own deadline if this request takes longer
+  request_handler->start_timer(loop);
+  followers_.push_back(request_handler);
+}
+
 void RequestHandler::execute() {
   RequestExecution::Ptr request_execution(new RequestExecution(this));
   running_executions_++;
@@ -222,12 +296,13 @@ void RequestHandler::retry(RequestExecution* request_execution, Protected) {
   internal_retry(request_execution);
 }
 
-void RequestHandler::start_request(uv_loop_t* loop, Protected) {
-  if (!timer_.is_running()) {
-    uint64_t request_timeout_ms = wrapper_.request_timeout_ms();
-    if (request_timeout_ms > 0) { // 0 means no timeout
-      timer_.start(loop, request_timeout_ms, bind_callback(&RequestHandler::on_timeout, this));
-    }
+void RequestHandler::start_request(uv_loop_t* loop, Protected) { start_timer(loop); }
+
+void RequestHandler::start_timer(uv_loop_t* loop) {
+  if (!timer_.is_running() && deadline_ns_ > 0) {
+    uint64_t now = uv_hrtime();
+    uint64_t timeout_ms = deadline_ns_ > now ? (deadline_ns_ - now + 999999) / (1000 * 1000) : 0;
+    timer_.start(loop, timeout_ms, bind_callback(&RequestHandler::on_timeout, this));
   }
 }
 
@@ -237,6 +312,34 @@ int64_t RequestHandler::next_execution(const Host::Ptr& current_host, Protected)
   return execution_plan_->next_execution(current_host);
 }
 
+bool RequestHandler::allow_execution(Protected) { return execution_plan_->allow_execution(); }
+
+void RequestHandler::record_latency(const Host::Ptr& current_host, uint64_t latency_ns,
+                                    Protected) {
+  execution_plan_->record_latency(current_host, latency_ns);
+}
+
+void RequestHandler::record_host_request(const Host::Ptr& current_host, Protected) {
+  if (retry_budget_) {
+    retry_budget_->on_host_request(current_host.get());
+  }
+}
+
+bool RequestHandler::acquire_retry(const Host::Ptr& current_host, Protected) {
+  if (retry_budget_ && !retry_budget_->acquire(current_host.get())) {
+    if (metrics_) {
+      metrics_->throttled_retries.inc();
+    }
+    LOG_DEBUG("Retry budget exhausted for request (%p) on host %s", static_cast<void*>(this),
+              current_host ? current_host->address_string().c_str() : "<unknown>");
+    return false;
+  }
+  if (metrics_) {
+    metrics_->retries.inc();
+  }
+  return true;
+}
+
 void RequestHandler::add_attempted_address(const Address& address, Protected) {
   future_->add_attempted_address(address);
 }
@@ -291,6 +394,13 @@ void RequestHandler::set_response(const Host::Ptr& host, const Response::Ptr& re
   if (Logger::log_level() >= CASS_LOG_TRACE) {
     request_tries_.push_back(RequestTry(host->address(), uv_hrtime() - start_time_ns_));
   }
+
+  // Fan out the response to the duplicate requests
+  for (Vector<Ptr>::const_iterator it = followers_.begin(), end = followers_.end(); it != end;
+       ++it) {
+    if (!(*it)->is_done_) (*it)->set_response(host, response);
+  }
+  followers_.clear();
 }
 
 void RequestHandler::set_error(CassError code, const String& message) {
@@ -298,6 +408,11 @@ void RequestHandler::set_error(CassError code, const String& message) {
   bool skip = (code == CASS_ERROR_LIB_NO_HOSTS_AVAILABLE && --running_executions_ > 0);
   if (!skip) {
     future_->set_error(code, message);
+    for (Vector<Ptr>::const_iterator it = followers_.begin(), end = followers_.end(); it != end;
+         ++it) {
+      if (!(*it)->is_done_) (*it)->set_error(code, message);
+    }
+    followers_.clear();
   }
 }
 
@@ -307,6 +422,11 @@ void RequestHandler::set_error(const Host::Ptr& host, CassError code, const Stri
   if (!skip) {
     if (host) {
       future_->set_error_with_address(host->address(), code, message);
+      for (Vector<Ptr>::const_iterator it = followers_.begin(), end = followers_.end(); it != end;
+           ++it) {
+        if (!(*it)->is_done_) (*it)->set_error(host, code, message);
+      }
+      followers_.clear();
     } else {
       set_error(code, message);
     }
@@ -322,6 +442,11 @@ void RequestHandler::set_error_with_error_response(const Host::Ptr& host,
   stop_request();
   running_executions_--;
   future_->set_error_with_response(host->address(), error, code, message);
+  for (Vector<Ptr>::const_iterator it = followers_.begin(), end = followers_.end(); it != end;
+       ++it) {
+    if (!(*it)->is_done_) (*it)->set_error_with_error_response(host, error, code, message);
+  }
+  followers_.clear();
   if (Logger::log_level() >= CASS_LOG_TRACE) {
     request_tries_.push_back(RequestTry(host->address(), code));
   }
@@ -329,17 +454,29 @@ void RequestHandler::set_error_with_error_response(const Host::Ptr& host,
 
 void RequestHandler::stop_timer() { timer_.stop(); }
 
-void RequestHandler::on_timeout(Timer* timer) {
+void RequestHandler::on_timeout(WheelTimer* timer) { set_expired_error(NULL); }
+
+bool RequestHandler::is_expired() const { return deadline_ns_ > 0 && uv_hrtime() >= deadline_ns_; }
+
+void RequestHandler::set_expired_error(const char* message) {
   if (metrics_) {
     metrics_->request_timeouts.inc();
   }
-  set_error(CASS_ERROR_LIB_REQUEST_TIMED_OUT, "Request timed out");
-  LOG_DEBUG("Request timed out");
+  if (is_deadline_explicit_) {
+    set_error(CASS_ERROR_LIB_REQUEST_DEADLINE_EXCEEDED,
+              message ? String("Request deadline exceeded ") + message
+                      : String("Request deadline exceeded"));
+    LOG_DEBUG("Request deadline exceeded");
+  } else {
+    set_error(CASS_ERROR_LIB_REQUEST_TIMED_OUT,
+              message ? String("Request timed out ") + message : String("Request timed out"));
+    LOG_DEBUG("Request timed out");
+  }
 }
 
 void RequestHandler::stop_request() {
   if (!is_done_) {
-    listener_->on_done();
+    listener_->on_done(this);
     is_done_ = true;
   }
   timer_.stop();
@@ -355,14 +492,34 @@ void RequestHandler::internal_retry(RequestExecution* request_execution) {
     return;
   }
 
+  // Drop expired requests before they take up a stream and server capacity.
+  // This covers requests that waited in the request queue, retries and
+  // speculative executions.
+  if (is_expired()) {
+    LOG_DEBUG("Dropping expired request (%p)", static_cast<void*>(this));
+    set_expired_error("before it was sent");
+    return;
+  }
+
   bool is_done = false;
+  bool is_limited = false;
   while (!is_done && request_execution->current_host()) {
+    if (request_execution->current_host()->is_at_concurrency_limit()) {
+      // Too many in-flight requests on the current host, move to the next host.
+      is_limited = true;
+      request_execution->next_host();
+      continue;
+    }
+
     PooledConnection::Ptr connection =
         manager_->find_least_busy(request_execution->current_host()->address());
     if (connection) {
       int32_t result = connection->write(request_execution);
 
       if (result > 0) {
+        if (rate_limiter_) {
+          rate_limiter_->record_bytes(result);
+        }
         is_done = true;
       } else {
         switch (result) {
@@ -403,8 +560,14 @@ void RequestHandler::internal_retry(RequestExecution* request_execution) {
   }
 
   if (!request_execution->current_host()) {
-    set_error(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, "All hosts in current policy attempted "
-                                                 "and were either unavailable or failed");
+    if (is_limited) {
+      set_error(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, "All hosts in current policy attempted "
+                                                   "and were either unavailable, failed or "
+                                                   "at their concurrency limit");
+    } else {
+      set_error(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, "All hosts in current policy attempted "
+                                                   "and were either unavailable or failed");
+    }
   }
 }
 
@@ -413,14 +576,26 @@ RequestExecution::RequestExecution(RequestHandler* request_handler)
     , request_handler_(request_handler)
     , current_host_(request_handler->next_host(RequestHandler::Protected()))
     , num_retries_(0)
-    , start_time_ns_(uv_hrtime()) {}
+    , start_time_ns_(uv_hrtime())
+    , is_inflight_(false) {}
 
-void RequestExecution::on_execute_next(Timer* timer) { request_handler_->execute(); }
+void RequestExecution::on_execute_next(WheelTimer* timer) {
+  if (request_handler_->allow_execution(RequestHandler::Protected())) {
+    request_handler_->execute();
+  }
+}
 
 void RequestExecution::on_retry_current_host() { retry_current_host(); }
 
 void RequestExecution::on_retry_next_host() {
-  if (current_host_) current_host_->decrement_inflight_requests();
+  // The host already answered the request (e.g. with an UNPREPARED error) so
+  // this only releases its in-flight slot if that hasn't been done yet.
+  release_inflight_request();
+  if (!request_handler_->acquire_retry(current_host_, RequestHandler::Protected())) {
+    set_error(CASS_ERROR_LIB_RETRY_BUDGET_EXHAUSTED,
+              "Unable to retry the request on the next host (retry budget exhausted)");
+    return;
+  }
   retry_next_host();
 }
 
@@ -439,6 +614,8 @@ void RequestExecution::retry_next_host() {
 void RequestExecution::on_write(Connection* connection) {
   assert(current_host_ && "Tried to start on a non-existent host");
   current_host_->increment_inflight_requests();
+  is_inflight_ = true;
+  request_handler_->record_host_request(current_host_, RequestHandler::Protected());
   connection_ = connection;
   if (request()->record_attempted_addresses()) {
     request_handler_->add_attempted_address(current_host_->address(), RequestHandler::Protected());
@@ -447,7 +624,9 @@ void RequestExecution::on_write(Connection* connection) {
   if (request()->is_idempotent()) {
     int64_t timeout = request_handler_->next_execution(current_host_, RequestHandler::Protected());
     if (timeout == 0) {
-      request_handler_->execute();
+      if (request_handler_->allow_execution(RequestHandler::Protected())) {
+        request_handler_->execute();
+      }
     } else if (timeout > 0) {
       schedule_timer_.start(connection->loop(), timeout,
                             bind_callback(&RequestExecution::on_execute_next, this));
@@ -459,7 +638,12 @@ void RequestExecution::on_set(ResponseMessage* response) {
   assert(connection_ != NULL);
   assert(current_host_ && "Tried to set on a non-existent host");
 
-  current_host_->decrement_inflight_requests();
+  release_inflight_request();
+  uint64_t latency_ns = uv_hrtime() - start_time_ns_;
+  bool is_failure = is_host_failure(response, latency_ns, request_timeout_ms());
+  current_host_->update_peak_ewma(latency_ns);
+  current_host_->update_concurrency_limit(latency_ns, is_failure);
+  current_host_->record_request_result(is_failure);
   Connection* connection = connection_;
 
   switch (response->opcode()) {
@@ -477,10 +661,21 @@ void RequestExecution::on_set(ResponseMessage* response) {
 }
 
 void RequestExecution::on_error(CassError code, const String& message) {
-  if (current_host_) current_host_->decrement_inflight_requests();
+  if (release_inflight_request() &&
+      (code == CASS_ERROR_LIB_WRITE_ERROR || code == CASS_ERROR_LIB_REQUEST_TIMED_OUT)) {
+    current_host_->update_concurrency_limit(uv_hrtime() - start_time_ns_, true);
+    current_host_->record_request_result(true);
+  }
   set_error(code, message);
 }
 
+bool RequestExecution::release_inflight_request() {
+  if (!is_inflight_) return false;
+  is_inflight_ = false;
+  current_host_->decrement_inflight_requests();
+  return true;
+}
+
 void RequestExecution::notify_result_metadata_changed(const Request* request,
                                                       ResultResponse* result_response) {
   // Attempt to use the per-query keyspace first (v5+/DSEv2+ only) then
@@ -636,6 +831,12 @@ void RequestExecution::on_error_response(Connection* connection, ResponseMessage
       break;
   }
 
+  // Retries are limited by the retry budget (if enabled)
+  if (decision.type() == RetryPolicy::RetryDecision::RETRY &&
+      !request_handler_->acquire_retry(current_host_, RequestHandler::Protected())) {
+    decision = RetryPolicy::RetryDecision::return_error();
+  }
+
   // Process retry decision
   switch (decision.type()) {
     case RetryPolicy::RetryDecision::RETURN_ERROR:
@@ -692,6 +893,8 @@ void RequestExecution::on_error_unprepared(Connection* connection, ErrorResponse
 }
 
 void RequestExecution::set_response(const Response::Ptr& response) {
+  request_handler_->record_latency(current_host_, uv_hrtime() - start_time_ns_,
+                                   RequestHandler::Protected());
   request_handler_->set_response(current_host_, response);
 }
 
@@ -24,6 +24,7 @@
 #include "load_balancing.hpp"
 #include "metadata.hpp"
 #include "prepare_request.hpp"
+#include "rate_limiter.hpp"
 #include "request.hpp"
 #include "request_callback.hpp"
 #include "response.hpp"
@@ -34,6 +35,7 @@
 #include "speculative_execution.hpp"
 #include "string.hpp"
 #include "timestamp_generator.hpp"
+#include "timing_wheel.hpp"
 
 #include <uv.h>
 
@@ -43,8 +45,9 @@ class Config;
 class Connection;
 class ConnectionPoolManager;
 class Pool;
+class RetryBudget;
 class ExecutionProfile;
-class Timer;
+class WheelTimer;
 class TokenMap;
 
 struct RequestTry {
@@ -80,7 +83,7 @@ public:
       : Future(FUTURE_TYPE_RESPONSE)
       , schema_metadata(new Metadata::SchemaSnapshot(schema_metadata)) {}
 
-  bool set_response(Address address, const Response::Ptr& response) {
+  bool set_response(Address address, const Response::ConstPtr& response) {
     ScopedMutex lock(&mutex_);
     if (!is_set()) {
       address_ = address;
@@ -91,7 +94,7 @@ public:
     return false;
   }
 
-  const Response::Ptr& response() {
+  const Response::ConstPtr& response() {
     ScopedMutex lock(&mutex_);
     internal_wait(lock);
     return response_;
@@ -107,7 +110,7 @@ public:
     return false;
   }
 
-  bool set_error_with_response(Address address, const Response::Ptr& response, CassError code,
+  bool set_error_with_response(Address address, const Response::ConstPtr& response, CassError code,
                                const String& message) {
     ScopedMutex lock(&mutex_);
     if (!is_set()) {
@@ -145,7 +148,7 @@ private:
 
 private:
   Address address_;
-  Response::Ptr response_;
+  Response::ConstPtr response_;
   AddressVec attempted_addresses_;
 };
 
@@ -159,7 +162,7 @@ public:
   typedef SharedRefPtr<RequestHandler> Ptr;
 
   RequestHandler(const Request::ConstPtr& request, const ResponseFuture::Ptr& future,
-                 Metrics* metrics = NULL);
+                 Metrics* metrics = NULL, RetryBudget* retry_budget = NULL);
   ~RequestHandler();
 
   void set_prepared_metadata(const PreparedMetadata::Entry::Ptr& entry);
@@ -170,6 +173,30 @@ public:
 
   void execute();
 
+  CassRequestPriority priority() const { return priority_; }
+  void set_priority(CassRequestPriority priority) { priority_ = priority; }
+
+  /**
+   * Get the key used to coalesce identical reads. Only idempotent reads of
+   * prepared statements can be coalesced.
+   *
+   * @param key The resulting key.
+   * @return false if the request can't be coalesced.
+   */
+  bool get_singleflight_key(String* key) const;
+
+  const String& singleflight_key() const { return singleflight_key_; }
+  void set_singleflight_key(const String& key) { singleflight_key_ = key; }
+
+  /**
+   * Add a request that receives the result of this request instead of being
+   * executed itself. The duplicate request's own timeout is started.
+   *
+   * @param request_handler The duplicate request.
+   * @param loop The event loop used for the duplicate request's timer.
+   */
+  void add_follower(const Ptr& request_handler, uv_loop_t* loop);
+
   const RequestWrapper& wrapper() const { return wrapper_; }
   const Request* request() const { return wrapper_.request().get(); }
   CassConsistency consistency() const { return wrapper_.consistency(); }
@@ -185,6 +212,10 @@ public:
 
   Host::Ptr next_host(Protected);
   int64_t next_execution(const Host::Ptr& current_host, Protected);
+  bool allow_execution(Protected);
+  void record_latency(const Host::Ptr& current_host, uint64_t latency_ns, Protected);
+  void record_host_request(const Host::Ptr& current_host, Protected);
+  bool acquire_retry(const Host::Ptr& current_host, Protected);
 
   void start_request(uv_loop_t* loop, Protected);
 
@@ -211,10 +242,13 @@ public:
   void stop_timer();
 
 private:
-  void on_timeout(Timer* timer);
+  void on_timeout(WheelTimer* timer);
 
 private:
+  void start_timer(uv_loop_t* loop);
   void stop_request();
+  bool is_expired() const;
+  void set_expired_error(const char* message);
   void internal_retry(RequestExecution* request_execution);
 
 private:
@@ -223,18 +257,26 @@ private:
 
   bool is_done_;
   int running_executions_;
+  CassRequestPriority priority_;
 
   ScopedPtr<QueryPlan> query_plan_;
   ScopedPtr<SpeculativeExecutionPlan> execution_plan_;
-  Timer timer_;
+  WheelTimer timer_;
 
   const uint64_t start_time_ns_;
+  uint64_t deadline_ns_; // 0 means no deadline
+  bool is_deadline_explicit_;
   RequestListener* listener_;
   ConnectionPoolManager* manager_;
 
   Metrics* const metrics_;
+  RetryBudget* const retry_budget_;
+  RateLimiter::Ptr rate_limiter_;
 
   RequestTryVec request_tries_;
+
+  String singleflight_key_;
+  Vector<Ptr> followers_;
 };
 
 class KeyspaceChangedResponse {
@@ -285,7 +327,7 @@ public:
   virtual bool on_prepare_all(const RequestHandler::Ptr& request_handler,
                               const Host::Ptr& current_host, const Response::Ptr& response) = 0;
 
-  virtual void on_done() = 0;
+  virtual void on_done(RequestHandler* request_handler) = 0;
 };
 
 class RequestExecution : public RequestCallback {
@@ -304,7 +346,7 @@ public:
   virtual void on_retry_next_host();
 
 private:
-  void on_execute_next(Timer* timer);
+  void on_execute_next(WheelTimer* timer);
 
   void retry_current_host();
   void retry_next_host();
@@ -318,6 +360,8 @@ private:
   void on_error_response(Connection* connection, ResponseMessage* response);
   void on_error_unprepared(Connection* connection, ErrorResponse* error);
 
+  bool release_inflight_request();
+
 private:
   void set_response(const Response::Ptr& response);
   void set_error(CassError code, const String& message);
@@ -328,9 +372,10 @@ private:
   RequestHandler::Ptr request_handler_;
   Host::Ptr current_host_;
   Connection* connection_;
-  Timer schedule_timer_;
+  WheelTimer schedule_timer_;
   int num_retries_;
   const uint64_t start_time_ns_;
+  bool is_inflight_; // Holds one of the current host's in-flight request slots
 };
 
 }}} // namespace datastax::internal::core
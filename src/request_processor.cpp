@@ -17,9 +17,11 @@
 #include "request_processor.hpp"
 
 #include "connection_pool_manager_initializer.hpp"
+#include "get_time.hpp"
 #include "prepare_all_handler.hpp"
 #include "request_processor.hpp"
 #include "session.hpp"
+#include "small_vector.hpp"
 #include "tracing_data_handler.hpp"
 #include "utils.hpp"
 
@@ -146,7 +148,8 @@ RequestProcessorSettings::RequestProcessorSettings()
     , max_tracing_wait_time_ms(CASS_DEFAULT_MAX_TRACING_DATA_WAIT_TIME_MS)
     , retry_tracing_wait_time_ms(CASS_DEFAULT_RETRY_TRACING_DATA_WAIT_TIME_MS)
     , tracing_consistency(CASS_DEFAULT_TRACING_CONSISTENCY)
-    , address_factory(new DefaultAddressFactory()) {
+    , address_factory(new DefaultAddressFactory())
+    , saturated_host_tracker(new SaturatedHostTracker()) {
   profiles.set_empty_key("");
 }
 
@@ -163,7 +166,10 @@ RequestProcessorSettings::RequestProcessorSettings(const Config& config)
     , max_tracing_wait_time_ms(config.max_tracing_wait_time_ms())
     , retry_tracing_wait_time_ms(config.retry_tracing_wait_time_ms())
     , tracing_consistency(config.tracing_consistency())
-    , address_factory(create_address_factory_from_config(config)) {}
+    , address_factory(create_address_factory_from_config(config))
+    , concurrency_limiter_settings(config.concurrency_limiter_settings())
+    , saturated_host_tracker(new SaturatedHostTracker())
+    , priority_lane_settings(config.priority_lane_settings()) {}
 
 RequestProcessor::RequestProcessor(RequestProcessorListener* listener, EventLoop* event_loop,
                                    const ConnectionPoolManager::Ptr& connection_pool_manager,
@@ -178,7 +184,7 @@ RequestProcessor::RequestProcessor(RequestProcessorListener* listener, EventLoop
     , default_profile_(settings.default_profile)
     , profiles_(settings.profiles)
     , request_count_(0)
-    , request_queue_(new MPMCQueue<RequestHandler*>(settings.request_queue_size))
+    , lane_selector_(settings.priority_lane_settings)
     , is_closing_(false)
     , is_processing_(false)
     , attempts_without_requests_(0)
@@ -190,14 +196,35 @@ RequestProcessor::RequestProcessor(RequestProcessorListener* listener, EventLoop
     , reads_per_("reads")
 #endif
 {
+  for (int i = 0; i < NUM_PRIORITY_LANES; ++i) {
+    if (settings_.priority_lane_settings.enabled || i == CASS_REQUEST_PRIORITY_NORMAL) {
+      request_queues_[i].reset(new MPMCQueue<RequestHandler*>(settings_.request_queue_size));
+    }
+    lane_inflight_requests_[i] = 0;
+  }
+
+  singleflight_requests_.set_empty_key(String());
+  singleflight_requests_.set_deleted_key(String(1, '\0'));
+
   inc_ref(); // For the connection pool manager
   connection_pool_manager_->set_listener(this);
 
-  // Build/Assign the load balancing policies from the execution profiles
+  // Build/Assign the load balancing policies and rate limiters from the
+  // execution profiles
   default_profile_.build_load_balancing_policy();
+  default_profile_.build_rate_limiter();
   load_balancing_policies_.push_back(default_profile_.load_balancing_policy());
+  if (default_profile_.rate_limiter()) {
+    throttled_requests_.push_back(ThrottledRequests());
+    throttled_requests_.back().rate_limiter = default_profile_.rate_limiter();
+  }
   for (ExecutionProfile::Map::iterator it = profiles_.begin(), end = profiles_.end(); it != end;
        ++it) {
+    it->second.build_rate_limiter();
+    if (it->second.rate_limiter()) {
+      throttled_requests_.push_back(ThrottledRequests());
+      throttled_requests_.back().rate_limiter = it->second.rate_limiter();
+    }
     it->second.build_load_balancing_policy();
     const LoadBalancingPolicy::Ptr& load_balancing_policy = it->second.load_balancing_policy();
     if (load_balancing_policy) {
@@ -216,6 +243,18 @@ RequestProcessor::RequestProcessor(RequestProcessorListener* listener, EventLoop
     (*it)->init(connected_host, hosts, random, local_dc);
   }
 
+  if (settings_.concurrency_limiter_settings.enabled) {
+    for (HostMap::const_iterator it = hosts.begin(), end = hosts.end(); it != end; ++it) {
+      if (!is_host_ignored(policies, it->second)) {
+        it->second->enable_concurrency_limiter(settings_.concurrency_limiter_settings,
+                                               settings_.saturated_host_tracker);
+        if (connection_pool_manager_->has_connections(it->first)) {
+          limited_hosts_.insert(it->first);
+        }
+      }
+    }
+  }
+
   listener_->on_connect(this);
 }
 
@@ -258,9 +297,10 @@ void RequestProcessor::notify_token_map_updated(const TokenMap::Ptr& token_map)
 }
 
 void RequestProcessor::process_request(const RequestHandler::Ptr& request_handler) {
+  request_handler->set_priority(priority(request_handler.get()));
   request_handler->inc_ref(); // Queue reference
 
-  if (request_queue_->enqueue(request_handler.get())) {
+  if (request_queues_[request_handler->priority()]->enqueue(request_handler.get())) {
     request_count_.fetch_add(1);
     // Only signal the request queue if it's not already processing requests.
     bool expected = false;
@@ -275,16 +315,66 @@ void RequestProcessor::process_request(const RequestHandler::Ptr& request_handle
   }
 }
 
+void RequestProcessor::process_requests(const RequestHandler::Ptr* request_handlers,
+                                        size_t count) {
+  if (count == 0) return;
+
+  if (settings_.priority_lane_settings.enabled) {
+    // The requests can belong to different lanes
+    for (size_t i = 0; i < count; ++i) {
+      process_request(request_handlers[i]);
+    }
+    return;
+  }
+
+  SmallVector<RequestHandler*, 64> entries(count);
+  for (size_t i = 0; i < count; ++i) {
+    entries[i] = request_handlers[i].get();
+    entries[i]->inc_ref(); // Queue reference
+  }
+
+  size_t enqueued =
+      request_queues_[CASS_REQUEST_PRIORITY_NORMAL]->enqueue_bulk(&entries[0], count);
+  if (enqueued > 0) {
+    request_count_.fetch_add(enqueued);
+    // Only signal the request queue if it's not already processing requests.
+    bool expected = false;
+    if (!is_processing_.load(MEMORY_ORDER_RELAXED) &&
+        is_processing_.compare_exchange_strong(expected, true)) {
+      async_.send();
+    }
+  }
+
+  for (size_t i = enqueued; i < count; ++i) {
+    entries[i]->dec_ref();
+    entries[i]->set_error(CASS_ERROR_LIB_REQUEST_QUEUE_FULL,
+                          "The request queue has reached capacity");
+  }
+}
+
 int RequestProcessor::init(Protected) {
   int rc = async_.start(event_loop_->loop(), bind_callback(&RequestProcessor::on_async, this));
   if (rc != 0) return rc;
+  if (settings_.concurrency_limiter_settings.enabled) {
+    settings_.saturated_host_tracker->add_listener(this);
+  }
   return prepare_.start(event_loop_->loop(), bind_callback(&RequestProcessor::on_prepare, this));
 }
 
+void RequestProcessor::connect_deferred_hosts(const HostMap& hosts, Protected) {
+  for (HostMap::const_iterator it = hosts.begin(), end = hosts.end(); it != end; ++it) {
+    connection_pool_manager_->add(it->second);
+  }
+}
+
 void RequestProcessor::on_pool_up(const Address& address) {
   // Don't immediately update the load balancing policies. Give the listener
   // a chance to process the up status and it should call `notify_host_ready()`
   // when it's ready.
+  if (settings_.concurrency_limiter_settings.enabled) {
+    limited_hosts_.insert(address);
+    on_host_unsaturated(); // The new host has capacity
+  }
   listener_->on_pool_up(address);
 }
 
@@ -308,9 +398,11 @@ void RequestProcessor::on_requires_flush() {
 }
 
 void RequestProcessor::on_close(ConnectionPoolManager* manager) {
+  settings_.saturated_host_tracker->remove_listener(this);
   async_.close_handle();
   prepare_.close_handle();
   timer_.stop();
+  throttle_timer_.stop();
   connection_pool_manager_.reset();
   listener_->on_close(this);
   dec_ref();
@@ -387,10 +479,22 @@ bool RequestProcessor::on_prepare_all(const RequestHandler::Ptr& request_handler
   return true;
 }
 
-void RequestProcessor::on_done() {
+void RequestProcessor::on_done(RequestHandler* request_handler) {
 #ifdef CASS_INTERNAL_DIAGNOSTICS
   reads_during_coalesce_++;
 #endif
+  CassRequestPriority lane = request_handler->priority();
+  bool was_lane_full = is_lane_full(lane);
+  lane_inflight_requests_[lane]--;
+  if (was_lane_full && !request_queues_[lane]->is_empty()) {
+    signal_request_queue(); // Requests held back by the lane's limit can now be processed
+  }
+  if (!request_handler->singleflight_key().empty()) {
+    SingleflightMap::iterator it = singleflight_requests_.find(request_handler->singleflight_key());
+    if (it != singleflight_requests_.end() && it->second == request_handler) {
+      singleflight_requests_.erase(it);
+    }
+  }
   maybe_close(request_count_.fetch_sub(1) - 1);
 }
 
@@ -398,6 +502,8 @@ bool RequestProcessor::on_is_host_up(const Address& address) {
   return default_profile_.load_balancing_policy()->is_host_up(address);
 }
 
+void RequestProcessor::on_host_unsaturated() { signal_request_queue(); }
+
 void RequestProcessor::internal_close() {
   is_closing_ = true;
   maybe_close(request_count_.load());
@@ -408,6 +514,9 @@ void RequestProcessor::internal_pool_down(const Address& address) {
   for (LoadBalancingPolicy::Vec::const_iterator it = policies.begin(); it != policies.end(); ++it) {
     (*it)->on_host_down(address);
   }
+  if (limited_hosts_.erase(address) > 0) {
+    on_host_unsaturated(); // Requests waiting for capacity might now fail over
+  }
 }
 
 const ExecutionProfile* RequestProcessor::execution_profile(const String& name) const {
@@ -433,6 +542,10 @@ void RequestProcessor::internal_host_add(const Host::Ptr& host) {
     LoadBalancingPolicy::Vec policies = load_balancing_policies();
     if (!is_host_ignored(policies, host)) {
       connection_pool_manager_->add(host);
+      if (settings_.concurrency_limiter_settings.enabled) {
+        host->enable_concurrency_limiter(settings_.concurrency_limiter_settings,
+                                         settings_.saturated_host_tracker);
+      }
       for (LoadBalancingPolicy::Vec::const_iterator it = policies.begin(); it != policies.end();
            ++it) {
         if ((*it)->distance(host) != CASS_HOST_DISTANCE_IGNORE) {
@@ -448,6 +561,7 @@ void RequestProcessor::internal_host_add(const Host::Ptr& host) {
 void RequestProcessor::internal_host_remove(const Host::Ptr& host) {
   if (connection_pool_manager_) {
     connection_pool_manager_->remove(host->address());
+    limited_hosts_.erase(host->address());
     LoadBalancingPolicy::Vec policies = load_balancing_policies();
     for (LoadBalancingPolicy::Vec::const_iterator it = policies.begin(); it != policies.end();
          ++it) {
@@ -504,8 +618,14 @@ void RequestProcessor::on_timeout(MicroTimer* timer) {
     if (attempts_without_requests_ > 5) {
       attempts_without_requests_ = 0;
       is_processing_.store(false);
+      // Requests left in the queue while every host is at its concurrency
+      // limit or while their lane is at its in-flight limit are processed
+      // when a host drops below its limit (see on_host_unsaturated()) or when
+      // one of the lane's requests completes (see on_done()). Requests
+      // waiting for a rate limit are processed when it refills.
       bool expected = false;
-      if (request_queue_->is_empty() || !is_processing_.compare_exchange_strong(expected, true)) {
+      if (!has_ready_requests() || !is_processing_.compare_exchange_strong(expected, true)) {
+        start_throttle_timer();
         return;
       }
     }
@@ -516,6 +636,8 @@ void RequestProcessor::on_timeout(MicroTimer* timer) {
   }
 }
 
+void RequestProcessor::on_throttle_timeout(Timer* timer) { signal_request_queue(); }
+
 void RequestProcessor::on_async(Async* async) {
   process_requests(0);
 
@@ -533,18 +655,193 @@ void RequestProcessor::on_prepare(Prepare* prepare) {
 }
 
 void RequestProcessor::maybe_close(int request_count) {
-  if (is_closing_ && request_count <= 0 && request_queue_->is_empty()) {
+  if (is_closing_ && request_count <= 0 && is_request_queue_empty()) {
     if (connection_pool_manager_) connection_pool_manager_->close();
   }
 }
 
+bool RequestProcessor::is_saturated() const {
+  return !limited_hosts_.empty() &&
+         settings_.saturated_host_tracker->count() >= limited_hosts_.size();
+}
+
+bool RequestProcessor::is_waiting_for_capacity() const {
+  return settings_.concurrency_limiter_settings.enabled &&
+         settings_.concurrency_limiter_settings.queue_excess_requests && is_saturated();
+}
+
+CassRequestPriority RequestProcessor::priority(const RequestHandler* request_handler) const {
+  if (!settings_.priority_lane_settings.enabled) {
+    return CASS_REQUEST_PRIORITY_NORMAL;
+  }
+
+  CassRequestPriority priority = request_handler->request()->priority();
+  if (priority == CASS_REQUEST_PRIORITY_UNKNOWN) {
+    const ExecutionProfile* profile =
+        execution_profile(request_handler->request()->execution_profile_name());
+    if (profile) priority = profile->priority();
+  }
+  return priority < CASS_REQUEST_PRIORITY_LAST_ENTRY ? priority : CASS_REQUEST_PRIORITY_NORMAL;
+}
+
+bool RequestProcessor::is_request_queue_empty() const {
+  for (int i = 0; i < NUM_PRIORITY_LANES; ++i) {
+    if (request_queues_[i] && !request_queues_[i]->is_empty()) return false;
+  }
+  for (Vector<ThrottledRequests>::const_iterator it = throttled_requests_.begin(),
+                                                 end = throttled_requests_.end();
+       it != end; ++it) {
+    if (!it->request_handlers.empty()) return false;
+  }
+  return true;
+}
+
+bool RequestProcessor::is_lane_full(int lane) const {
+  const PriorityLaneSettings& settings = settings_.priority_lane_settings;
+  return settings.enabled && settings.max_inflight_requests[lane] != 0 &&
+         lane_inflight_requests_[lane] >= settings.max_inflight_requests[lane];
+}
+
+bool RequestProcessor::has_ready_requests() const {
+  if (is_waiting_for_capacity()) return false;
+  for (int i = 0; i < NUM_PRIORITY_LANES; ++i) {
+    if (request_queues_[i] && !request_queues_[i]->is_empty() && !is_lane_full(i)) return true;
+  }
+  for (Vector<ThrottledRequests>::const_iterator it = throttled_requests_.begin(),
+                                                 end = throttled_requests_.end();
+       it != end; ++it) {
+    if (!it->request_handlers.empty() && it->rate_limiter->wait_time_ns() == 0) return true;
+  }
+  return false;
+}
+
+void RequestProcessor::signal_request_queue() {
+  // Only signal the request queue if it's not already processing requests.
+  bool expected = false;
+  if (!is_processing_.load(MEMORY_ORDER_RELAXED) &&
+      is_processing_.compare_exchange_strong(expected, true)) {
+    async_.send();
+  }
+}
+
+void RequestProcessor::start_throttle_timer() {
+  if (throttle_timer_.is_running()) return;
+
+  uint64_t wait_ns = 0;
+  for (Vector<ThrottledRequests>::const_iterator it = throttled_requests_.begin(),
+                                                 end = throttled_requests_.end();
+       it != end; ++it) {
+    if (it->request_handlers.empty()) continue;
+    uint64_t rate_limiter_wait_ns = it->rate_limiter->wait_time_ns();
+    if (rate_limiter_wait_ns > 0 && (wait_ns == 0 || rate_limiter_wait_ns < wait_ns)) {
+      wait_ns = rate_limiter_wait_ns;
+    }
+  }
+
+  if (wait_ns > 0) {
+    throttle_timer_.start(event_loop_->loop(),
+                          (wait_ns + NANOSECONDS_PER_MILLISECOND - 1) / NANOSECONDS_PER_MILLISECOND,
+                          bind_callback(&RequestProcessor::on_throttle_timeout, this));
+  }
+}
+
+bool RequestProcessor::dequeue(RequestHandler*& request_handler) {
+  const PriorityLaneSettings& settings = settings_.priority_lane_settings;
+  if (!settings.enabled) {
+    return request_queues_[CASS_REQUEST_PRIORITY_NORMAL]->dequeue(request_handler);
+  }
+
+  // Lanes at their concurrency limit are skipped until their in-flight
+  // requests complete.
+  bool is_ready[NUM_PRIORITY_LANES];
+  for (int i = 0; i < NUM_PRIORITY_LANES; ++i) {
+    is_ready[i] = !request_queues_[i]->is_empty() && !is_lane_full(i);
+  }
+
+  int lane = lane_selector_.select(is_ready);
+  return lane >= 0 && request_queues_[lane]->dequeue(request_handler);
+}
+
+bool RequestProcessor::join_singleflight(const ExecutionProfile& profile,
+                                         RequestHandler* request_handler) {
+  if (!profile.singleflight_reads()) return false;
+
+  String key;
+  if (!request_handler->get_singleflight_key(&key)) return false;
+
+  SingleflightMap::iterator it = singleflight_requests_.find(key);
+  if (it != singleflight_requests_.end()) {
+    LOG_TRACE("Coalescing request (%p) with in-flight request (%p)",
+              static_cast<void*>(request_handler), static_cast<void*>(it->second));
+    it->second->add_follower(RequestHandler::Ptr(request_handler), event_loop_->loop());
+    return true;
+  }
+
+  request_handler->set_singleflight_key(key);
+  singleflight_requests_[key] = request_handler;
+  return false;
+}
+
+bool RequestProcessor::is_rate_limited(const ExecutionProfile& profile,
+                                       RequestHandler* request_handler) {
+  const RateLimiter::Ptr& rate_limiter = profile.rate_limiter();
+  if (!rate_limiter) return false;
+
+  ThrottledRequests* throttled = NULL;
+  for (Vector<ThrottledRequests>::iterator it = throttled_requests_.begin(),
+                                           end = throttled_requests_.end();
+       it != end; ++it) {
+    if (it->rate_limiter.get() == rate_limiter.get()) {
+      throttled = &(*it);
+      break;
+    }
+  }
+  assert(throttled != NULL && "Rate limiter doesn't have a throttled requests queue");
+
+  // Requests that are already waiting go first
+  if (throttled->request_handlers.empty() && rate_limiter->try_acquire()) {
+    return false;
+  }
+
+  if (!rate_limiter->settings().queue_excess_requests) {
+    request_handler->set_error(CASS_ERROR_LIB_RATE_LIMITED, "The request rate limit was reached");
+  } else if (throttled->request_handlers.size() >= settings_.request_queue_size) {
+    request_handler->set_error(CASS_ERROR_LIB_REQUEST_QUEUE_FULL,
+                               "The request queue has reached capacity");
+  } else {
+    request_handler->inc_ref(); // Queue reference
+    throttled->request_handlers.push_back(request_handler);
+  }
+  return true;
+}
+
+int RequestProcessor::process_throttled_requests() {
+  int processed = 0;
+  for (Vector<ThrottledRequests>::iterator it = throttled_requests_.begin(),
+                                           end = throttled_requests_.end();
+       it != end; ++it) {
+    Deque<RequestHandler*>& request_handlers = it->request_handlers;
+    while (!request_handlers.empty() && it->rate_limiter->try_acquire()) {
+      RequestHandler* request_handler = request_handlers.front();
+      request_handlers.pop_front();
+      request_handler->execute();
+      request_handler->dec_ref();
+      processed++;
+    }
+  }
+  return processed;
+}
+
 int RequestProcessor::process_requests(uint64_t processing_time) {
   uint64_t finish_time = uv_hrtime() + processing_time;
 
-  int processed = 0;
+  int processed = process_throttled_requests();
   RequestHandler* request_handler = NULL;
-  while (request_queue_->dequeue(request_handler)) {
+  // Leave requests in the queue while every connected host is at its
+  // concurrency limit. They're processed once responses free up capacity.
+  while (!is_waiting_for_capacity() && dequeue(request_handler)) {
     if (request_handler) {
+      lane_inflight_requests_[request_handler->priority()]++;
       const String& profile_name = request_handler->request()->execution_profile_name();
       const ExecutionProfile* profile(execution_profile(profile_name));
       if (profile) {
@@ -553,9 +850,14 @@ int RequestProcessor::process_requests(uint64_t processing_time) {
         }
         request_handler->init(*profile, connection_pool_manager_.get(), token_map_.get(),
                               settings_.timestamp_generator.get(), this);
-        request_handler->execute();
-        processed++;
+        // Duplicate reads don't count against the rate limit
+        if (!join_singleflight(*profile, request_handler) &&
+            !is_rate_limited(*profile, request_handler)) {
+          request_handler->execute();
+          processed++;
+        }
       } else {
+        lane_inflight_requests_[request_handler->priority()]--;
         maybe_close(request_count_.fetch_sub(1) - 1);
         request_handler->set_error(CASS_ERROR_LIB_EXECUTION_PROFILE_INVALID,
                                    profile_name + " does not exist");
@@ -20,6 +20,7 @@
 #include "atomic.hpp"
 #include "config.hpp"
 #include "connection_pool_manager.hpp"
+#include "deque.hpp"
 #include "event_loop.hpp"
 #include "histogram_wrapper.hpp"
 #include "host.hpp"
@@ -136,6 +137,13 @@ struct RequestProcessorSettings {
   CassConsistency tracing_consistency;
 
   AddressFactory::Ptr address_factory;
+
+  ConcurrencyLimiterSettings concurrency_limiter_settings;
+
+  // Shared by the processors that are created with copies of the settings
+  SaturatedHostTracker::Ptr saturated_host_tracker;
+
+  PriorityLaneSettings priority_lane_settings;
 };
 
 /**
@@ -148,7 +156,8 @@ class RequestProcessor
     : public RefCounted<RequestProcessor>
     , public ConnectionPoolManagerListener
     , public RequestListener
-    , public SchemaAgreementListener {
+    , public SchemaAgreementListener
+    , public SaturatedHostTracker::Listener {
 public:
   typedef SharedRefPtr<RequestProcessor> Ptr;
   typedef Vector<Ptr> Vec;
@@ -247,6 +256,17 @@ public:
    */
   void process_request(const RequestHandler::Ptr& request_handler);
 
+  /**
+   * Enqueue several requests to be processed using a single queue
+   * reservation and at most one wakeup of the processor. Requests that don't
+   * fit in the queue are failed with CASS_ERROR_LIB_REQUEST_QUEUE_FULL.
+   * (thread-safe, asynchronous).
+   *
+   * @param request_handlers
+   * @param count
+   */
+  void process_requests(const RequestHandler::Ptr* request_handlers, size_t count);
+
   /**
    * Get the number of requests the processor is handling
    *
@@ -268,6 +288,16 @@ public:
    */
   int init(Protected);
 
+  /**
+   * Connect pools to hosts that weren't connected during initialization. Query
+   * plans skip these hosts until their pools are connected. This must be
+   * called on the processor's event loop thread.
+   *
+   * @param hosts The hosts to connect in the background.
+   * @param A key to restrict access to the method
+   */
+  void connect_deferred_hosts(const HostMap& hosts, Protected);
+
 private:
   // Connection pool manager listener methods
 
@@ -292,15 +322,21 @@ private:
                                             const Response::Ptr& response);
   virtual bool on_prepare_all(const RequestHandler::Ptr& request_handler,
                               const Host::Ptr& current_host, const Response::Ptr& response);
-  virtual void on_done();
+  virtual void on_done(RequestHandler* request_handler);
 
 private:
   // Schema agreement listener methods
 
   virtual bool on_is_host_up(const Address& address);
 
+private:
+  // Saturated host tracker listener methods
+
+  virtual void on_host_unsaturated();
+
 private:
   void on_timeout(MicroTimer* timer);
+  void on_throttle_timeout(Timer* timer);
 
 private:
   void internal_close();
@@ -328,6 +364,18 @@ private:
   void on_prepare(Prepare* prepare);
 
   void maybe_close(int request_count);
+  bool is_saturated() const;
+  bool is_waiting_for_capacity() const;
+  CassRequestPriority priority(const RequestHandler* request_handler) const;
+  bool is_request_queue_empty() const;
+  bool is_lane_full(int lane) const;
+  bool has_ready_requests() const;
+  void signal_request_queue();
+  void start_throttle_timer();
+  bool dequeue(RequestHandler*& request_handler);
+  bool join_singleflight(const ExecutionProfile& profile, RequestHandler* request_handler);
+  bool is_rate_limited(const ExecutionProfile& profile, RequestHandler* request_handler);
+  int process_throttled_requests();
   int process_requests(uint64_t processing_time);
 
   bool write_wait_callback(const RequestHandler::Ptr& request_handler,
@@ -343,8 +391,25 @@ private:
   ExecutionProfile default_profile_;
   ExecutionProfile::Map profiles_;
   Atomic<int> request_count_;
-  ScopedPtr<MPMCQueue<RequestHandler*> > const request_queue_;
+  // A queue per priority lane, only the normal priority queue is used if
+  // priority lanes are disabled.
+  ScopedPtr<MPMCQueue<RequestHandler*> > request_queues_[NUM_PRIORITY_LANES];
+  PriorityLaneSelector lane_selector_;
+  unsigned lane_inflight_requests_[NUM_PRIORITY_LANES];
+
+  // Requests waiting for a profile's rate limit
+  struct ThrottledRequests {
+    RateLimiter::Ptr rate_limiter;
+    Deque<RequestHandler*> request_handlers;
+  };
+  Vector<ThrottledRequests> throttled_requests_;
+
+  // In-flight reads that identical reads can be coalesced with
+  typedef DenseHashMap<String, RequestHandler*> SingleflightMap;
+  SingleflightMap singleflight_requests_;
   TokenMap::Ptr token_map_;
+  // Hosts with a concurrency limit and connections in this processor's pool
+  AddressSet limited_hosts_;
 
   bool is_closing_;
   Atomic<bool> is_processing_;
@@ -353,6 +418,7 @@ private:
   Async async_;
   Prepare prepare_;
   MicroTimer timer_;
+  Timer throttle_timer_;
 
 #ifdef CASS_INTERNAL_DIAGNOSTICS
   int reads_during_coalesce_;
@@ -17,6 +17,7 @@
 #include "request_processor_initializer.hpp"
 #include "config.hpp"
 #include "event_loop.hpp"
+#include "logger.hpp"
 #include "scoped_lock.hpp"
 
 using namespace datastax;
@@ -41,7 +42,8 @@ private:
 RequestProcessorInitializer::RequestProcessorInitializer(
     const Host::Ptr& connected_host, ProtocolVersion protocol_version, const HostMap& hosts,
     const TokenMap::Ptr& token_map, const String& local_dc, const Callback& callback)
-    : event_loop_(NULL)
+    : is_connecting_deferred_hosts_(false)
+    , event_loop_(NULL)
     , listener_(NULL)
     , metrics_(NULL)
     , random_(NULL)
@@ -90,6 +92,12 @@ RequestProcessorInitializer* RequestProcessorInitializer::with_random(Random* ra
   return this;
 }
 
+RequestProcessorInitializer*
+RequestProcessorInitializer::with_deferred_hosts(const HostMap& hosts) {
+  deferred_hosts_ = hosts;
+  return this;
+}
+
 RequestProcessor::Ptr RequestProcessorInitializer::release_processor() {
   RequestProcessor::Ptr temp(processor_);
   processor_.reset();
@@ -100,12 +108,14 @@ void RequestProcessorInitializer::on_pool_up(const Address& address) {
   if (listener_) {
     listener_->on_pool_up(address);
   }
+  maybe_finish_deferred_host(address);
 }
 
 void RequestProcessorInitializer::on_pool_down(const Address& address) {
   if (listener_) {
     listener_->on_pool_down(address);
   }
+  maybe_finish_deferred_host(address);
 }
 
 void RequestProcessorInitializer::on_pool_critical_error(const Address& address,
@@ -114,6 +124,10 @@ void RequestProcessorInitializer::on_pool_critical_error(const Address& address,
   if (listener_) {
     listener_->on_pool_critical_error(address, code, message);
   }
+  if (is_connecting_deferred_hosts_) {
+    hosts_.erase(address);
+  }
+  maybe_finish_deferred_host(address);
 }
 
 void RequestProcessorInitializer::on_close(ConnectionPoolManager* manager) {
@@ -122,6 +136,14 @@ void RequestProcessorInitializer::on_close(ConnectionPoolManager* manager) {
 
 void RequestProcessorInitializer::internal_initialize() {
   inc_ref();
+
+  HostMap hosts;
+  for (HostMap::const_iterator it = hosts_.begin(), end = hosts_.end(); it != end; ++it) {
+    if (deferred_hosts_.find(it->first) == deferred_hosts_.end()) {
+      hosts[it->first] = it->second;
+    }
+  }
+
   connection_pool_manager_initializer_.reset(new ConnectionPoolManagerInitializer(
       protocol_version_, bind_callback(&RequestProcessorInitializer::on_initialize, this)));
 
@@ -129,7 +151,25 @@ void RequestProcessorInitializer::internal_initialize() {
       ->with_listener(this)
       ->with_keyspace(keyspace_)
       ->with_metrics(metrics_)
-      ->initialize(event_loop_->loop(), hosts_);
+      ->initialize(event_loop_->loop(), hosts);
+}
+
+bool RequestProcessorInitializer::has_connected_hosts() const {
+  for (HostMap::const_iterator it = hosts_.begin(), end = hosts_.end(); it != end; ++it) {
+    if (deferred_hosts_.find(it->first) == deferred_hosts_.end() &&
+        manager_->has_connections(it->first)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void RequestProcessorInitializer::maybe_finish_deferred_host(const Address& address) {
+  if (is_connecting_deferred_hosts_ && deferred_hosts_.erase(address) > 0 &&
+      deferred_hosts_.empty()) {
+    is_connecting_deferred_hosts_ = false;
+    finish_initialize();
+  }
 }
 
 void RequestProcessorInitializer::on_initialize(ConnectionPoolManagerInitializer* initializer) {
@@ -148,22 +188,45 @@ void RequestProcessorInitializer::on_initialize(ConnectionPoolManagerInitializer
     }
   }
 
-  // Handle errors and set hosts as up
+  manager_ = initializer->release_manager();
+
   if (is_keyspace_error) {
     error_code_ = REQUEST_PROCESSOR_ERROR_KEYSPACE;
     error_message_ = "Keyspace '" + keyspace_ + "' does not exist";
-  } else if (hosts_.empty()) {
+  } else if (!deferred_hosts_.empty() && !has_connected_hosts()) {
+    // None of the initial hosts have connections so wait for the deferred
+    // hosts before finishing initialization.
+    LOG_WARN("Unable to connect to any local hosts. Waiting for the remaining %u hosts",
+             static_cast<unsigned>(deferred_hosts_.size()));
+    is_connecting_deferred_hosts_ = true;
+    const HostMap hosts(deferred_hosts_);
+    for (HostMap::const_iterator it = hosts.begin(), end = hosts.end(); it != end; ++it) {
+      manager_->add(it->second);
+    }
+    return;
+  }
+
+  finish_initialize();
+}
+
+void RequestProcessorInitializer::finish_initialize() {
+  // Handle errors and set hosts as up
+  if (is_ok() && hosts_.empty()) {
     error_code_ = REQUEST_PROCESSOR_ERROR_NO_HOSTS_AVAILABLE;
     error_message_ = "Unable to connect to any hosts";
-  } else {
-    processor_.reset(new RequestProcessor(listener_, event_loop_, initializer->release_manager(),
-                                          connected_host_, hosts_, token_map_, settings_, random_,
-                                          local_dc_));
+  }
+
+  if (is_ok()) {
+    processor_.reset(new RequestProcessor(listener_, event_loop_, manager_, connected_host_,
+                                          hosts_, token_map_, settings_, random_, local_dc_));
+    manager_.reset();
 
     int rc = processor_->init(RequestProcessor::Protected());
     if (rc != 0) {
       error_code_ = REQUEST_PROCESSOR_ERROR_UNABLE_TO_INIT;
       error_message_ = "Unable to initialize request processor";
+    } else if (!deferred_hosts_.empty()) {
+      processor_->connect_deferred_hosts(deferred_hosts_, RequestProcessor::Protected());
     }
   }
 
@@ -175,6 +238,12 @@ void RequestProcessorInitializer::on_initialize(ConnectionPoolManagerInitializer
     processor_->set_listener();
     processor_->close();
   }
+  // If the processor wasn't created then close the manager.
+  if (manager_) {
+    manager_->set_listener();
+    manager_->close();
+    manager_.reset();
+  }
   // Explicitly release resources on the event loop thread.
   connection_pool_manager_initializer_.reset();
   dec_ref();
@@ -115,6 +115,16 @@ public:
    */
   RequestProcessorInitializer* with_random(Random* random);
 
+  /**
+   * Set the hosts that are connected in the background after the processor is
+   * initialized instead of during initialization. If none of the other hosts
+   * have connections then initialization waits for these hosts instead.
+   *
+   * @param hosts A subset of the available hosts.
+   * @return The initializer to chain calls.
+   */
+  RequestProcessorInitializer* with_deferred_hosts(const HostMap& hosts);
+
   /**
    * Release the processor from the initializer. If not released in the callback
    * the processor will automatically be closed.
@@ -145,14 +155,19 @@ private:
 
 private:
   void internal_initialize();
+  bool has_connected_hosts() const;
+  void maybe_finish_deferred_host(const Address& address);
 
 private:
   void on_initialize(ConnectionPoolManagerInitializer* initializer);
+  void finish_initialize();
 
 private:
   uv_mutex_t mutex_;
 
   ConnectionPoolManagerInitializer::Ptr connection_pool_manager_initializer_;
+  ConnectionPoolManager::Ptr manager_;
+  bool is_connecting_deferred_hosts_;
   RequestProcessor::Ptr processor_;
 
   EventLoop* event_loop_;
@@ -165,6 +180,7 @@ private:
   const Host::Ptr connected_host_;
   const ProtocolVersion protocol_version_;
   HostMap hosts_;
+  HostMap deferred_hosts_;
   const TokenMap::Ptr token_map_;
   String local_dc_;
 
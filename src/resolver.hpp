@@ -20,6 +20,7 @@
 #include "address.hpp"
 #include "callback.hpp"
 #include "ref_counted.hpp"
+#include "resolver_cache.hpp"
 #include "string.hpp"
 #include "timer.hpp"
 #include "vector.hpp"
@@ -51,10 +52,22 @@ public:
       : hostname_(hostname)
       , port_(port)
       , status_(NEW)
+      , cache_ttl_ms_(0)
+      , is_cached_(false)
       , callback_(callback) {
     req_.data = this;
   }
 
+  /**
+   * Use the process-wide resolver cache. A fresh cached resolution completes
+   * without using libuv's thread pool and a stale one is refreshed in the
+   * background after it's used.
+   *
+   * @param cache_ttl_ms How long a resolution is considered fresh. Use 0 to
+   * disable the cache.
+   */
+  void set_cache_ttl_ms(uint64_t cache_ttl_ms) { cache_ttl_ms_ = cache_ttl_ms; }
+
   uv_loop_t* loop() { return req_.loop; }
 
   const String& hostname() { return hostname_; }
@@ -73,6 +86,21 @@ public:
 
     inc_ref(); // For the event loop
 
+    // Only resolutions using the default filter are cached
+    if (hints == NULL && cache_ttl_ms_ > 0) {
+      ResolverCache::Status cache_status =
+          ResolverCache::get(hostname_, port_, cache_ttl_ms_, &addresses_);
+      if (cache_status != ResolverCache::MISS) {
+        if (cache_status == ResolverCache::STALE) {
+          refresh(loop, hostname_, port_, timeout);
+        }
+        // Complete asynchronously, the same as a resolution
+        is_cached_ = true;
+        timer_.start(loop, 0, bind_callback(&Resolver::on_cached, this));
+        return;
+      }
+    }
+
     // If no hints are provided then use a default filter.
     struct addrinfo default_hints;
     if (hints == NULL) {
@@ -101,8 +129,10 @@ public:
 
   void cancel() {
     if (status_ == RESOLVING) {
-      uv_cancel(reinterpret_cast<uv_req_t*>(&req_));
-      timer_.stop();
+      if (!is_cached_) { // Cached resolutions still run their callback
+        uv_cancel(reinterpret_cast<uv_req_t*>(&req_));
+        timer_.stop();
+      }
       status_ = CANCELED;
     }
   }
@@ -120,6 +150,9 @@ private:
         resolver->status_ = FAILED_UNSUPPORTED_ADDRESS_FAMILY;
       } else {
         resolver->status_ = SUCCESS;
+        if (resolver->cache_ttl_ms_ > 0) {
+          ResolverCache::put(resolver->hostname_, resolver->port_, resolver->addresses_);
+        }
       }
     }
 
@@ -135,6 +168,31 @@ private:
     uv_cancel(reinterpret_cast<uv_req_t*>(&req_));
   }
 
+  void on_cached(Timer* timer) {
+    if (status_ == RESOLVING) {
+      status_ = SUCCESS;
+    } else {
+      addresses_.clear();
+    }
+    callback_(this);
+    dec_ref();
+  }
+
+  static void refresh(uv_loop_t* loop, const String& hostname, int port, uint64_t timeout) {
+    // The refreshing resolver bypasses the cache and is kept alive by the
+    // event loop until it's done.
+    Resolver::Ptr resolver(new Resolver(hostname, port, bind_callback(&Resolver::on_refresh)));
+    resolver->resolve(loop, timeout);
+  }
+
+  static void on_refresh(Resolver* resolver) {
+    if (resolver->is_success()) {
+      ResolverCache::put(resolver->hostname_, resolver->port_, resolver->addresses_);
+    } else {
+      ResolverCache::refresh_failed(resolver->hostname_, resolver->port_);
+    }
+  }
+
 private:
   bool init_addresses(struct addrinfo* res) {
     bool status = false;
@@ -156,6 +214,8 @@ private:
   int port_;
   Status status_;
   int uv_status_;
+  uint64_t cache_ttl_ms_;
+  bool is_cached_;
   AddressVec addresses_;
   Callback callback_;
 
@@ -168,17 +228,37 @@ public:
   typedef SharedRefPtr<MultiResolver> Ptr;
   typedef internal::Callback<void, MultiResolver*> Callback;
 
-  MultiResolver(const Callback& callback)
+  /**
+   * Constructor.
+   *
+   * @param callback A callback that's called when all the hostnames are resolved.
+   * @param resolver_callback An optional callback that's called as each
+   * individual hostname is resolved.
+   */
+  MultiResolver(const Callback& callback,
+                const Resolver::Callback& resolver_callback = Resolver::Callback())
       : remaining_(0)
-      , callback_(callback) {}
+      , cache_ttl_ms_(0)
+      , callback_(callback)
+      , resolver_callback_(resolver_callback) {}
 
   const Resolver::Vec& resolvers() { return resolvers_; }
 
+  /**
+   * Use the process-wide resolver cache for the hostnames.
+   *
+   * @param cache_ttl_ms How long a resolution is considered fresh. Use 0 to
+   * disable the cache.
+   * @see Resolver::set_cache_ttl_ms()
+   */
+  void set_cache_ttl_ms(uint64_t cache_ttl_ms) { cache_ttl_ms_ = cache_ttl_ms; }
+
   void resolve(uv_loop_t* loop, const String& host, int port, uint64_t timeout,
                struct addrinfo* hints = NULL) {
     inc_ref();
     Resolver::Ptr resolver(
         new Resolver(host, port, bind_callback(&MultiResolver::on_resolve, this)));
+    resolver->set_cache_ttl_ms(cache_ttl_ms_);
     resolver->resolve(loop, timeout, hints);
     resolvers_.push_back(resolver);
     remaining_++;
@@ -192,6 +272,9 @@ public:
 
 private:
   void on_resolve(Resolver* resolver) {
+    if (resolver_callback_) {
+      resolver_callback_(resolver);
+    }
     remaining_--;
     if (remaining_ <= 0 && callback_) {
       callback_(this);
@@ -202,7 +285,9 @@ private:
 private:
   Resolver::Vec resolvers_;
   int remaining_;
+  uint64_t cache_ttl_ms_;
   Callback callback_;
+  Resolver::Callback resolver_callback_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(MultiResolver);
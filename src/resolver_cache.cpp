@@ -0,0 +1,84 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "resolver_cache.hpp"
+
+#include "get_time.hpp"
+#include "scoped_lock.hpp"
+
+using namespace datastax;
+using namespace datastax::internal;
+using namespace datastax::internal::core;
+
+uv_once_t ResolverCache::init_guard_ = UV_ONCE_INIT;
+uv_mutex_t ResolverCache::mutex_;
+ResolverCache::EntryMap* ResolverCache::entries_ = NULL;
+
+ResolverCache::Status ResolverCache::get(const String& hostname, int port, uint64_t ttl_ms,
+                                         AddressVec* addresses) {
+  uv_once(&init_guard_, init);
+  ScopedMutex l(&mutex_);
+
+  EntryMap::iterator it = entries_->find(to_key(hostname, port));
+  if (it == entries_->end()) return MISS;
+
+  Entry& entry = it->second;
+  *addresses = entry.addresses;
+  if (entry.is_refreshing || get_time_monotonic_ns() / 1000000 - entry.resolved_at_ms < ttl_ms) {
+    return HIT;
+  }
+  entry.is_refreshing = true;
+  return STALE;
+}
+
+void ResolverCache::put(const String& hostname, int port, const AddressVec& addresses) {
+  uv_once(&init_guard_, init);
+  ScopedMutex l(&mutex_);
+
+  Entry& entry = (*entries_)[to_key(hostname, port)];
+  entry.addresses = addresses;
+  entry.resolved_at_ms = get_time_monotonic_ns() / 1000000;
+  entry.is_refreshing = false;
+}
+
+void ResolverCache::refresh_failed(const String& hostname, int port) {
+  uv_once(&init_guard_, init);
+  ScopedMutex l(&mutex_);
+
+  EntryMap::iterator it = entries_->find(to_key(hostname, port));
+  if (it != entries_->end()) {
+    it->second.is_refreshing = false;
+  }
+}
+
+void ResolverCache::clear() {
+  uv_once(&init_guard_, init);
+  ScopedMutex l(&mutex_);
+  entries_->clear();
+}
+
+void ResolverCache::init() {
+  uv_mutex_init(&mutex_);
+  // Allocated on first use (and never freed) so that the driver's allocator can
+  // be replaced before it's used.
+  entries_ = new EntryMap();
+}
+
+String ResolverCache::to_key(const String& hostname, int port) {
+  OStringStream ss;
+  ss << hostname << ":" << port;
+  return ss.str();
+}
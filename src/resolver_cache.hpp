@@ -0,0 +1,95 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_RESOLVER_CACHE_HPP
+#define DATASTAX_INTERNAL_RESOLVER_CACHE_HPP
+
+#include "address.hpp"
+#include "map.hpp"
+#include "string.hpp"
+
+#include <uv.h>
+
+namespace datastax { namespace internal { namespace core {
+
+/**
+ * A process-wide cache of resolved hostnames that's shared by all sessions.
+ * `getaddrinfo()` doesn't expose the TTL of DNS records so the TTL is provided
+ * by the caller (from the cluster's configuration). Once an entry is older
+ * than the TTL it's still returned (stale-while-revalidate) and the first
+ * caller to see the stale entry is responsible for refreshing it in the
+ * background. Entries are only replaced by successful resolutions so a failing
+ * DNS server doesn't prevent reconnecting to known addresses.
+ */
+class ResolverCache {
+public:
+  enum Status {
+    MISS,  // No entry, resolve the hostname
+    HIT,   // Use the cached addresses
+    STALE  // Use the cached addresses and refresh the entry
+  };
+
+  /**
+   * Get the cached addresses for a hostname (thread-safe).
+   *
+   * @param hostname The hostname.
+   * @param port The port.
+   * @param ttl_ms How long a resolution is considered fresh.
+   * @param addresses The cached addresses (if there are any).
+   * @return The status of the entry. Only a single caller is returned STALE
+   * until the entry is refreshed using `put()` or `refresh_failed()`.
+   */
+  static Status get(const String& hostname, int port, uint64_t ttl_ms, AddressVec* addresses);
+
+  /**
+   * Add or replace the addresses for a hostname (thread-safe).
+   */
+  static void put(const String& hostname, int port, const AddressVec& addresses);
+
+  /**
+   * Allow another attempt to refresh a stale entry (thread-safe).
+   */
+  static void refresh_failed(const String& hostname, int port);
+
+  /**
+   * Remove all entries (thread-safe).
+   */
+  static void clear();
+
+private:
+  struct Entry {
+    Entry()
+        : resolved_at_ms(0)
+        , is_refreshing(false) {}
+
+    AddressVec addresses;
+    uint64_t resolved_at_ms;
+    bool is_refreshing;
+  };
+
+  typedef Map<String, Entry> EntryMap;
+
+  static void init();
+  static String to_key(const String& hostname, int port);
+
+  static uv_once_t init_guard_;
+  static uv_mutex_t mutex_;
+  static EntryMap* entries_;
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
@@ -35,6 +35,7 @@ namespace datastax { namespace internal { namespace core {
 class Response : public RefCounted<Response> {
 public:
   typedef SharedRefPtr<Response> Ptr;
+  typedef SharedRefPtr<const Response> ConstPtr;
 
   Response(uint8_t opcode);
 
@@ -16,6 +16,7 @@
 
 #include "result_response.hpp"
 
+#include "data_type_parser.hpp"
 #include "external.hpp"
 #include "logger.hpp"
 #include "protocol.hpp"
@@ -138,6 +139,11 @@ private:
     DataType::ConstPtr type = cache_.by_class(class_name);
     if (type) return type;
 
+    if (starts_with(class_name, VECTOR_TYPE)) {
+      type = DataTypeClassNameParser::parse_one(class_name.to_string(), cache_);
+      if (type) return type;
+    }
+
     // If no mapping exists, return an actual custom type.
     return DataType::ConstPtr(new CustomType(class_name.to_string()));
   }
@@ -196,6 +202,7 @@ bool ResultResponse::decode(Decoder& decoder) {
   protocol_version_ = decoder.protocol_version();
   decoder.set_type("result");
   bool is_valid = false;
+  StringRef body(decoder.as_string_ref());
 
   CHECK_RESULT(decoder.decode_int32(kind_));
 
@@ -214,6 +221,7 @@ bool ResultResponse::decode(Decoder& decoder) {
 
     case CASS_RESULT_KIND_PREPARED:
       is_valid = decode_prepared(decoder);
+      if (is_valid) encoded_prepared_ = body;
       break;
 
     case CASS_RESULT_KIND_SCHEMA_CHANGE:
@@ -74,6 +74,9 @@ public:
   bool metadata_changed() { return new_metadata_id_.size() > 0; }
   StringRef new_metadata_id() const { return new_metadata_id_; }
 
+  // The encoded body of a prepared result (used to persist prepared metadata)
+  StringRef encoded_prepared() const { return encoded_prepared_; }
+
   const Decoder& row_decoder() const { return row_decoder_; }
 
   int32_t row_count() const { return row_count_; }
@@ -111,6 +114,7 @@ private:
   StringRef keyspace_;           // rows, set keyspace, and schema change
   StringRef table_;              // rows, and schema change
   StringRef new_metadata_id_;    // rows result, protocol v5/DSEv2
+  StringRef encoded_prepared_;   // prepared result
   int32_t row_count_;
   Decoder row_decoder_;
   Row first_row_;
@@ -0,0 +1,104 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_RETRY_BUDGET_HPP
+#define DATASTAX_INTERNAL_RETRY_BUDGET_HPP
+
+#include "allocated.hpp"
+#include "host.hpp"
+#include "macros.hpp"
+#include "token_bucket.hpp"
+
+namespace datastax { namespace internal { namespace core {
+
+/**
+ * Limits the retries of a session to a ratio of its recent requests so that
+ * retries don't amplify an overload. Each request adds a fraction of a retry
+ * to a session-wide token bucket and to the bucket of the host it's sent to;
+ * a retry must be covered by both the session's budget and the budget of the
+ * host that failed. The buckets start full so that bursts of up to
+ * `max_retries` are allowed.
+ */
+class RetryBudget : public Allocated {
+public:
+  struct Settings {
+    Settings()
+        : retry_ratio(0.0)
+        , max_retries(10) {}
+
+    bool is_enabled() const { return retry_ratio > 0.0; }
+
+    double retry_ratio;
+    unsigned max_retries;
+  };
+
+  RetryBudget(const Settings& settings)
+      : units_per_request_(static_cast<int64_t>(settings.retry_ratio * UNITS_PER_RETRY))
+      , max_units_(static_cast<int64_t>(settings.max_retries) * UNITS_PER_RETRY) {}
+
+  /**
+   * Adds to the session's budget for a new request.
+   */
+  void on_request() { bucket_.deposit(units_per_request_, max_units_); }
+
+  /**
+   * Adds to a host's budget for a request sent to that host.
+   */
+  void on_host_request(Host* host) {
+    host->retry_budget().deposit(units_per_request_, max_units_);
+  }
+
+  /**
+   * Takes a retry from the budget of the session and the failed host.
+   *
+   * @param host The host that failed the request.
+   * @return false if either budget is exhausted.
+   */
+  bool acquire(Host* host) {
+    if (host != NULL && !host->retry_budget().try_acquire(UNITS_PER_RETRY, max_units_)) {
+      return false;
+    }
+    if (!bucket_.try_acquire(UNITS_PER_RETRY, max_units_)) {
+      if (host != NULL) { // Refund the host
+        host->retry_budget().deposit(UNITS_PER_RETRY, max_units_);
+      }
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * The number of retries currently available in the session's budget.
+   */
+  double available_retries() const {
+    return static_cast<double>(bucket_.units(max_units_)) / UNITS_PER_RETRY;
+  }
+
+private:
+  // Fixed-point units so that fractional retries accumulate
+  static const int64_t UNITS_PER_RETRY = 1000;
+
+  const int64_t units_per_request_;
+  const int64_t max_units_;
+  TokenBucket bucket_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(RetryBudget);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
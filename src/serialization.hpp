@@ -30,6 +30,16 @@
 #include <limits>
 #include <string.h>
 
+// x86 is always little-endian so the SIMD paths below can unconditionally
+// reverse bytes. Other platforms use the portable (scalar) functions.
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define CASS_HAVE_SSSE3_BYTE_SWAP
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CASS_HAVE_SSE2_BYTE_SWAP
+#endif
+
 namespace datastax { namespace internal {
 
 // http://commandcenter.blogspot.com/2012/04/byte-order-fallacy.html
@@ -224,6 +234,209 @@ inline int64_t decode_zig_zag(uint64_t n) {
 
 inline uint64_t encode_zig_zag(int64_t n) { return (n << 1) ^ (n >> 63); }
 
+// Bulk conversions for contiguous arrays of fixed width values (e.g. vectors).
+// The 4 and 8 byte swaps are symmetric on little-endian hosts so the SIMD
+// loops are shared between encoding and decoding; only the scalar tail needs
+// to know which direction it's going.
+
+#if defined(CASS_HAVE_SSSE3_BYTE_SWAP) || defined(CASS_HAVE_SSE2_BYTE_SWAP)
+inline __m128i byte_swap_32x4(__m128i v) {
+#if defined(CASS_HAVE_SSSE3_BYTE_SWAP)
+  return _mm_shuffle_epi8(v, _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3));
+#else
+  v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+  v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+  return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+#endif
+}
+
+inline __m128i byte_swap_64x2(__m128i v) {
+#if defined(CASS_HAVE_SSSE3_BYTE_SWAP)
+  return _mm_shuffle_epi8(v, _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7));
+#else
+  v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+  v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+  return _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+#endif
+}
+
+inline size_t byte_swap_32_array(char* output, const char* input, size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * sizeof(uint32_t)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * sizeof(uint32_t)), byte_swap_32x4(v));
+  }
+  return i;
+}
+
+inline size_t byte_swap_64_array(char* output, const char* input, size_t count) {
+  size_t i = 0;
+  for (; i + 2 <= count; i += 2) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * sizeof(uint64_t)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * sizeof(uint64_t)), byte_swap_64x2(v));
+  }
+  return i;
+}
+
+// Interleaves [int32 size = 4] prefixes with byte swapped values (the layout
+// of collection elements) four values at a time.
+inline size_t byte_swap_32_elements(char* output, const char* input, size_t count) {
+  const __m128i sizes = _mm_set1_epi32(0x04000000); // 4 as a big-endian int32
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128i v = byte_swap_32x4(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * sizeof(uint32_t))));
+    char* pos = output + i * 2 * sizeof(uint32_t);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pos), _mm_unpacklo_epi32(sizes, v));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pos + 16), _mm_unpackhi_epi32(sizes, v));
+  }
+  return i;
+}
+
+// The inverse of byte_swap_32_elements(). Stops early at the first group
+// with a size that isn't 4 (e.g. a null element) so the caller can report it.
+inline size_t byte_swap_32_elements_reverse(char* output, const char* input, size_t count) {
+  const __m128i sizes = _mm_set1_epi32(0x04000000); // 4 as a big-endian int32
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const char* pos = input + i * 2 * sizeof(uint32_t);
+    __m128i a = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)),
+                                  _MM_SHUFFLE(3, 1, 2, 0));
+    __m128i b = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos + 16)),
+                                  _MM_SHUFFLE(3, 1, 2, 0));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_unpacklo_epi64(a, b), sizes)) != 0xFFFF) break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * sizeof(uint32_t)),
+                     byte_swap_32x4(_mm_unpackhi_epi64(a, b)));
+  }
+  return i;
+}
+#else
+// No elements are swapped in bulk so the scalar loops convert all of them
+inline size_t byte_swap_32_array(char*, const char*, size_t) { return 0; }
+inline size_t byte_swap_64_array(char*, const char*, size_t) { return 0; }
+inline size_t byte_swap_32_elements(char*, const char*, size_t) { return 0; }
+inline size_t byte_swap_32_elements_reverse(char*, const char*, size_t) { return 0; }
+#endif
+
+inline char* encode_uint32_array(char* output, const void* values, size_t count) {
+  const char* input = static_cast<const char*>(values);
+  size_t i = byte_swap_32_array(output, input, count);
+  for (; i < count; ++i) {
+    uint32_t value;
+    memcpy(&value, input + i * sizeof(uint32_t), sizeof(uint32_t));
+    encode_uint32(output + i * sizeof(uint32_t), value);
+  }
+  return output + count * sizeof(uint32_t);
+}
+
+inline const char* decode_uint32_array(const char* input, void* values, size_t count) {
+  char* output = static_cast<char*>(values);
+  size_t i = byte_swap_32_array(output, input, count);
+  for (; i < count; ++i) {
+    uint32_t value;
+    decode_uint32(input + i * sizeof(uint32_t), value);
+    memcpy(output + i * sizeof(uint32_t), &value, sizeof(uint32_t));
+  }
+  return input + count * sizeof(uint32_t);
+}
+
+inline char* encode_uint64_array(char* output, const void* values, size_t count) {
+  const char* input = static_cast<const char*>(values);
+  size_t i = byte_swap_64_array(output, input, count);
+  for (; i < count; ++i) {
+    int64_t value;
+    memcpy(&value, input + i * sizeof(int64_t), sizeof(int64_t));
+    encode_int64(output + i * sizeof(int64_t), value);
+  }
+  return output + count * sizeof(int64_t);
+}
+
+inline const char* decode_uint64_array(const char* input, void* values, size_t count) {
+  char* output = static_cast<char*>(values);
+  size_t i = byte_swap_64_array(output, input, count);
+  for (; i < count; ++i) {
+    int64_t value;
+    decode_int64(input + i * sizeof(int64_t), value);
+    memcpy(output + i * sizeof(int64_t), &value, sizeof(int64_t));
+  }
+  return input + count * sizeof(int64_t);
+}
+
+// Collection elements are individually prefixed with their size:
+// [int32 size][value]. These encode/decode runs of same sized elements.
+
+inline char* encode_uint32_elements(char* output, const void* values, size_t count) {
+  const char* input = static_cast<const char*>(values);
+  size_t i = byte_swap_32_elements(output, input, count);
+  for (; i < count; ++i) {
+    uint32_t value;
+    memcpy(&value, input + i * sizeof(uint32_t), sizeof(uint32_t));
+    char* pos = encode_int32(output + i * 2 * sizeof(uint32_t), sizeof(uint32_t));
+    encode_uint32(pos, value);
+  }
+  return output + count * 2 * sizeof(uint32_t);
+}
+
+inline bool decode_uint32_elements(const char* input, void* values, size_t count) {
+  char* output = static_cast<char*>(values);
+  size_t i = byte_swap_32_elements_reverse(output, input, count);
+  for (; i < count; ++i) {
+    int32_t size;
+    uint32_t value;
+    const char* pos = decode_int32(input + i * 2 * sizeof(uint32_t), size);
+    if (size != sizeof(uint32_t)) return false;
+    decode_uint32(pos, value);
+    memcpy(output + i * sizeof(uint32_t), &value, sizeof(uint32_t));
+  }
+  return true;
+}
+
+// The 12 byte stride of 8 byte elements doesn't map onto 16 byte registers so
+// these rely on the compiler's byte swap intrinsics.
+inline char* encode_uint64_elements(char* output, const void* values, size_t count) {
+  const char* input = static_cast<const char*>(values);
+  for (size_t i = 0; i < count; ++i) {
+    int64_t value;
+    memcpy(&value, input + i * sizeof(int64_t), sizeof(int64_t));
+    output = encode_int32(output, sizeof(int64_t));
+    output = encode_int64(output, value);
+  }
+  return output;
+}
+
+inline bool decode_uint64_elements(const char* input, void* values, size_t count) {
+  char* output = static_cast<char*>(values);
+  for (size_t i = 0; i < count; ++i) {
+    int32_t size;
+    int64_t value;
+    input = decode_int32(input, size);
+    if (size != sizeof(int64_t)) return false;
+    input = decode_int64(input, value);
+    memcpy(output + i * sizeof(int64_t), &value, sizeof(int64_t));
+  }
+  return true;
+}
+
+inline char* encode_float_array(char* output, const float* values, size_t count) {
+  STATIC_ASSERT(std::numeric_limits<float>::is_iec559 && sizeof(float) == sizeof(uint32_t));
+  return encode_uint32_array(output, values, count);
+}
+
+inline const char* decode_float_array(const char* input, float* output, size_t count) {
+  STATIC_ASSERT(std::numeric_limits<float>::is_iec559 && sizeof(float) == sizeof(uint32_t));
+  return decode_uint32_array(input, output, count);
+}
+
+inline char* encode_double_array(char* output, const double* values, size_t count) {
+  STATIC_ASSERT(std::numeric_limits<double>::is_iec559 && sizeof(double) == sizeof(uint64_t));
+  return encode_uint64_array(output, values, count);
+}
+
+inline const char* decode_double_array(const char* input, double* output, size_t count) {
+  STATIC_ASSERT(std::numeric_limits<double>::is_iec559 && sizeof(double) == sizeof(uint64_t));
+  return decode_uint64_array(input, output, count);
+}
+
 }} // namespace datastax::internal
 
 #endif
@@ -28,6 +28,7 @@
 #include "prepare_request.hpp"
 #include "request_processor_initializer.hpp"
 #include "scoped_lock.hpp"
+#include "small_vector.hpp"
 #include "statement.hpp"
 
 using namespace datastax;
@@ -99,6 +100,53 @@ CassFuture* cass_session_execute_batch(CassSession* session, const CassBatch* ba
   return CassFuture::to(future.get());
 }
 
+CassError cass_session_execute_cq(CassSession* session, const CassStatement* statement,
+                                  CassCompletionQueue* completion_queue, void* tag) {
+  if (completion_queue == NULL) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  session->execute(Request::ConstPtr(statement->from()),
+                   CompletionQueue::Ptr(completion_queue->from()), tag);
+  return CASS_OK;
+}
+
+CassError cass_session_execute_batch_cq(CassSession* session, const CassBatch* batch,
+                                        CassCompletionQueue* completion_queue, void* tag) {
+  if (completion_queue == NULL) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  session->execute(Request::ConstPtr(batch->from()),
+                   CompletionQueue::Ptr(completion_queue->from()), tag);
+  return CASS_OK;
+}
+
+CassError cass_session_execute_batch_submit(CassSession* session,
+                                            const CassStatement* const* statements, size_t count,
+                                            CassFuture** futures) {
+  if (count > 0 && (statements == NULL || futures == NULL)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+
+  internal::SmallVector<Request::ConstPtr, 64> requests(count);
+  for (size_t i = 0; i < count; ++i) {
+    if (statements[i] == NULL) {
+      return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+    requests[i] = Request::ConstPtr(statements[i]->from());
+  }
+
+  internal::SmallVector<Future::Ptr, 64> results(count);
+  if (count > 0) {
+    session->execute(&requests[0], count, &results[0]);
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    results[i]->inc_ref();
+    futures[i] = CassFuture::to(results[i].get());
+  }
+  return CASS_OK;
+}
+
 const CassSchemaMeta* cass_session_get_schema_meta(const CassSession* session) {
   return CassSchemaMeta::to(new Metadata::SchemaSnapshot(session->cluster()->schema_snapshot()));
 }
@@ -167,6 +215,21 @@ void cass_session_get_speculative_execution_metrics(const CassSession* session,
   metrics->percentage = internal_metrics->request_rates.speculative_request_percent();
 }
 
+void cass_session_get_retry_metrics(const CassSession* session, CassRetryMetrics* metrics) {
+  const Metrics* internal_metrics = session->metrics();
+
+  if (internal_metrics == NULL) {
+    LOG_WARN("Attempted to get retry metrics before connecting session object");
+    memset(metrics, 0, sizeof(CassRetryMetrics));
+    return;
+  }
+
+  metrics->retries = internal_metrics->retries.sum();
+  metrics->throttled_retries = internal_metrics->throttled_retries.sum();
+  metrics->available_retries =
+      session->retry_budget() ? session->retry_budget()->available_retries() : 0.0;
+}
+
 CassUuid cass_session_get_client_id(CassSession* session) { return session->client_id(); }
 
 } // extern "C"
@@ -195,24 +258,27 @@ public:
   SessionInitializer() { uv_mutex_destroy(&mutex_); }
 
   void initialize(const Host::Ptr& connected_host, ProtocolVersion protocol_version,
-                  const HostMap& hosts, const TokenMap::Ptr& token_map, const String& local_dc) {
+                  const HostMap& hosts, const HostMap& deferred_hosts,
+                  const TokenMap::Ptr& token_map, const String& local_dc) {
     inc_ref();
 
+    // The processors share the settings' saturated host tracker
+    RequestProcessorSettings settings(session_->config());
+    settings.connection_pool_settings.connection_settings.client_id =
+        to_string(session_->client_id());
+
     const size_t thread_count_io = remaining_ = session_->config().thread_count_io();
     for (size_t i = 0; i < thread_count_io; ++i) {
       RequestProcessorInitializer::Ptr initializer(new RequestProcessorInitializer(
           connected_host, protocol_version, hosts, token_map, local_dc,
           bind_callback(&SessionInitializer::on_initialize, this)));
 
-      RequestProcessorSettings settings(session_->config());
-      settings.connection_pool_settings.connection_settings.client_id =
-          to_string(session_->client_id());
-
       initializer->with_settings(RequestProcessorSettings(settings))
           ->with_listener(session_)
           ->with_keyspace(session_->connect_keyspace())
           ->with_metrics(session_->metrics())
           ->with_random(session_->random())
+          ->with_deferred_hosts(deferred_hosts)
           ->initialize(session_->event_loop_group_->get(i));
     }
   }
@@ -272,28 +338,69 @@ private:
   RequestProcessor::Vec request_processors_;
 };
 
+// The data for the callback of a prepare that's sent on behalf of other
+// futures. The statement's key is captured when the prepare is sent because it
+// depends on the session's keyspace at that time.
+struct PrepareCallbackData : public Allocated {
+  PrepareCallbackData(Session* session, const String& key)
+      : session(session)
+      , key(key) {}
+
+  Session* session;
+  String key;
+};
+
+// Only prepares that are sent the same way are coalesced, otherwise the
+// settings of the first prepare would be applied to the others.
+static String pending_prepare_key(const String& keyspace, const PrepareRequest* prepare) {
+  const RequestSettings& settings(prepare->settings());
+  OStringStream ss;
+  ss << settings.consistency << ',' << settings.serial_consistency << ','
+     << settings.request_timeout_ms << ',' << settings.priority << ','
+     << static_cast<const void*>(settings.retry_policy.get()) << ',' << settings.is_idempotent
+     << ',' << settings.keyspace << ',' << prepare->execution_profile_name();
+  return PreparedMetadata::statement_key(keyspace, prepare->query()) + '\0' + ss.str();
+}
+
+// Whether a schema change can make the metadata of the statements prepared in
+// its keyspace stale.
+static bool is_prepared_metadata_stale(const SchemaChange& change) {
+  if (change.type == SchemaChange::CREATED) return false;
+  switch (change.target) {
+    case SchemaChange::KEYSPACE:
+      return change.type == SchemaChange::DROPPED;
+    case SchemaChange::TABLE:
+    case SchemaChange::VIEW:
+    case SchemaChange::USER_TYPE:
+      return true;
+    default:
+      return false;
+  }
+}
+
 }}} // namespace datastax::internal::core
 
 Session::Session()
     : request_processor_count_(0)
-    , is_closing_(false) {
+    , is_closing_(false)
+    , auto_prepare_cache_(new AutoPrepareCache()) {
   uv_mutex_init(&mutex_);
+  uv_mutex_init(&prepare_mutex_);
+  warm_prepared_.set_empty_key(String());
+  warm_prepared_.set_deleted_key(String(1, '\1'));
+  pending_prepares_.set_empty_key(String());
+  pending_prepares_.set_deleted_key(String(1, '\1'));
 }
 
 Session::~Session() {
   join();
+  uv_mutex_destroy(&prepare_mutex_);
   uv_mutex_destroy(&mutex_);
 }
 
 Future::Ptr Session::prepare(const char* statement, size_t length) {
   PrepareRequest::Ptr prepare(new PrepareRequest(String(statement, length)));
-
-  ResponseFuture::Ptr future(new ResponseFuture(cluster()->schema_snapshot()));
-  future->prepare_request = PrepareRequest::ConstPtr(prepare);
-
-  execute(RequestHandler::Ptr(new RequestHandler(prepare, future, metrics())));
-
-  return future;
+  return execute_prepare(prepare);
 }
 
 Future::Ptr Session::prepare(const Statement* statement) {
@@ -311,27 +418,219 @@ Future::Ptr Session::prepare(const Statement* statement) {
   // inherited by bound statements.
   prepare->set_settings(statement->settings());
 
+  return execute_prepare(prepare);
+}
+
+Future::Ptr Session::execute_prepare(const PrepareRequest::Ptr& prepare) {
   ResponseFuture::Ptr future(new ResponseFuture(cluster()->schema_snapshot()));
   future->prepare_request = PrepareRequest::ConstPtr(prepare);
 
-  execute(RequestHandler::Ptr(new RequestHandler(prepare, future, metrics())));
+  // An unqualified query means something else when the session's keyspace
+  // changes so previous and in-flight prepares are matched using the keyspace
+  // the query is prepared in.
+  String keyspace(prepare->keyspace());
+  Address address;
+  {
+    ScopedMutex l(&mutex_);
+    if (keyspace.empty()) keyspace = keyspace_;
+    address = connected_address_;
+  }
+
+  if (state() == SESSION_STATE_CONNECTED) {
+    // Use the result of a previous prepare of the same query
+    if (!keyspace.empty()) {
+      String key(PreparedMetadata::statement_key(keyspace, prepare->query()));
+
+      // Complete the future using the warm start snapshot's result and prepare
+      // the statement in the background (once). The server's response replaces
+      // the snapshot's prepared metadata and the snapshot's result is dropped.
+      ResultResponse::Ptr warm_result;
+      bool is_background_prepare_needed = false;
+      {
+        ScopedMutex l(&prepare_mutex_);
+        WarmPreparedMap::iterator it = warm_prepared_.find(key);
+        if (it != warm_prepared_.end()) {
+          warm_result = it->second.result;
+          is_background_prepare_needed = !it->second.is_preparing;
+          it->second.is_preparing = true;
+        }
+      }
+      if (warm_result) {
+        if (is_background_prepare_needed) {
+          ResponseFuture::Ptr background_future(new ResponseFuture());
+          background_future->set_callback(on_warm_prepare, new PrepareCallbackData(this, key));
+          execute(RequestHandler::Ptr(
+              new RequestHandler(prepare, background_future, metrics(), retry_budget())));
+        }
+        future->set_response(address, warm_result);
+        return future;
+      }
+
+      // A prepared result is only reused while schema changes would remove
+      // it, otherwise the server might have newer metadata.
+      PreparedMetadata::Entry::Ptr entry;
+      if (cluster()->is_schema_tracked(keyspace)) {
+        entry = cluster()->prepared(keyspace, prepare->query());
+      }
+      if (entry && entry->result()->kind() == CASS_RESULT_KIND_PREPARED) {
+        entry->mark_used();
+        future->set_response(address, entry->result());
+        return future;
+      }
+    }
+  }
+
+  // Wait for an identical prepare if there's one in flight, otherwise prepare
+  // the query using a separate future that completes all the waiting futures.
+  String key(pending_prepare_key(keyspace, prepare.get()));
+  {
+    ScopedMutex l(&prepare_mutex_);
+    PendingPrepareMap::iterator it = pending_prepares_.find(key);
+    if (it != pending_prepares_.end()) {
+      it->second.push_back(future);
+      return future;
+    }
+    pending_prepares_[key].push_back(future);
+  }
+
+  ResponseFuture::Ptr prepare_future(new ResponseFuture());
+  prepare_future->prepare_request = PrepareRequest::ConstPtr(prepare);
+  prepare_future->set_callback(on_prepare, new PrepareCallbackData(this, key));
+  execute(
+      RequestHandler::Ptr(new RequestHandler(prepare, prepare_future, metrics(), retry_budget())));
 
   return future;
 }
 
-Future::Ptr Session::execute(const Request::ConstPtr& request) {
+void Session::on_prepare(CassFuture* future, void* data) {
+  PrepareCallbackData* callback_data = static_cast<PrepareCallbackData*>(data);
+  callback_data->session->handle_prepare(static_cast<ResponseFuture*>(future->from()),
+                                         callback_data->key);
+  delete callback_data;
+}
+
+void Session::on_warm_prepare(CassFuture* future, void* data) {
+  PrepareCallbackData* callback_data = static_cast<PrepareCallbackData*>(data);
+  callback_data->session->handle_warm_prepare(callback_data->key);
+  delete callback_data;
+}
+
+void Session::handle_warm_prepare(const String& key) {
+  // The statement's live metadata is used from now on. If the background
+  // prepare failed the statement is prepared again when it's next used.
+  ScopedMutex l(&prepare_mutex_);
+  warm_prepared_.erase(key);
+}
+
+void Session::handle_prepare(ResponseFuture* future, const String& key) {
+  Vector<ResponseFuture::Ptr> futures;
+  {
+    ScopedMutex l(&prepare_mutex_);
+    PendingPrepareMap::iterator it = pending_prepares_.find(key);
+    if (it == pending_prepares_.end()) return;
+    futures.swap(it->second);
+    pending_prepares_.erase(it);
+  }
+
+  const Address& address = future->address();
+  const Response::ConstPtr& response = future->response();
+  const Future::Error* error = future->error();
+  for (Vector<ResponseFuture::Ptr>::const_iterator it = futures.begin(), end = futures.end();
+       it != end; ++it) {
+    if (error) {
+      (*it)->set_error_with_response(address, response, error->code, error->message);
+    } else {
+      (*it)->set_response(address, response);
+    }
+  }
+}
+
+Future::Ptr Session::execute(const Request::ConstPtr& request,
+                             const CompletionQueue::Ptr& completion_queue, void* tag) {
   ResponseFuture::Ptr future(new ResponseFuture());
+  if (completion_queue) {
+    future->set_completion_queue(completion_queue, tag);
+  }
+
+  execute(create_request_handler(request, future));
+
+  return future;
+}
+
+void Session::execute(const Request::ConstPtr* requests, size_t count, Future::Ptr* futures) {
+  if (count == 0) return;
+
+  SmallVector<RequestHandler::Ptr, 64> request_handlers(count);
+  for (size_t i = 0; i < count; ++i) {
+    ResponseFuture::Ptr future(new ResponseFuture());
+    request_handlers[i] = create_request_handler(requests[i], future);
+    futures[i].reset(future.get());
+  }
+
+  if (state() != SESSION_STATE_CONNECTED) {
+    for (size_t i = 0; i < count; ++i) {
+      request_handlers[i]->set_error(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, "Session is not connected");
+    }
+    return;
+  }
+
+  // Split the requests into contiguous chunks, one per processor, so that each
+  // processor's queue is reserved and woken up once. The least busy processor
+  // takes the first chunk. See execute(const RequestHandler::Ptr&) for why the
+  // processors aren't locked.
+  size_t num_processors = request_processors_.size();
+  size_t start = std::min_element(request_processors_.begin(), request_processors_.end(),
+                                  least_busy_comp) -
+                 request_processors_.begin();
+  size_t chunk_size = (count + num_processors - 1) / num_processors;
+  for (size_t i = 0, offset = 0; offset < count; ++i, offset += chunk_size) {
+    const RequestProcessor::Ptr& request_processor =
+        request_processors_[(start + i) % num_processors];
+    request_processor->process_requests(&request_handlers[offset],
+                                        std::min(chunk_size, count - offset));
+  }
+}
+
+Request::ConstPtr Session::maybe_auto_prepare(const Request::ConstPtr& request) {
+  if (config().auto_prepare_threshold() == 0 || config().auto_prepare_max_statements() == 0 ||
+      request->opcode() != CQL_OPCODE_QUERY) {
+    return request;
+  }
+
+  // Named values and custom payloads aren't carried over to bound statements
+  const Statement* statement = static_cast<const Statement*>(request.get());
+  if (statement->has_names_for_values() || statement->has_custom_payload()) return request;
+
+  PrepareRequest::Ptr prepare;
+  Prepared::ConstPtr prepared(auto_prepare_cache_->get(statement, &prepare));
+  if (prepare) {
+    LOG_DEBUG("Automatically preparing query \"%s\"", prepare->query().c_str());
+    ResponseFuture::Ptr future(new ResponseFuture(cluster()->schema_snapshot()));
+    future->prepare_request = PrepareRequest::ConstPtr(prepare);
+    auto_prepare_cache_->set_callback(future);
+    execute(RequestHandler::Ptr(new RequestHandler(prepare, future, metrics(), retry_budget())));
+  }
 
-  RequestHandler::Ptr request_handler(new RequestHandler(request, future, metrics()));
+  if (!prepared ||
+      static_cast<size_t>(prepared->result()->column_count()) != statement->elements().size()) {
+    return request;
+  }
+  return Request::ConstPtr(new ExecuteRequest(prepared.get(), statement));
+}
+
+RequestHandler::Ptr Session::create_request_handler(const Request::ConstPtr& request,
+                                                    const ResponseFuture::Ptr& future) {
+  RequestHandler::Ptr request_handler(
+      new RequestHandler(maybe_auto_prepare(request), future, metrics(), retry_budget()));
 
   if (request_handler->request()->opcode() == CQL_OPCODE_EXECUTE) {
     const ExecuteRequest* execute = static_cast<const ExecuteRequest*>(request_handler->request());
-    request_handler->set_prepared_metadata(cluster()->prepared(execute->prepared()->id()));
+    PreparedMetadata::Entry::Ptr entry(cluster()->prepared(execute->prepared()->id()));
+    if (entry) entry->mark_used();
+    request_handler->set_prepared_metadata(entry);
   }
 
-  execute(request_handler);
-
-  return future;
+  return request_handler;
 }
 
 void Session::execute(const RequestHandler::Ptr& request_handler) {
@@ -389,14 +688,46 @@ void Session::on_connect(const Host::Ptr& connected_host, ProtocolVersion protoc
         host); // If host is down it will be marked down later in the connection process
   }
 
+  load_warm_start_snapshot(connected_host, protocol_version, hosts);
+
+  {
+    ScopedMutex l(&mutex_);
+    keyspace_ = connect_keyspace();
+    connected_address_ = connected_host->address();
+  }
+
+  // The cache is created with the session and never replaced because it's
+  // used by application threads without a lock.
+  auto_prepare_cache_->configure(config().auto_prepare_threshold(),
+                                 config().auto_prepare_max_statements());
+
+  // Only wait for the local hosts' pools, the remaining pools are connected in
+  // the background.
+  HostMap deferred_hosts;
+  if (config().local_hosts_first_connect()) {
+    const HostMap local_hosts(cluster()->local_hosts());
+    if (!local_hosts.empty()) {
+      for (HostMap::const_iterator it = hosts.begin(), end = hosts.end(); it != end; ++it) {
+        if (local_hosts.find(it->first) == local_hosts.end()) {
+          deferred_hosts[it->first] = it->second;
+        }
+      }
+    }
+  }
+
   request_processors_.clear();
   request_processor_count_ = 0;
   is_closing_ = false;
   SessionInitializer::Ptr initializer(new SessionInitializer(this));
-  initializer->initialize(connected_host, protocol_version, hosts, token_map, local_dc);
+  initializer->initialize(connected_host, protocol_version, hosts, deferred_hosts, token_map,
+                          local_dc);
 }
 
 void Session::on_close() {
+  // The snapshot is only used on the session's event loop so it's saved
+  // without holding the lock used by application threads.
+  save_warm_start_snapshot();
+
   // If there are request processors still connected those need to be closed
   // first before sending the close notification.
   ScopedMutex l(&mutex_);
@@ -412,6 +743,67 @@ void Session::on_close() {
   }
 }
 
+void Session::load_warm_start_snapshot(const Host::Ptr& connected_host,
+                                       ProtocolVersion protocol_version, const HostMap& hosts) {
+  {
+    ScopedMutex l(&prepare_mutex_);
+    warm_prepared_.clear();
+  }
+  warm_start_snapshot_.reset();
+
+  const String& path(config().prepared_snapshot_path());
+  if (path.empty()) return;
+
+  WarmStartSnapshot::Ptr snapshot(WarmStartSnapshot::load(path));
+  if (snapshot && snapshot->is_valid_for(connected_host, protocol_version, connect_keyspace())) {
+    const WarmStartSnapshot::PreparedEntryVec& entries(snapshot->prepared());
+    unsigned count = 0;
+    for (WarmStartSnapshot::PreparedEntryVec::const_iterator it = entries.begin(),
+                                                             end = entries.end();
+         it != end; ++it) {
+      ResultResponse::Ptr result(snapshot->decode_result(*it));
+      if (!result) continue;
+      if (!it->keyspace.empty()) { // Prepares are only looked up using a keyspace
+        ScopedMutex l(&prepare_mutex_);
+        warm_prepared_[PreparedMetadata::statement_key(it->keyspace, it->query)] =
+            WarmPrepared(result);
+      }
+      ++count;
+      // Make the statement available for re-preparing and preparing on hosts
+      // that are added or come up.
+      cluster()->prepared(result->prepared_id().to_string(),
+                          PreparedMetadata::Entry::Ptr(new PreparedMetadata::Entry(
+                              it->query, it->keyspace, result->result_metadata_id().to_string(),
+                              result)));
+    }
+    LOG_INFO("Using prepared statement snapshot '%s' with %u prepared statements", path.c_str(),
+             count);
+  } else if (snapshot) {
+    LOG_INFO("Ignoring prepared statement snapshot '%s' because it was saved for a different "
+             "cluster or session configuration",
+             path.c_str());
+  }
+
+  // The hosts are captured here because the cluster's hosts can't be safely
+  // accessed when the session is closed.
+  warm_start_snapshot_.reset(new WarmStartSnapshot(protocol_version, connect_keyspace()));
+  for (HostMap::const_iterator it = hosts.begin(), end = hosts.end(); it != end; ++it) {
+    warm_start_snapshot_->add_host(it->second);
+  }
+}
+
+void Session::save_warm_start_snapshot() {
+  if (!warm_start_snapshot_) return;
+
+  PreparedMetadata::Entry::Vec entries(cluster()->prepared_entries());
+  for (PreparedMetadata::Entry::Vec::const_iterator it = entries.begin(), end = entries.end();
+       it != end; ++it) {
+    warm_start_snapshot_->add_prepared(*it);
+  }
+  warm_start_snapshot_->save(config().prepared_snapshot_path());
+  warm_start_snapshot_.reset();
+}
+
 void Session::on_host_up(const Host::Ptr& host) {
   // Ignore up events from the control connection; however external host
   // listeners should still be notified. The connection pools will reconnect
@@ -465,6 +857,39 @@ void Session::on_token_map_updated(const TokenMap::Ptr& token_map) {
   }
 }
 
+void Session::on_schema_changed(const SchemaChange::Vec& changes) {
+  // Prepared results are reused to complete prepares without sending them to
+  // the server. Their metadata is stale when a table, view or type of their
+  // keyspace changes so the keyspace's statements are prepared again.
+  Vector<String> keyspaces;
+  for (SchemaChange::Vec::const_iterator it = changes.begin(), end = changes.end(); it != end;
+       ++it) {
+    if (is_prepared_metadata_stale(*it) &&
+        std::find(keyspaces.begin(), keyspaces.end(), it->keyspace_name) == keyspaces.end()) {
+      keyspaces.push_back(it->keyspace_name);
+    }
+  }
+
+  for (Vector<String>::const_iterator it = keyspaces.begin(), end = keyspaces.end(); it != end;
+       ++it) {
+    LOG_DEBUG("Schema of keyspace '%s' changed; its statements will be prepared again",
+              it->c_str());
+    cluster()->remove_prepared_statements(*it);
+
+    String quoted_keyspace(*it);
+    escape_id(quoted_keyspace);
+    ScopedMutex l(&prepare_mutex_);
+    for (WarmPreparedMap::iterator warm_it = warm_prepared_.begin(),
+                                   warm_end = warm_prepared_.end();
+         warm_it != warm_end; ++warm_it) {
+      if (warm_it->second.result->keyspace() == *it ||
+          warm_it->first.compare(0, warm_it->first.find('\0'), quoted_keyspace) == 0) {
+        warm_prepared_.erase(warm_it);
+      }
+    }
+  }
+}
+
 void Session::on_host_maybe_up(const Host::Ptr& host) {
   ScopedMutex l(&mutex_);
   for (RequestProcessor::Vec::const_iterator it = request_processors_.begin(),
@@ -494,7 +919,12 @@ void Session::on_pool_critical_error(const Address& address, Connector::Connecti
 
 void Session::on_keyspace_changed(const String& keyspace,
                                   const KeyspaceChangedHandler::Ptr& handler) {
+  // Unqualified table names in the tracked statements might now refer to
+  // different tables.
+  auto_prepare_cache_->clear();
+
   ScopedMutex l(&mutex_);
+  keyspace_ = keyspace;
   for (RequestProcessor::Vec::const_iterator it = request_processors_.begin(),
                                              end = request_processors_.end();
        it != end; ++it) {
@@ -18,10 +18,13 @@
 #define DATASTAX_INTERNAL_SESSION_HPP
 
 #include "allocated.hpp"
+#include "auto_prepare_cache.hpp"
+#include "completion_queue.hpp"
 #include "metrics.hpp"
 #include "mpmc_queue.hpp"
 #include "request_processor.hpp"
 #include "session_base.hpp"
+#include "warm_start.hpp"
 
 #include <uv.h>
 
@@ -42,9 +45,32 @@ public:
 
   Future::Ptr prepare(const Statement* statement);
 
-  Future::Ptr execute(const Request::ConstPtr& request);
+  Future::Ptr execute(const Request::ConstPtr& request,
+                      const CompletionQueue::Ptr& completion_queue = CompletionQueue::Ptr(),
+                      void* tag = NULL);
+
+  void execute(const Request::ConstPtr* requests, size_t count, Future::Ptr* futures);
+
+  const AutoPrepareCache::Ptr& auto_prepare_cache() const { return auto_prepare_cache_; }
 
 private:
+  Future::Ptr execute_prepare(const PrepareRequest::Ptr& prepare);
+
+  static void on_prepare(CassFuture* future, void* data);
+  void handle_prepare(ResponseFuture* future, const String& key);
+
+  static void on_warm_prepare(CassFuture* future, void* data);
+  void handle_warm_prepare(const String& key);
+
+  void load_warm_start_snapshot(const Host::Ptr& connected_host,
+                                ProtocolVersion protocol_version, const HostMap& hosts);
+  void save_warm_start_snapshot();
+
+  Request::ConstPtr maybe_auto_prepare(const Request::ConstPtr& request);
+
+  RequestHandler::Ptr create_request_handler(const Request::ConstPtr& request,
+                                             const ResponseFuture::Ptr& future);
+
   void execute(const RequestHandler::Ptr& request_handler);
 
   void join();
@@ -77,6 +103,8 @@ private:
 
   virtual void on_host_ready(const Host::Ptr& host);
 
+  virtual void on_schema_changed(const SchemaChange::Vec& changes);
+
 private:
   // Request processor listener methods
 
@@ -106,6 +134,37 @@ private:
   RequestProcessor::Vec request_processors_;
   size_t request_processor_count_;
   bool is_closing_;
+
+  // A prepared result from the warm start snapshot. It's used until the
+  // statement's background prepare completes.
+  struct WarmPrepared {
+    WarmPrepared()
+        : is_preparing(false) {}
+    WarmPrepared(const ResultResponse::Ptr& result)
+        : result(result)
+        , is_preparing(false) {}
+
+    ResultResponse::Ptr result;
+    bool is_preparing;
+  };
+
+  // Populated when the session connects, keyed by keyspace and query, and
+  // protected by the prepare mutex.
+  typedef DenseHashMap<String, WarmPrepared> WarmPreparedMap;
+  WarmPreparedMap warm_prepared_;
+  WarmStartSnapshot::Ptr warm_start_snapshot_;
+  AutoPrepareCache::Ptr auto_prepare_cache_;
+
+  // The keyspace set by the last "USE <keyspace>" query (or when connecting).
+  String keyspace_;
+  // The address of the control connection's host when the session connected.
+  Address connected_address_;
+
+  // Futures waiting for an identical prepare that's already in flight, keyed
+  // by keyspace, query and the prepare's settings.
+  typedef DenseHashMap<String, Vector<ResponseFuture::Ptr> > PendingPrepareMap;
+  uv_mutex_t prepare_mutex_;
+  PendingPrepareMap pending_prepares_;
 };
 
 }}} // namespace datastax::internal::core
@@ -99,6 +99,12 @@ Future::Ptr SessionBase::connect(const Config& config, const String& keyspace) {
 
   metrics_.reset(new Metrics(config.thread_count_io() + 1));
 
+  if (config.retry_budget_settings().is_enabled()) {
+    retry_budget_.reset(new RetryBudget(config.retry_budget_settings()));
+  } else {
+    retry_budget_.reset();
+  }
+
   cluster_.reset();
   ClusterConnector::Ptr connector(
       new ClusterConnector(config_.contact_points(), config_.protocol_version(),
@@ -78,6 +78,7 @@ public:
   Cluster::Ptr cluster() const { return cluster_; }
   Random* random() const { return random_.get(); }
   Metrics* metrics() const { return metrics_.get(); }
+  RetryBudget* retry_budget() const { return retry_budget_.get(); }
   State state() const { return state_; }
 
 protected:
@@ -155,6 +156,7 @@ private:
   Config config_;
   ScopedPtr<Random> random_;
   ScopedPtr<Metrics> metrics_;
+  ScopedPtr<RetryBudget> retry_budget_;
   String connect_keyspace_;
   CassError connect_error_code_;
   String connect_error_message_;
@@ -85,6 +85,7 @@ private:
 SocketSettings::SocketSettings()
     : hostname_resolution_enabled(CASS_DEFAULT_HOSTNAME_RESOLUTION_ENABLED)
     , resolve_timeout_ms(CASS_DEFAULT_RESOLVE_TIMEOUT_MS)
+    , resolve_cache_ttl_ms(CASS_DEFAULT_RESOLVE_CACHE_TTL_MS)
     , tcp_nodelay_enabled(CASS_DEFAULT_TCP_NO_DELAY_ENABLED)
     , tcp_keepalive_enabled(CASS_DEFAULT_TCP_KEEPALIVE_ENABLED)
     , tcp_keepalive_delay_secs(CASS_DEFAULT_TCP_KEEPALIVE_DELAY_SECS)
@@ -93,6 +94,7 @@ SocketSettings::SocketSettings()
 SocketSettings::SocketSettings(const Config& config)
     : hostname_resolution_enabled(config.use_hostname_resolution())
     , resolve_timeout_ms(config.resolve_timeout_ms())
+    , resolve_cache_ttl_ms(config.resolve_cache_ttl_ms())
     , ssl_context(config.ssl_context())
     , tcp_nodelay_enabled(config.tcp_nodelay_enable())
     , tcp_keepalive_enabled(config.tcp_keepalive_enable())
@@ -121,6 +123,7 @@ void SocketConnector::connect(uv_loop_t* loop) {
 
     resolver_.reset(new Resolver(hostname_, address_.port(),
                                  bind_callback(&SocketConnector::on_resolve, this)));
+    resolver_->set_cache_ttl_ms(settings_.resolve_cache_ttl_ms);
     resolver_->resolve(loop, settings_.resolve_timeout_ms);
   } else {
     resolved_address_ = address_;
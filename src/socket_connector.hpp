@@ -46,6 +46,7 @@ struct SocketSettings {
 
   bool hostname_resolution_enabled;
   uint64_t resolve_timeout_ms;
+  uint64_t resolve_cache_ttl_ms;
   SslContext::Ptr ssl_context;
   bool tcp_nodelay_enabled;
   bool tcp_keepalive_enabled;
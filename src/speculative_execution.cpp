@@ -0,0 +1,106 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "speculative_execution.hpp"
+
+#include "utils.hpp"
+
+#include <algorithm>
+#include <math.h>
+#include <uv.h>
+
+using namespace datastax::internal::core;
+
+PercentileTracker::PercentileTracker(double percentile, double max_speculative_ratio,
+                                     uint64_t window_ns)
+    : percentile_(percentile)
+    , budget_per_request_(static_cast<int64_t>(max_speculative_ratio * EXECUTION_COST))
+    , window_ns_(window_ns)
+    , window_end_ns_(uv_hrtime() + window_ns)
+    , active_index_(0)
+    , delay_ms_(-1) {
+  for (size_t i = 0; i < 2; ++i) {
+    for (int j = 0; j < NUM_BUCKETS; ++j) {
+      counts_[i][j].store(0, MEMORY_ORDER_RELAXED);
+    }
+  }
+}
+
+void PercentileTracker::record_latency(uint64_t latency_ns) {
+  size_t index = active_index_.load(MEMORY_ORDER_RELAXED);
+  counts_[index][bucket_index(latency_ns / 1000)].fetch_add(1, MEMORY_ORDER_RELAXED);
+
+  // Only a single thread moves the window forward
+  uint64_t now = uv_hrtime();
+  uint64_t window_end = window_end_ns_.load(MEMORY_ORDER_RELAXED);
+  if (now >= window_end &&
+      window_end_ns_.compare_exchange_strong(window_end, now + window_ns_, MEMORY_ORDER_RELAXED)) {
+    rotate(index);
+  }
+}
+
+void PercentileTracker::add_request() { budget_.deposit(budget_per_request_, MAX_BUDGET); }
+
+bool PercentileTracker::acquire_execution() {
+  return budget_.try_acquire(EXECUTION_COST, MAX_BUDGET);
+}
+
+int PercentileTracker::bucket_index(uint64_t latency_us) {
+  if (latency_us < SUB_BUCKET_COUNT) return static_cast<int>(latency_us);
+  if (latency_us > 0xFFFFFFFFULL) latency_us = 0xFFFFFFFFULL;
+  int msb = 63 - num_leading_zeros(static_cast<int64_t>(latency_us));
+  return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT +
+         static_cast<int>((latency_us >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1));
+}
+
+uint64_t PercentileTracker::bucket_upper_bound(int index) {
+  if (index < SUB_BUCKET_COUNT) return index;
+  int shift = index / SUB_BUCKET_COUNT - 1;
+  uint64_t lower = static_cast<uint64_t>(SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT) << shift;
+  return lower + (static_cast<uint64_t>(1) << shift) - 1;
+}
+
+void PercentileTracker::rotate(size_t index) {
+  // New latencies are recorded in the other window while this one is used to
+  // compute the delay. A few latencies recorded concurrently with the rotation
+  // might be counted in the wrong window, which is fine for this purpose.
+  active_index_.store(1 - index, MEMORY_ORDER_RELAXED);
+
+  Atomic<int64_t>* counts = counts_[index];
+  int64_t total = 0;
+  for (int i = 0; i < NUM_BUCKETS; ++i) {
+    total += counts[i].load(MEMORY_ORDER_RELAXED);
+  }
+
+  if (total < MIN_SAMPLES) {
+    delay_ms_.store(-1, MEMORY_ORDER_RELAXED);
+  } else {
+    int64_t target = std::max(static_cast<int64_t>(ceil(total * percentile_ / 100.0)),
+                              static_cast<int64_t>(1));
+    int64_t seen = 0;
+    int i = 0;
+    for (; i < NUM_BUCKETS - 1; ++i) {
+      seen += counts[i].load(MEMORY_ORDER_RELAXED);
+      if (seen >= target) break;
+    }
+    int64_t delay_ms = static_cast<int64_t>((bucket_upper_bound(i) + 999) / 1000);
+    delay_ms_.store(std::max(delay_ms, static_cast<int64_t>(1)), MEMORY_ORDER_RELAXED);
+  }
+
+  for (int i = 0; i < NUM_BUCKETS; ++i) {
+    counts[i].store(0, MEMORY_ORDER_RELAXED);
+  }
+}
@@ -18,9 +18,11 @@
 #define DATASTAX_INTERNAL_SPECULATIVE_EXECUTION_HPP
 
 #include "allocated.hpp"
+#include "atomic.hpp"
 #include "host.hpp"
 #include "ref_counted.hpp"
 #include "string.hpp"
+#include "token_bucket.hpp"
 
 #include <stdint.h>
 
@@ -33,6 +35,18 @@ public:
   virtual ~SpeculativeExecutionPlan() {}
 
   virtual int64_t next_execution(const Host::Ptr& current_host) = 0;
+
+  /**
+   * Determines if a scheduled speculative execution should be started. This is
+   * called when the delay returned by `next_execution()` has elapsed.
+   */
+  virtual bool allow_execution() { return true; }
+
+  /**
+   * Called with the latency of each execution of the request that received a
+   * response.
+   */
+  virtual void record_latency(const Host::Ptr& current_host, uint64_t latency_ns) {}
 };
 
 class SpeculativeExecutionPolicy : public RefCounted<SpeculativeExecutionPolicy> {
@@ -93,6 +107,130 @@ public:
   const int max_speculative_executions_;
 };
 
+/**
+ * Tracks the latency distribution of a profile's requests over a window and
+ * a budget that limits speculative executions to a share of the requests.
+ * This is shared by all the requests (and threads) using the profile.
+ */
+class PercentileTracker : public RefCounted<PercentileTracker> {
+public:
+  typedef SharedRefPtr<PercentileTracker> Ptr;
+
+  // The delay is computed from the previous window's latencies
+  static const uint64_t WINDOW_NS = 5LL * 1000LL * 1000LL * 1000LL;
+  static const int64_t MIN_SAMPLES = 100;
+
+  PercentileTracker(double percentile, double max_speculative_ratio,
+                    uint64_t window_ns = WINDOW_NS);
+
+  void record_latency(uint64_t latency_ns);
+
+  /**
+   * The delay before starting a speculative execution.
+   *
+   * @return The delay in milliseconds or -1 if not enough latencies have been
+   * recorded.
+   */
+  int64_t delay_ms() const { return delay_ms_.load(MEMORY_ORDER_RELAXED); }
+
+  /**
+   * Adds to the speculative execution budget for a new request.
+   */
+  void add_request();
+
+  /**
+   * Takes a speculative execution from the budget.
+   *
+   * @return false if the budget is exhausted.
+   */
+  bool acquire_execution();
+
+private:
+  // Log-linear buckets (microseconds) with 8 sub-buckets per power of two.
+  static const int SUB_BUCKET_BITS = 3;
+  static const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+  static const int NUM_BUCKETS = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+  // Budget units for a single speculative execution and the maximum that can
+  // be saved up while requests aren't being speculatively executed.
+  static const int64_t EXECUTION_COST = 1000;
+  static const int64_t MAX_BUDGET = 10 * EXECUTION_COST;
+
+  static int bucket_index(uint64_t latency_us);
+  static uint64_t bucket_upper_bound(int index);
+
+  void rotate(size_t index);
+
+private:
+  const double percentile_;
+  const int64_t budget_per_request_;
+  const uint64_t window_ns_;
+  Atomic<uint64_t> window_end_ns_;
+  Atomic<size_t> active_index_;
+  Atomic<int64_t> counts_[2][NUM_BUCKETS];
+  Atomic<int64_t> delay_ms_;
+  TokenBucket budget_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(PercentileTracker);
+};
+
+class PercentileSpeculativeExecutionPlan : public SpeculativeExecutionPlan {
+public:
+  PercentileSpeculativeExecutionPlan(const PercentileTracker::Ptr& tracker, int count)
+      : tracker_(tracker)
+      , count_(count) {}
+
+  virtual int64_t next_execution(const Host::Ptr& current_host) {
+    if (--count_ < 0) return -1;
+    int64_t delay_ms = tracker_->delay_ms();
+    // Don't start speculative executions until there's enough data
+    return delay_ms >= 0 ? delay_ms : -1;
+  }
+
+  virtual bool allow_execution() { return tracker_->acquire_execution(); }
+
+  virtual void record_latency(const Host::Ptr& current_host, uint64_t latency_ns) {
+    tracker_->record_latency(latency_ns);
+  }
+
+private:
+  PercentileTracker::Ptr tracker_;
+  int count_;
+};
+
+/**
+ * A speculative execution policy that uses a percentile of the recent request
+ * latencies as the delay and caps the share of requests that are speculatively
+ * executed.
+ */
+class PercentileSpeculativeExecutionPolicy : public SpeculativeExecutionPolicy {
+public:
+  PercentileSpeculativeExecutionPolicy(double percentile, int max_speculative_executions,
+                                       double max_speculative_ratio)
+      : percentile_(percentile)
+      , max_speculative_executions_(max_speculative_executions)
+      , max_speculative_ratio_(max_speculative_ratio)
+      , tracker_(new PercentileTracker(percentile, max_speculative_ratio)) {}
+
+  virtual SpeculativeExecutionPlan* new_plan(const String& keyspace, const Request* request) {
+    tracker_->add_request();
+    return new PercentileSpeculativeExecutionPlan(tracker_, max_speculative_executions_);
+  }
+
+  virtual SpeculativeExecutionPolicy* new_instance() {
+    return new PercentileSpeculativeExecutionPolicy(percentile_, max_speculative_executions_,
+                                                    max_speculative_ratio_);
+  }
+
+  const double percentile_;
+  const int max_speculative_executions_;
+  const double max_speculative_ratio_;
+
+private:
+  PercentileTracker::Ptr tracker_;
+};
+
 }}} // namespace datastax::internal::core
 
 #endif
@@ -17,6 +17,8 @@
 #include "atomic.hpp"
 #include "macros.hpp"
 
+#include <assert.h>
+
 #ifndef DATASTAX_INTERNAL_SPINLOCK_HPP
 #define DATASTAX_INTERNAL_SPINLOCK_HPP
 
@@ -118,6 +118,19 @@ CassError cass_statement_set_request_timeout(CassStatement* statement, cass_uint
   return CASS_OK;
 }
 
+CassError cass_statement_set_deadline(CassStatement* statement, cass_uint64_t deadline_ms) {
+  statement->set_deadline_ms(deadline_ms);
+  return CASS_OK;
+}
+
+CassError cass_statement_set_priority(CassStatement* statement, CassRequestPriority priority) {
+  if (priority >= CASS_REQUEST_PRIORITY_LAST_ENTRY && priority != CASS_REQUEST_PRIORITY_UNKNOWN) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  statement->set_priority(priority);
+  return CASS_OK;
+}
+
 CassError cass_statement_set_is_idempotent(CassStatement* statement, cass_bool_t is_idempotent) {
   statement->set_is_idempotent(is_idempotent == cass_true);
   return CASS_OK;
@@ -214,6 +227,10 @@ CASS_STATEMENT_BIND(decimal,
 CASS_STATEMENT_BIND(duration,
                     THREE_PARAMS_(cass_int32_t months, cass_int32_t days, cass_int64_t nanos),
                     CassDuration(months, days, nanos))
+CASS_STATEMENT_BIND(float_vector, TWO_PARAMS_(const cass_float_t* values, size_t count),
+                    CassFloatVector(values, count))
+CASS_STATEMENT_BIND(double_vector, TWO_PARAMS_(const cass_double_t* values, size_t count),
+                    CassDoubleVector(values, count))
 
 #undef CASS_STATEMENT_BIND
 
@@ -0,0 +1,77 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "thread_local.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace datastax::internal;
+
+uv_once_t ThreadLocalBase::init_guard_ = UV_ONCE_INIT;
+uv_key_t ThreadLocalBase::key_;
+uv_mutex_t ThreadLocalBase::mutex_;
+uint64_t ThreadLocalBase::next_id_ = 0;
+size_t ThreadLocalBase::slot_count_ = 0;
+Vector<size_t>* ThreadLocalBase::free_slots_ = NULL;
+
+ThreadLocalBase::ThreadLocalBase() {
+  uv_once(&init_guard_, init);
+  ScopedMutex l(&mutex_);
+  id_ = ++next_id_;
+  if (free_slots_->empty()) {
+    slot_ = slot_count_++;
+  } else {
+    slot_ = free_slots_->back();
+    free_slots_->pop_back();
+  }
+}
+
+ThreadLocalBase::~ThreadLocalBase() {
+  ScopedMutex l(&mutex_);
+  free_slots_->push_back(slot_);
+}
+
+void* ThreadLocalBase::get_value() const {
+  SlotVec* slots = static_cast<SlotVec*>(uv_key_get(&key_));
+  if (slots == NULL || slot_ >= slots->size()) return NULL;
+  const Slot& slot = (*slots)[slot_];
+  return slot.id == id_ ? slot.value : NULL;
+}
+
+void ThreadLocalBase::set_value(void* value) {
+  SlotVec* slots = static_cast<SlotVec*>(uv_key_get(&key_));
+  if (slots == NULL) {
+    slots = new SlotVec();
+    uv_key_set(&key_, slots);
+  }
+  if (slot_ >= slots->size()) {
+    slots->resize(slot_ + 1);
+  }
+  Slot& slot = (*slots)[slot_];
+  slot.id = id_;
+  slot.value = value;
+}
+
+void ThreadLocalBase::init() {
+  int rc = uv_key_create(&key_);
+  if (rc != 0) {
+    fprintf(stderr, "Unable to create thread-local storage key: %s\n", uv_strerror(rc));
+    abort();
+  }
+  uv_mutex_init(&mutex_);
+  free_slots_ = new Vector<size_t>();
+}
@@ -0,0 +1,116 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_THREAD_LOCAL_HPP
+#define DATASTAX_INTERNAL_THREAD_LOCAL_HPP
+
+#include "macros.hpp"
+#include "scoped_lock.hpp"
+#include "vector.hpp"
+
+#include <stdint.h>
+#include <uv.h>
+
+namespace datastax { namespace internal {
+
+/**
+ * The storage shared by all thread-local objects. There's a single
+ * process-wide key whose per-thread value is a table of slots; each object
+ * is assigned a slot when it's constructed and releases it when it's
+ * destroyed. Slots are tagged with a unique object id so that a reused slot
+ * never returns a value left behind by a previous owner.
+ *
+ * A thread's table is not reclaimed when the thread exits because libuv keys
+ * don't support destructors. It only holds a slot per live object.
+ */
+class ThreadLocalBase {
+protected:
+  ThreadLocalBase();
+  ~ThreadLocalBase();
+
+  void* get_value() const;
+  void set_value(void* value);
+
+private:
+  struct Slot {
+    Slot()
+        : id(0)
+        , value(NULL) {}
+    uint64_t id;
+    void* value;
+  };
+
+  typedef Vector<Slot> SlotVec;
+
+  static void init();
+
+private:
+  static uv_once_t init_guard_;
+  static uv_key_t key_;
+  static uv_mutex_t mutex_;
+  static uint64_t next_id_;
+  static size_t slot_count_;
+  static Vector<size_t>* free_slots_;
+
+  uint64_t id_;
+  size_t slot_;
+};
+
+/**
+ * Per-object, per-thread storage. Lookups only touch the thread's own slot;
+ * the mutex is taken once per thread when its value is first registered.
+ *
+ * Values are owned by this object and are freed when it's destroyed, not
+ * when their thread exits.
+ */
+template <class T>
+class ThreadLocal : public ThreadLocalBase {
+public:
+  ThreadLocal() { uv_mutex_init(&mutex_); }
+
+  ~ThreadLocal() {
+    for (typename Vector<T*>::iterator it = values_.begin(), end = values_.end(); it != end;
+         ++it) {
+      delete *it;
+    }
+    uv_mutex_destroy(&mutex_);
+  }
+
+  /**
+   * The calling thread's value or NULL if it hasn't been set.
+   */
+  T* get() const { return static_cast<T*>(get_value()); }
+
+  /**
+   * Registers the calling thread's value and takes ownership of it.
+   */
+  void set(T* value) {
+    ScopedMutex l(&mutex_);
+    set_value(value);
+    values_.push_back(value);
+  }
+
+private:
+  uv_mutex_t mutex_;
+  Vector<T*> values_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ThreadLocal);
+};
+
+}} // namespace datastax::internal
+
+#endif
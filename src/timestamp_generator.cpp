@@ -44,6 +44,21 @@ CassTimestampGen* cass_timestamp_gen_monotonic_new_with_settings(int64_t warning
   return CassTimestampGen::to(timestamp_gen);
 }
 
+CassTimestampGen* cass_timestamp_gen_monotonic_thread_local_new() {
+  TimestampGenerator* timestamp_gen = new ThreadLocalMonotonicTimestampGenerator();
+  timestamp_gen->inc_ref();
+  return CassTimestampGen::to(timestamp_gen);
+}
+
+CassTimestampGen*
+cass_timestamp_gen_monotonic_thread_local_new_with_settings(int64_t warning_threshold_us,
+                                                            int64_t warning_interval_ms) {
+  TimestampGenerator* timestamp_gen =
+      new ThreadLocalMonotonicTimestampGenerator(warning_threshold_us, warning_interval_ms);
+  timestamp_gen->inc_ref();
+  return CassTimestampGen::to(timestamp_gen);
+}
+
 void cass_timestamp_gen_free(CassTimestampGen* timestamp_gen) { timestamp_gen->dec_ref(); }
 
 } // extern "C"
@@ -58,6 +73,16 @@ int64_t MonotonicTimestampGenerator::next() {
   }
 }
 
+int64_t ThreadLocalMonotonicTimestampGenerator::next() {
+  Last* last = thread_last_.get();
+  if (last == NULL) {
+    last = new Last();
+    thread_last_.set(last);
+  }
+  last->value = compute_next(last->value);
+  return last->value;
+}
+
 // This is guaranteed to return a monotonic timestamp. If clock skew is detected
 // then this method will increment the last timestamp.
 int64_t MonotonicTimestampGenerator::compute_next(int64_t last) {
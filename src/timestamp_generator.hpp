@@ -23,6 +23,7 @@
 #include "macros.hpp"
 #include "ref_counted.hpp"
 #include "request.hpp"
+#include "thread_local.hpp"
 
 #include <stdint.h>
 
@@ -70,9 +71,10 @@ public:
 
   virtual int64_t next();
 
-private:
+protected:
   int64_t compute_next(int64_t last);
 
+private:
   Atomic<int64_t> last_;
   Atomic<int64_t> last_warning_;
 
@@ -80,6 +82,27 @@ private:
   const int64_t warning_interval_ms_;
 };
 
+// Keeps the last timestamp per thread so threads don't contend on a single
+// atomic. Timestamps are only guaranteed to be monotonic within a thread.
+class ThreadLocalMonotonicTimestampGenerator : public MonotonicTimestampGenerator {
+public:
+  ThreadLocalMonotonicTimestampGenerator(int64_t warning_threshold_us = 1000000,
+                                         int64_t warning_interval_ms = 1000)
+      : MonotonicTimestampGenerator(warning_threshold_us, warning_interval_ms) {}
+
+  virtual int64_t next();
+
+private:
+  class Last : public Allocated {
+  public:
+    Last()
+        : value(0) {}
+    int64_t value;
+  };
+
+  ThreadLocal<Last> thread_last_;
+};
+
 }}} // namespace datastax::internal::core
 
 EXTERNAL_TYPE(datastax::internal::core::TimestampGenerator, CassTimestampGen)
@@ -0,0 +1,226 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "timing_wheel.hpp"
+
+#include "event_loop.hpp"
+
+using namespace datastax::internal::core;
+
+WheelTimer::WheelTimer()
+    : wheel_(NULL)
+    , slot_(NULL)
+    , level_(0)
+    , expires_(0) {}
+
+int WheelTimer::start(uv_loop_t* loop, uint64_t timeout, const Callback& callback) {
+  // The loop's user data is set to the owning event loop (if there is one).
+  EventLoop* event_loop = static_cast<EventLoop*>(loop->data);
+  TimingWheel* wheel = event_loop != NULL ? event_loop->timing_wheel() : NULL;
+
+  callback_ = callback;
+  if (wheel != NULL && wheel->is_open()) {
+    if (wheel_ != NULL) wheel_->remove(this);
+    timer_.stop();
+    wheel->add(this, timeout);
+    return 0;
+  }
+
+  if (wheel_ != NULL) wheel_->remove(this);
+  return timer_.start(loop, timeout, bind_callback(&WheelTimer::on_timeout, this));
+}
+
+void WheelTimer::stop() {
+  if (wheel_ != NULL) wheel_->remove(this);
+  timer_.stop();
+}
+
+void WheelTimer::on_timeout(Timer* timer) { callback_(this); }
+
+void WheelTimer::handle_timeout() { callback_(this); }
+
+TimingWheel::TimingWheel()
+    : state_(CLOSED)
+    , is_processing_(false)
+    , count_(0)
+    , current_tick_(0)
+    , scheduled_tick_(0) {
+  for (size_t i = 0; i < NUM_LEVELS; ++i) {
+    level_counts_[i] = 0;
+  }
+}
+
+int TimingWheel::init(uv_loop_t* loop) {
+  int rc = uv_timer_init(loop, &handle_);
+  if (rc != 0) return rc;
+  handle_.data = this;
+  state_ = OPEN;
+  return 0;
+}
+
+void TimingWheel::close_handles() {
+  if (state_ == OPEN) {
+    state_ = CLOSING;
+    maybe_close();
+  }
+}
+
+void TimingWheel::add(WheelTimer* timer, uint64_t timeout) {
+  uint64_t now = uv_now(handle_.loop);
+  if (count_ == 0) {
+    current_tick_ = now;
+  }
+
+  // The current tick has already been processed so the earliest a timer can
+  // expire is on the next tick.
+  timer->expires_ = now + timeout;
+  if (timer->expires_ <= current_tick_) {
+    timer->expires_ = current_tick_ + 1;
+  }
+  timer->wheel_ = this;
+  insert(timer);
+  count_++;
+
+  schedule();
+}
+
+void TimingWheel::remove(WheelTimer* timer) {
+  timer->slot_->remove(timer);
+  level_counts_[timer->level_]--;
+  count_--;
+  timer->slot_ = NULL;
+  timer->wheel_ = NULL;
+
+  if (count_ == 0 && !is_processing_) {
+    uv_timer_stop(&handle_);
+    scheduled_tick_ = 0;
+    maybe_close();
+  }
+}
+
+void TimingWheel::on_timeout(uv_timer_t* handle) {
+  TimingWheel* wheel = static_cast<TimingWheel*>(handle->data);
+  wheel->handle_timeout();
+}
+
+void TimingWheel::handle_timeout() {
+  uint64_t now = uv_now(handle_.loop);
+
+  scheduled_tick_ = 0;
+  is_processing_ = true;
+  while (count_ > 0) {
+    uint64_t tick = next_tick();
+    if (tick > now) break;
+
+    current_tick_ = tick;
+    if ((tick & SLOT_MASK) == 0) {
+      cascade(tick);
+    }
+
+    // Timers (re)started by callbacks always go into a later slot
+    Slot& slot = slots_[0][tick & SLOT_MASK];
+    WheelTimer* timer;
+    while ((timer = slot.pop_front()) != NULL) {
+      level_counts_[0]--;
+      count_--;
+      timer->slot_ = NULL;
+      timer->wheel_ = NULL;
+      timer->handle_timeout();
+    }
+  }
+  is_processing_ = false;
+
+  if (count_ > 0) {
+    // Nothing expires before the next tick so it's safe to skip ahead
+    if (current_tick_ < now) current_tick_ = now;
+    schedule();
+  } else {
+    maybe_close();
+  }
+}
+
+void TimingWheel::insert(WheelTimer* timer) {
+  uint64_t expires = timer->expires_;
+  uint64_t delta = expires - current_tick_;
+
+  size_t level = 0;
+  while (level < NUM_LEVELS - 1 &&
+         delta >= (static_cast<uint64_t>(1) << (SLOT_BITS * (level + 1)))) {
+    level++;
+  }
+
+  // Timers beyond the range of the top level are placed at its furthest slot
+  // and are re-inserted when that slot is cascaded.
+  uint64_t max_delta = (static_cast<uint64_t>(1) << (SLOT_BITS * NUM_LEVELS)) - 1;
+  if (delta > max_delta) {
+    expires = current_tick_ + max_delta;
+  }
+
+  Slot* slot = &slots_[level][(expires >> (SLOT_BITS * level)) & SLOT_MASK];
+  slot->add_to_back(timer);
+  level_counts_[level]++;
+  timer->slot_ = slot;
+  timer->level_ = level;
+}
+
+void TimingWheel::cascade(uint64_t tick) {
+  for (size_t level = 1; level < NUM_LEVELS; ++level) {
+    size_t index = (tick >> (SLOT_BITS * level)) & SLOT_MASK;
+    Slot& slot = slots_[level][index];
+    WheelTimer* timer;
+    while ((timer = slot.pop_front()) != NULL) {
+      level_counts_[level]--;
+      insert(timer);
+    }
+    // Only cascade the next level up if this level wrapped around
+    if (index != 0) break;
+  }
+}
+
+uint64_t TimingWheel::next_tick() {
+  for (size_t level = 0; level < NUM_LEVELS; ++level) {
+    if (level_counts_[level] == 0) continue;
+    // Lower levels are empty so the next thing to happen is either a timer
+    // expiring (level 0) or a slot in this level being cascaded.
+    size_t shift = SLOT_BITS * level;
+    size_t index = (current_tick_ >> shift) & SLOT_MASK;
+    uint64_t base = (current_tick_ >> (shift + SLOT_BITS)) << (shift + SLOT_BITS);
+    for (size_t i = index + 1; i < NUM_SLOTS; ++i) {
+      if (!slots_[level][i].is_empty()) return base + (static_cast<uint64_t>(i) << shift);
+    }
+    // The remaining timers are in the next rotation of this level
+    return base + (static_cast<uint64_t>(NUM_SLOTS) << shift);
+  }
+  return current_tick_;
+}
+
+void TimingWheel::schedule() {
+  if (is_processing_ || count_ == 0) return;
+
+  uint64_t tick = next_tick();
+  if (scheduled_tick_ != 0 && scheduled_tick_ <= tick) return;
+
+  uint64_t now = uv_now(handle_.loop);
+  uv_timer_start(&handle_, on_timeout, tick > now ? tick - now : 0, 0);
+  scheduled_tick_ = tick;
+}
+
+void TimingWheel::maybe_close() {
+  if (state_ == CLOSING && count_ == 0) {
+    uv_close(reinterpret_cast<uv_handle_t*>(&handle_), NULL);
+    state_ = CLOSED;
+  }
+}
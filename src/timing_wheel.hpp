@@ -0,0 +1,164 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_TIMING_WHEEL_HPP
+#define DATASTAX_INTERNAL_TIMING_WHEEL_HPP
+
+#include "callback.hpp"
+#include "list.hpp"
+#include "macros.hpp"
+#include "timer.hpp"
+
+#include <uv.h>
+
+namespace datastax { namespace internal { namespace core {
+
+class TimingWheel;
+
+/**
+ * A timer for high-churn timeouts (request timeouts, speculative executions,
+ * heartbeats). When started on an event loop owned by an `EventLoop` the timer
+ * is placed in that loop's `TimingWheel` which makes starting and stopping it
+ * O(1), otherwise it falls back to a regular `Timer`.
+ *
+ * It has the same semantics as `Timer`, including restarting the timer when
+ * `start()` is called while it's running, and it must only be used on the
+ * event loop's thread.
+ */
+class WheelTimer : public List<WheelTimer>::Node {
+public:
+  typedef internal::Callback<void, WheelTimer*> Callback;
+
+  WheelTimer();
+  ~WheelTimer() { stop(); }
+
+  /**
+   * Start (or restart) the timer.
+   *
+   * @param loop The event loop where the timer should run.
+   * @param timeout The timeout in milliseconds.
+   * @param callback The callback that handles the timeout.
+   * @return 0 for success, otherwise an error occurred.
+   */
+  int start(uv_loop_t* loop, uint64_t timeout, const Callback& callback);
+
+  /**
+   * Stop the timer.
+   */
+  void stop();
+
+  /**
+   * Gets the status of the timer.
+   *
+   * @return true if the timer is running.
+   */
+  bool is_running() const { return wheel_ != NULL || timer_.is_running(); }
+
+private:
+  friend class TimingWheel;
+
+  void on_timeout(Timer* timer);
+  void handle_timeout();
+
+private:
+  TimingWheel* wheel_;
+  List<WheelTimer>* slot_;
+  size_t level_;
+  uint64_t expires_;
+  Timer timer_;
+  Callback callback_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(WheelTimer);
+};
+
+/**
+ * A hierarchical timing wheel with millisecond ticks driven by a single
+ * `uv_timer_t`. Each level has 64 slots and covers 64 times the range of the
+ * level below it; timers are moved down a level (cascaded) when the level
+ * below wraps around. Timeouts beyond the range of the top level (~4.6 hours)
+ * are cascaded through the top level until they're within range.
+ *
+ * Adding and removing timers is O(1). The `uv_timer_t` is only restarted when
+ * a timer expires before the currently scheduled wakeup.
+ */
+class TimingWheel {
+public:
+  TimingWheel();
+
+  /**
+   * Initialize the wheel's timer handle.
+   *
+   * @param loop The event loop that drives the wheel.
+   * @return 0 for success, otherwise an error occurred.
+   */
+  int init(uv_loop_t* loop);
+
+  /**
+   * Close the wheel's timer handle. If timers are still pending the handle is
+   * closed once they've expired or been stopped. No new timers are added to
+   * the wheel after the handle is closed.
+   */
+  void close_handles();
+
+  /**
+   * Determines if timers can be added to the wheel.
+   *
+   * @return true if the handle is initialized and not closed.
+   */
+  bool is_open() const { return state_ == OPEN || state_ == CLOSING; }
+
+  /**
+   * The number of pending timers.
+   */
+  size_t size() const { return count_; }
+
+  void add(WheelTimer* timer, uint64_t timeout);
+  void remove(WheelTimer* timer);
+
+private:
+  enum { SLOT_BITS = 6, NUM_SLOTS = 1 << SLOT_BITS, SLOT_MASK = NUM_SLOTS - 1, NUM_LEVELS = 4 };
+
+  enum State { CLOSED, OPEN, CLOSING };
+
+  typedef List<WheelTimer> Slot;
+
+  static void on_timeout(uv_timer_t* handle);
+  void handle_timeout();
+
+  void insert(WheelTimer* timer);
+  void cascade(uint64_t tick);
+  uint64_t next_tick();
+  void schedule();
+  void maybe_close();
+
+private:
+  uv_timer_t handle_;
+  State state_;
+  bool is_processing_;
+  size_t count_;
+  size_t level_counts_[NUM_LEVELS];
+  uint64_t current_tick_;
+  uint64_t scheduled_tick_; // 0 means the handle isn't started
+  Slot slots_[NUM_LEVELS][NUM_SLOTS];
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TimingWheel);
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
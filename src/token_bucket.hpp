@@ -0,0 +1,95 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_TOKEN_BUCKET_HPP
+#define DATASTAX_INTERNAL_TOKEN_BUCKET_HPP
+
+#include "atomic.hpp"
+#include "constants.hpp"
+
+namespace datastax { namespace internal { namespace core {
+
+/**
+ * A lock-free token bucket that's filled by its owner, either by events (e.g.
+ * requests) or based on elapsed time. The capacity is passed to each
+ * operation so that the bucket doesn't need to store its settings; it starts
+ * full and is capped to the capacity on first use.
+ */
+class TokenBucket {
+public:
+  TokenBucket()
+      : units_(CASS_INT64_MAX) {}
+
+  /**
+   * Add units to the bucket.
+   *
+   * @param units The number of units to add.
+   * @param max_units The capacity of the bucket.
+   */
+  void deposit(int64_t units, int64_t max_units) {
+    int64_t current = units_.load(MEMORY_ORDER_RELAXED);
+    while (current < max_units) {
+      int64_t next = current + units;
+      if (next > max_units) next = max_units;
+      if (units_.compare_exchange_weak(current, next, MEMORY_ORDER_RELAXED)) break;
+    }
+    if (current > max_units) { // Uninitialized (full) or the capacity was lowered
+      units_.compare_exchange_strong(current, max_units, MEMORY_ORDER_RELAXED);
+    }
+  }
+
+  /**
+   * Take units from the bucket.
+   *
+   * @param units The number of units to take.
+   * @param max_units The capacity of the bucket.
+   * @return false if the bucket doesn't have enough units.
+   */
+  bool try_acquire(int64_t units, int64_t max_units) {
+    int64_t current = units_.load(MEMORY_ORDER_RELAXED);
+    while ((current > max_units ? max_units : current) >= units) {
+      int64_t next = (current > max_units ? max_units : current) - units;
+      if (units_.compare_exchange_weak(current, next, MEMORY_ORDER_RELAXED)) return true;
+    }
+    return false;
+  }
+
+  /**
+   * Take units from the bucket even if it doesn't have enough units. The
+   * bucket is in debt until enough units are added.
+   *
+   * @param units The number of units to take.
+   * @param max_units The capacity of the bucket.
+   */
+  void withdraw(int64_t units, int64_t max_units) {
+    int64_t current = units_.load(MEMORY_ORDER_RELAXED);
+    while (!units_.compare_exchange_weak(
+        current, (current > max_units ? max_units : current) - units, MEMORY_ORDER_RELAXED)) {
+    }
+  }
+
+  int64_t units(int64_t max_units) const {
+    int64_t current = units_.load(MEMORY_ORDER_RELAXED);
+    return current > max_units ? max_units : current;
+  }
+
+private:
+  Atomic<int64_t> units_;
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
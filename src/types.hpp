@@ -72,6 +72,22 @@ struct CassDuration {
   cass_int64_t nanos;
 };
 
+struct CassFloatVector {
+  CassFloatVector(const cass_float_t* data, size_t count)
+      : data(data)
+      , count(count) {}
+  const cass_float_t* data;
+  size_t count;
+};
+
+struct CassDoubleVector {
+  CassDoubleVector(const cass_double_t* data, size_t count)
+      : data(data)
+      , count(count) {}
+  const cass_double_t* data;
+  size_t count;
+};
+
 }}} // namespace datastax::internal::core
 
 #endif
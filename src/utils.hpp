@@ -34,6 +34,7 @@ namespace datastax { namespace internal {
 
 typedef Vector<String> ContactPointList;
 typedef Vector<String> DcList;
+typedef Vector<String> KeyspaceList;
 
 // copy_cast<> prevents incorrect code from being generated when two unrelated
 // types reference the same memory location and strict aliasing is enabled.
@@ -24,12 +24,14 @@
 #include "scoped_lock.hpp"
 #include "serialization.hpp"
 
+#include <algorithm>
 #include <ctype.h>
 #include <stdio.h>
 
 #define TIME_OFFSET_BETWEEN_UTC_AND_EPOCH 0x01B21DD213814000LL // Nanoseconds
 #define MIN_CLOCK_SEQ_AND_NODE 0x8080808080808080LL
 #define MAX_CLOCK_SEQ_AND_NODE 0x7f7f7f7f7f7f7f7fLL
+#define CLOCK_SEQ_MASK 0x0000000000003FFFLL
 
 using namespace datastax::internal;
 using namespace datastax::internal::core;
@@ -161,8 +163,9 @@ CassError cass_uuid_from_string_n(const char* str, size_t str_length, CassUuid*
 
 UuidGen::UuidGen()
     : clock_seq_and_node_(0)
-    , last_timestamp_(0LL)
-    , ng_(get_random_seed(MT19937_64::DEFAULT_SEED)) {
+    , ng_(get_random_seed(MT19937_64::DEFAULT_SEED))
+    , used_clock_seqs_((CLOCK_SEQ_MASK + 1) / 64)
+    , used_clock_seq_count_(0) {
   uv_mutex_init(&mutex_);
 
   Md5 md5;
@@ -222,8 +225,9 @@ UuidGen::UuidGen()
 
 UuidGen::UuidGen(uint64_t node)
     : clock_seq_and_node_(0)
-    , last_timestamp_(0LL)
-    , ng_(get_random_seed(MT19937_64::DEFAULT_SEED)) {
+    , ng_(get_random_seed(MT19937_64::DEFAULT_SEED))
+    , used_clock_seqs_((CLOCK_SEQ_MASK + 1) / 64)
+    , used_clock_seq_count_(0) {
   uv_mutex_init(&mutex_);
   set_clock_seq_and_node(node & 0x0000FFFFFFFFFFFFLL);
 }
@@ -231,8 +235,9 @@ UuidGen::UuidGen(uint64_t node)
 UuidGen::~UuidGen() { uv_mutex_destroy(&mutex_); }
 
 void UuidGen::generate_time(CassUuid* output) {
-  output->time_and_version = set_version(monotonic_timestamp(), 1);
-  output->clock_seq_and_node = clock_seq_and_node_;
+  ThreadState* state = thread_state();
+  output->time_and_version = set_version(state->monotonic_timestamp(), 1);
+  output->clock_seq_and_node = state->clock_seq_and_node;
 }
 
 void UuidGen::from_time(uint64_t timestamp, CassUuid* output) {
@@ -241,41 +246,72 @@ void UuidGen::from_time(uint64_t timestamp, CassUuid* output) {
 }
 
 void UuidGen::generate_random(CassUuid* output) {
-  ScopedMutex lock(&mutex_);
-  uint64_t time_and_version = ng_();
-  uint64_t clock_seq_and_node = ng_();
-  lock.unlock();
+  MT19937_64& ng = thread_state()->ng;
+  uint64_t time_and_version = ng();
+  uint64_t clock_seq_and_node = ng();
 
   output->time_and_version = set_version(time_and_version, 4);
   output->clock_seq_and_node =
       (clock_seq_and_node & 0x3FFFFFFFFFFFFFFFLL) | 0x8000000000000000LL; // RFC4122 variant
 }
 
+UuidGen::ThreadState* UuidGen::thread_state() {
+  ThreadState* state = thread_states_.get();
+  if (state == NULL) {
+    // Use high resolution time if we can't get a real random seed
+    state = new ThreadState(get_random_seed(uv_hrtime()));
+    state->clock_seq_and_node =
+        (clock_seq_and_node_ & ~(CLOCK_SEQ_MASK << 48)) | (next_clock_seq(state->ng) << 48);
+    thread_states_.set(state);
+  }
+  return state;
+}
+
+uint64_t UuidGen::next_clock_seq(MT19937_64& ng) {
+  ScopedMutex l(&mutex_);
+  if (used_clock_seq_count_ == CLOCK_SEQ_MASK + 1) {
+    // Every clock sequence has been handed out so start over. The threads
+    // that were assigned them might have exited a long time ago.
+    uint64_t shared_clock_seq = (clock_seq_and_node_ >> 48) & CLOCK_SEQ_MASK;
+    std::fill(used_clock_seqs_.begin(), used_clock_seqs_.end(), 0);
+    used_clock_seqs_[shared_clock_seq / 64] |= static_cast<uint64_t>(1) << (shared_clock_seq % 64);
+    used_clock_seq_count_ = 1;
+  }
+  while (true) {
+    uint64_t clock_seq = ng() & CLOCK_SEQ_MASK;
+    uint64_t& word = used_clock_seqs_[clock_seq / 64];
+    uint64_t bit = static_cast<uint64_t>(1) << (clock_seq % 64);
+    if ((word & bit) == 0) {
+      word |= bit;
+      used_clock_seq_count_++;
+      return clock_seq;
+    }
+  }
+}
+
 void UuidGen::set_clock_seq_and_node(uint64_t node) {
-  uint64_t clock_seq = ng_();
-  clock_seq_and_node_ |= (clock_seq & 0x0000000000003FFFLL) << 48;
+  uint64_t clock_seq = ng_() & CLOCK_SEQ_MASK;
+  clock_seq_and_node_ |= clock_seq << 48;
   clock_seq_and_node_ |= 0x8000000000000000LL; // RFC4122 variant
   clock_seq_and_node_ |= node;
+
+  // The shared clock sequence is only used by from_time(); never give it to a thread
+  used_clock_seqs_[clock_seq / 64] |= static_cast<uint64_t>(1) << (clock_seq % 64);
+  used_clock_seq_count_++;
 }
 
-uint64_t UuidGen::monotonic_timestamp() {
+uint64_t UuidGen::ThreadState::monotonic_timestamp() {
   while (true) {
     uint64_t now = from_unix_timestamp(get_time_since_epoch_ms());
-    uint64_t last = last_timestamp_.load();
-    if (now > last) {
-      if (last_timestamp_.compare_exchange_strong(last, now)) {
-        return now;
-      }
-    } else {
-      uint64_t last_ms = to_milliseconds(last);
-      if (to_milliseconds(now) < last_ms) {
-        return last_timestamp_.fetch_add(1);
-      }
-      uint64_t candidate = last + 1;
-      if (to_milliseconds(candidate) == last_ms &&
-          last_timestamp_.compare_exchange_strong(last, candidate)) {
-        return candidate;
-      }
+    if (now > last_timestamp) {
+      last_timestamp = now;
+      return now;
+    }
+    // Use the sub-millisecond ticks of the last timestamp until the clock
+    // catches up. If the clock moved backwards there's no need to wait.
+    uint64_t last_ms = to_milliseconds(last_timestamp);
+    if (to_milliseconds(now) < last_ms || to_milliseconds(last_timestamp + 1) == last_ms) {
+      return ++last_timestamp;
     }
   }
 }
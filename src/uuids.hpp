@@ -22,6 +22,8 @@
 #include "cassandra.h"
 #include "external.hpp"
 #include "random.hpp"
+#include "thread_local.hpp"
+#include "vector.hpp"
 
 #include <assert.h>
 #include <string.h>
@@ -29,6 +31,10 @@
 
 namespace datastax { namespace internal { namespace core {
 
+// Time UUIDs are generated from per-thread state: each thread is assigned its
+// own random clock sequence so that threads can't produce the same UUID and
+// each only needs to keep its own timestamps monotonic. A sequence isn't
+// handed out again until all of them have been used.
 class UuidGen : public Allocated {
 public:
   UuidGen();
@@ -40,14 +46,31 @@ public:
   void generate_random(CassUuid* output);
 
 private:
+  class ThreadState : public Allocated {
+  public:
+    ThreadState(uint64_t seed)
+        : clock_seq_and_node(0)
+        , last_timestamp(0)
+        , ng(seed) {}
+
+    uint64_t monotonic_timestamp();
+
+    uint64_t clock_seq_and_node;
+    uint64_t last_timestamp;
+    MT19937_64 ng;
+  };
+
+  ThreadState* thread_state();
+  uint64_t next_clock_seq(MT19937_64& ng);
   void set_clock_seq_and_node(uint64_t node);
-  uint64_t monotonic_timestamp();
 
   uint64_t clock_seq_and_node_;
-  Atomic<uint64_t> last_timestamp_;
 
   uv_mutex_t mutex_;
   MT19937_64 ng_;
+  Vector<uint64_t> used_clock_seqs_; // Bitmap of the clock sequences handed out
+  size_t used_clock_seq_count_;
+  ThreadLocal<ThreadState> thread_states_;
 };
 
 }}} // namespace datastax::internal::core
@@ -36,6 +36,18 @@ using namespace datastax;
 using namespace datastax::internal;
 using namespace datastax::internal::core;
 
+static CassError check_vector(const CassValue* value, CassValueType element_value_type,
+                              size_t count) {
+  const DataType::ConstPtr& data_type(value->data_type());
+  if (!data_type || !data_type->is_vector()) return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+  const VectorType* vector_type = static_cast<const VectorType*>(data_type.get());
+  if (vector_type->element_type()->value_type() != element_value_type) {
+    return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+  }
+  if (vector_type->dimension() != count) return CASS_ERROR_LIB_INVALID_ITEM_COUNT;
+  return CASS_OK;
+}
+
 extern "C" {
 
 const CassDataType* cass_value_data_type(const CassValue* value) {
@@ -155,6 +167,22 @@ CassError cass_value_get_duration(const CassValue* value, cass_int32_t* months,
   CHECK_VALUE(value->decoder().as_duration(months, days, nanos));
 }
 
+CassError cass_value_get_float_vector(const CassValue* value, cass_float_t* output,
+                                      size_t output_count) {
+  if (value == NULL || value->is_null()) return CASS_ERROR_LIB_NULL_VALUE;
+  CassError rc = check_vector(value, CASS_VALUE_TYPE_FLOAT, output_count);
+  if (rc != CASS_OK) return rc;
+  CHECK_VALUE(value->decoder().as_float_array(output, output_count));
+}
+
+CassError cass_value_get_double_vector(const CassValue* value, cass_double_t* output,
+                                       size_t output_count) {
+  if (value == NULL || value->is_null()) return CASS_ERROR_LIB_NULL_VALUE;
+  CassError rc = check_vector(value, CASS_VALUE_TYPE_DOUBLE, output_count);
+  if (rc != CASS_OK) return rc;
+  CHECK_VALUE(value->decoder().as_double_array(output, output_count));
+}
+
 CassError cass_value_get_decimal(const CassValue* value, const cass_byte_t** varint,
                                  size_t* varint_size, cass_int32_t* scale) {
   if (value == NULL || value->is_null()) return CASS_ERROR_LIB_NULL_VALUE;
@@ -180,6 +208,12 @@ cass_bool_t cass_value_is_duration(const CassValue* value) {
   return static_cast<cass_bool_t>(is_valid(dummy, value->data_type()));
 }
 
+size_t cass_value_vector_dimension(const CassValue* value) {
+  const DataType::ConstPtr& data_type(value->data_type());
+  if (!data_type || !data_type->is_vector()) return 0;
+  return static_cast<const VectorType*>(data_type.get())->dimension();
+}
+
 size_t cass_value_item_count(const CassValue* collection) { return collection->count(); }
 
 CassValueType cass_value_primary_sub_type(const CassValue* collection) {
@@ -0,0 +1,253 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "warm_start.hpp"
+
+#include "logger.hpp"
+#include "serialization.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#define WARM_START_MAGIC "CWSS"
+#define WARM_START_MAGIC_SIZE 4
+
+using namespace datastax;
+using namespace datastax::internal;
+using namespace datastax::internal::core;
+
+namespace {
+
+void write_int32(int32_t value, String* output) {
+  char buf[sizeof(int32_t)];
+  encode_int32(buf, value);
+  output->append(buf, sizeof(int32_t));
+}
+
+void write_string(const String& value, String* output) {
+  write_int32(static_cast<int32_t>(value.size()), output);
+  output->append(value);
+}
+
+class Reader {
+public:
+  Reader(const char* data, size_t size)
+      : data_(data)
+      , remaining_(size) {}
+
+  bool read_int32(int32_t* value) {
+    if (remaining_ < sizeof(int32_t)) return false;
+    data_ = decode_int32(data_, *value);
+    remaining_ -= sizeof(int32_t);
+    return true;
+  }
+
+  bool read_string(String* value) {
+    int32_t size = 0;
+    if (!read_int32(&size) || size < 0 || static_cast<size_t>(size) > remaining_) return false;
+    value->assign(data_, size);
+    data_ += size;
+    remaining_ -= size;
+    return true;
+  }
+
+  bool is_empty() const { return remaining_ == 0; }
+
+private:
+  const char* data_;
+  size_t remaining_;
+};
+
+} // namespace
+
+void WarmStartSnapshot::add_host(const Host::Ptr& host) {
+  HostEntry entry;
+  entry.address = host->address();
+  entry.dc = host->dc();
+  entry.rack = host->rack();
+  entry.partitioner = host->partitioner();
+  entry.tokens = host->tokens();
+  hosts_.push_back(entry);
+}
+
+bool WarmStartSnapshot::add_prepared(const PreparedMetadata::Entry::Ptr& entry) {
+  const ResultResponse::ConstPtr& result(entry->result());
+  if (!result || result->encoded_prepared().empty() || result->has_tracing_id() ||
+      !result->warnings().empty() || !result->custom_payload().empty()) {
+    return false;
+  }
+  PreparedEntry prepared;
+  prepared.keyspace = entry->keyspace();
+  prepared.query = entry->query();
+  prepared.result = result->encoded_prepared().to_string();
+  prepared_.push_back(prepared);
+  return true;
+}
+
+bool WarmStartSnapshot::is_valid_for(const Host::Ptr& connected_host,
+                                     ProtocolVersion protocol_version,
+                                     const String& keyspace) const {
+  if (protocol_version_ != protocol_version || keyspace_ != keyspace) return false;
+  for (HostEntryVec::const_iterator it = hosts_.begin(), end = hosts_.end(); it != end; ++it) {
+    if (it->address == connected_host->address()) {
+      return it->partitioner == connected_host->partitioner() &&
+             it->tokens == connected_host->tokens();
+    }
+  }
+  return false;
+}
+
+ResultResponse::Ptr WarmStartSnapshot::decode_result(const PreparedEntry& entry) const {
+  ResultResponse::Ptr result(new ResultResponse());
+  result->set_buffer(entry.result.size());
+  memcpy(result->data(), entry.result.data(), entry.result.size());
+  Decoder decoder(result->data(), entry.result.size(), protocol_version_);
+  if (!result->decode(decoder) || result->kind() != CASS_RESULT_KIND_PREPARED) {
+    return ResultResponse::Ptr();
+  }
+  return result;
+}
+
+String WarmStartSnapshot::encode() const {
+  String output(WARM_START_MAGIC);
+  write_int32(FORMAT_VERSION, &output);
+  write_int32(protocol_version_.value(), &output);
+  write_string(keyspace_, &output);
+
+  write_int32(static_cast<int32_t>(hosts_.size()), &output);
+  for (HostEntryVec::const_iterator it = hosts_.begin(), end = hosts_.end(); it != end; ++it) {
+    write_string(it->address.hostname_or_address(), &output);
+    write_int32(it->address.port(), &output);
+    write_string(it->dc, &output);
+    write_string(it->rack, &output);
+    write_string(it->partitioner, &output);
+    write_int32(static_cast<int32_t>(it->tokens.size()), &output);
+    for (Vector<String>::const_iterator token_it = it->tokens.begin(),
+                                        tokens_end = it->tokens.end();
+         token_it != tokens_end; ++token_it) {
+      write_string(*token_it, &output);
+    }
+  }
+
+  write_int32(static_cast<int32_t>(prepared_.size()), &output);
+  for (PreparedEntryVec::const_iterator it = prepared_.begin(), end = prepared_.end(); it != end;
+       ++it) {
+    write_string(it->keyspace, &output);
+    write_string(it->query, &output);
+    write_string(it->result, &output);
+  }
+
+  return output;
+}
+
+bool WarmStartSnapshot::decode(const char* data, size_t size) {
+  if (size < WARM_START_MAGIC_SIZE || memcmp(data, WARM_START_MAGIC, WARM_START_MAGIC_SIZE) != 0) {
+    return false;
+  }
+
+  Reader reader(data + WARM_START_MAGIC_SIZE, size - WARM_START_MAGIC_SIZE);
+
+  int32_t version = 0;
+  if (!reader.read_int32(&version) || version != FORMAT_VERSION) return false;
+
+  int32_t protocol_version = 0;
+  if (!reader.read_int32(&protocol_version) || !reader.read_string(&keyspace_)) return false;
+  protocol_version_ = ProtocolVersion(protocol_version);
+
+  int32_t host_count = 0;
+  if (!reader.read_int32(&host_count) || host_count < 0) return false;
+  hosts_.clear();
+  for (int32_t i = 0; i < host_count; ++i) {
+    HostEntry entry;
+    String address;
+    int32_t port = 0;
+    int32_t token_count = 0;
+    if (!reader.read_string(&address) || !reader.read_int32(&port) ||
+        !reader.read_string(&entry.dc) || !reader.read_string(&entry.rack) ||
+        !reader.read_string(&entry.partitioner) || !reader.read_int32(&token_count) ||
+        token_count < 0) {
+      return false;
+    }
+    entry.address = Address(address, port);
+    for (int32_t j = 0; j < token_count; ++j) {
+      String token;
+      if (!reader.read_string(&token)) return false;
+      entry.tokens.push_back(token);
+    }
+    hosts_.push_back(entry);
+  }
+
+  int32_t prepared_count = 0;
+  if (!reader.read_int32(&prepared_count) || prepared_count < 0) return false;
+  prepared_.clear();
+  for (int32_t i = 0; i < prepared_count; ++i) {
+    PreparedEntry entry;
+    if (!reader.read_string(&entry.keyspace) || !reader.read_string(&entry.query) ||
+        !reader.read_string(&entry.result)) {
+      return false;
+    }
+    prepared_.push_back(entry);
+  }
+
+  return reader.is_empty();
+}
+
+bool WarmStartSnapshot::save(const String& path) const {
+  String temp_path(path + ".tmp");
+  FILE* file = fopen(temp_path.c_str(), "wb");
+  if (file == NULL) {
+    LOG_WARN("Unable to open prepared statement snapshot '%s' for writing", temp_path.c_str());
+    return false;
+  }
+
+  String data(encode());
+  bool is_written = fwrite(data.data(), 1, data.size(), file) == data.size();
+  is_written = fclose(file) == 0 && is_written;
+  if (!is_written || rename(temp_path.c_str(), path.c_str()) != 0) {
+    LOG_WARN("Unable to write prepared statement snapshot '%s'", path.c_str());
+    remove(temp_path.c_str());
+    return false;
+  }
+
+  LOG_DEBUG("Saved prepared statement snapshot '%s' with %u hosts and %u prepared statements",
+            path.c_str(), static_cast<unsigned>(hosts_.size()),
+            static_cast<unsigned>(prepared_.size()));
+  return true;
+}
+
+WarmStartSnapshot::Ptr WarmStartSnapshot::load(const String& path) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == NULL) {
+    LOG_DEBUG("No prepared statement snapshot found at '%s'", path.c_str());
+    return Ptr();
+  }
+
+  String data;
+  char buf[4096];
+  size_t size;
+  while ((size = fread(buf, 1, sizeof(buf), file)) > 0) {
+    data.append(buf, size);
+  }
+  bool is_read = ferror(file) == 0;
+  fclose(file);
+
+  Ptr snapshot(new WarmStartSnapshot());
+  if (!is_read || !snapshot->decode(data.data(), data.size())) {
+    LOG_WARN("Ignoring invalid prepared statement snapshot '%s'", path.c_str());
+    return Ptr();
+  }
+  return snapshot;
+}
@@ -0,0 +1,142 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#ifndef DATASTAX_INTERNAL_WARM_START_HPP
+#define DATASTAX_INTERNAL_WARM_START_HPP
+
+#include "address.hpp"
+#include "host.hpp"
+#include "prepared.hpp"
+#include "protocol.hpp"
+#include "ref_counted.hpp"
+#include "result_response.hpp"
+#include "string.hpp"
+#include "vector.hpp"
+
+namespace datastax { namespace internal { namespace core {
+
+/**
+ * A snapshot of a session's hosts, tokens and prepared statements that is
+ * saved to disk when the session is closed. The next session that uses the
+ * same file completes prepares using its prepared statements. The hosts and
+ * tokens are only used to validate that it's the same cluster.
+ *
+ * The snapshot is stored as a single flat buffer (all integers are big-endian
+ * and strings are prefixed by their 32-bit length):
+ *
+ *   "CWSS" [version] [protocol version] [keyspace]
+ *   [host count] ([address] [port] [dc] [rack] [partitioner] [token count] [token]...)...
+ *   [prepared count] ([keyspace] [query] [encoded prepared result])...
+ */
+class WarmStartSnapshot : public RefCounted<WarmStartSnapshot> {
+public:
+  typedef SharedRefPtr<WarmStartSnapshot> Ptr;
+
+  static const int32_t FORMAT_VERSION = 1;
+
+  struct HostEntry {
+    Address address;
+    String dc;
+    String rack;
+    String partitioner;
+    Vector<String> tokens;
+  };
+
+  typedef Vector<HostEntry> HostEntryVec;
+
+  struct PreparedEntry {
+    String keyspace;
+    String query;
+    String result; // The encoded PREPARED result body
+  };
+
+  typedef Vector<PreparedEntry> PreparedEntryVec;
+
+  WarmStartSnapshot() {}
+
+  WarmStartSnapshot(ProtocolVersion protocol_version, const String& keyspace)
+      : protocol_version_(protocol_version)
+      , keyspace_(keyspace) {}
+
+  ProtocolVersion protocol_version() const { return protocol_version_; }
+  const String& keyspace() const { return keyspace_; }
+  const HostEntryVec& hosts() const { return hosts_; }
+  const PreparedEntryVec& prepared() const { return prepared_; }
+
+  void add_host(const Host::Ptr& host);
+
+  /**
+   * Add a prepared metadata entry. Entries from responses that have a tracing
+   * ID, warnings or a custom payload are skipped because their encoded
+   * result isn't available.
+   *
+   * @return true if the entry was added.
+   */
+  bool add_prepared(const PreparedMetadata::Entry::Ptr& entry);
+
+  /**
+   * Determines if the snapshot can be used for a session that connected to
+   * a cluster. The protocol version and keyspace must match and the
+   * connected host must be in the snapshot with the same partitioner and
+   * tokens.
+   *
+   * @param connected_host The control connection's host.
+   * @param protocol_version The session's negotiated protocol version.
+   * @param keyspace The session's keyspace.
+   * @return true if the snapshot is valid for the session.
+   */
+  bool is_valid_for(const Host::Ptr& connected_host, ProtocolVersion protocol_version,
+                    const String& keyspace) const;
+
+  /**
+   * Decode a prepared entry's result.
+   *
+   * @return The prepared result or a null object pointer if the entry is
+   * invalid.
+   */
+  ResultResponse::Ptr decode_result(const PreparedEntry& entry) const;
+
+  String encode() const;
+  bool decode(const char* data, size_t size);
+
+  /**
+   * Save the snapshot. It's written to a temporary file first and then
+   * renamed so that a partially written snapshot is never loaded.
+   *
+   * @param path The snapshot's file path.
+   * @return true if the snapshot was saved.
+   */
+  bool save(const String& path) const;
+
+  /**
+   * Load a snapshot.
+   *
+   * @param path The snapshot's file path.
+   * @return The snapshot or a null object pointer if it doesn't exist or
+   * it's invalid.
+   */
+  static Ptr load(const String& path);
+
+private:
+  ProtocolVersion protocol_version_;
+  String keyspace_;
+  HostEntryVec hosts_;
+  PreparedEntryVec prepared_;
+};
+
+}}} // namespace datastax::internal::core
+
+#endif
@@ -32,6 +32,7 @@ public:
 
   virtual void SetUp() {
     Unit::SetUp();
+    loop_.data = NULL; // Not owned by an event loop
     uv_loop_init(loop());
   }
 
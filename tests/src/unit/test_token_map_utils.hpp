@@ -154,6 +154,15 @@ public:
     ++row_count_;
   }
 
+  void append_table_row_v3(const String& keyspace_name, const String& table_name,
+                           const String& comment) {
+    append_value<String>(keyspace_name);
+    append_value<String>(table_name);
+    append_value<String>(comment);
+
+    ++row_count_;
+  }
+
   void append_local_peers_row_v3(const TokenVec& tokens, const String& partitioner,
                                  const String& dc, const String& rack,
                                  const String& release_version) {
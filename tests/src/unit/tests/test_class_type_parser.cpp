@@ -44,6 +44,44 @@ TEST(ClassTypeParserUnitTest, Simple) {
   EXPECT_EQ(collection->types()[0]->value_type(), CASS_VALUE_TYPE_TEXT);
 }
 
+TEST(ClassTypeParserUnitTest, Vector) {
+  SimpleDataTypeCache cache;
+
+  DataType::ConstPtr data_type = DataTypeClassNameParser::parse_one(
+      "org.apache.cassandra.db.marshal.VectorType(org.apache.cassandra.db.marshal.DoubleType, 16)",
+      cache);
+  ASSERT_TRUE(data_type);
+  ASSERT_TRUE(data_type->is_vector());
+
+  VectorType::ConstPtr vector = static_cast<VectorType::ConstPtr>(data_type);
+  EXPECT_EQ(vector->element_type()->value_type(), CASS_VALUE_TYPE_DOUBLE);
+  EXPECT_EQ(vector->dimension(), 16u);
+  EXPECT_EQ(vector->to_string(), "vector<double, 16>");
+
+  EXPECT_TRUE(vector->equals(VectorType::ConstPtr(new VectorType(cache.by_cql("double"), 16))));
+  EXPECT_FALSE(vector->equals(VectorType::ConstPtr(new VectorType(cache.by_cql("double"), 8))));
+  EXPECT_FALSE(vector->equals(VectorType::ConstPtr(new VectorType(cache.by_cql("float"), 16))));
+}
+
+TEST(ClassTypeParserUnitTest, VectorOfNonSimpleType) {
+  SimpleDataTypeCache cache;
+
+  const datastax::String class_name("org.apache.cassandra.db.marshal.VectorType("
+                                    "org.apache.cassandra.db.marshal.FrozenType("
+                                    "org.apache.cassandra.db.marshal.ListType("
+                                    "org.apache.cassandra.db.marshal.Int32Type)), 3)");
+  DataType::ConstPtr data_type = DataTypeClassNameParser::parse_one(class_name, cache);
+  ASSERT_TRUE(data_type);
+  ASSERT_TRUE(data_type->is_vector());
+
+  VectorType::ConstPtr vector = static_cast<VectorType::ConstPtr>(data_type);
+  EXPECT_EQ(vector->element_type()->value_type(), CASS_VALUE_TYPE_LIST);
+
+  // The element type's parameters are part of the class name built from the element type
+  VectorType built(CollectionType::list(cache.by_cql("int"), true), 3);
+  EXPECT_EQ(class_name, built.class_name());
+}
+
 TEST(ClassTypeParserUnitTest, Invalid) {
   cass_log_set_level(CASS_LOG_DISABLED);
 
@@ -780,6 +780,56 @@ TEST_F(ClusterUnitTest, NoHostsAvailable) {
   EXPECT_EQ(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, connect_future->error()->code);
 }
 
+TEST_F(ClusterUnitTest, RaceContactPoints) {
+  mockssandra::SimpleCluster cluster(simple(), 3);
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  AddressVec contact_points;
+  contact_points.push_back(Address("127.99.99.1", 9042)); // Invalid
+  contact_points.push_back(Address("127.0.0.1", 9042));
+  contact_points.push_back(Address("127.0.0.2", 9042));
+
+  Future::Ptr connect_future(new Future());
+  ClusterConnector::Ptr connector(
+      new ClusterConnector(contact_points, PROTOCOL_VERSION,
+                           bind_callback(on_connection_reconnect, connect_future.get())));
+
+  // The delay is longer than the wait so connecting only succeeds if the
+  // failed attempt starts the next attempt right away.
+  ClusterSettings settings;
+  settings.control_connection_settings.connection_settings.connect_timeout_ms = 100;
+  settings.contact_point_connect_delay_ms = 60 * 1000;
+
+  connector->with_settings(settings)->connect(event_loop());
+
+  ASSERT_TRUE(connect_future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(connect_future->error());
+  EXPECT_EQ(Address("127.0.0.1", 9042), connect_future->cluster()->connected_host()->address());
+}
+
+TEST_F(ClusterUnitTest, RaceContactPointsNoHostsAvailable) {
+  // Don't start the cluster
+
+  AddressVec contact_points;
+  contact_points.push_back(Address("127.0.0.1", 9042));
+  contact_points.push_back(Address("127.0.0.2", 9042));
+  contact_points.push_back(Address("127.0.0.3", 9042));
+
+  Future::Ptr connect_future(new Future());
+  ClusterConnector::Ptr connector(
+      new ClusterConnector(contact_points, PROTOCOL_VERSION,
+                           bind_callback(on_connection_connected, connect_future.get())));
+
+  ClusterSettings settings;
+  settings.contact_point_connect_delay_ms = 10;
+
+  connector->with_settings(settings)->connect(event_loop());
+
+  ASSERT_TRUE(connect_future->wait_for(WAIT_FOR_TIME));
+  ASSERT_TRUE(connect_future->error());
+  EXPECT_EQ(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, connect_future->error()->code);
+}
+
 TEST_F(ClusterUnitTest, InvalidAuth) {
   mockssandra::SimpleCluster cluster(auth());
   ASSERT_EQ(cluster.start_all(), 0);
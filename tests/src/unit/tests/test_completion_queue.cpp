@@ -0,0 +1,140 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "completion_queue.hpp"
+#include "future.hpp"
+
+#include <uv.h>
+
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
+#define NUM_THREADS 4
+#define NUM_FUTURES_PER_THREAD 1000
+
+using datastax::internal::core::CompletionQueue;
+using datastax::internal::core::Future;
+
+struct SetFuturesThreadArgs {
+  uv_thread_t thread;
+  CompletionQueue::Ptr completion_queue;
+  size_t offset;
+};
+
+static void set_futures_thread(void* data) {
+  SetFuturesThreadArgs* args = static_cast<SetFuturesThreadArgs*>(data);
+  for (size_t i = 0; i < NUM_FUTURES_PER_THREAD; ++i) {
+    Future::Ptr future(new Future(Future::FUTURE_TYPE_GENERIC));
+    future->set_completion_queue(args->completion_queue,
+                                 reinterpret_cast<void*>(args->offset + i + 1));
+    future->set();
+  }
+}
+
+TEST(CompletionQueueUnitTest, Poll) {
+  CompletionQueue::Ptr completion_queue(new CompletionQueue());
+
+  CassFuture* futures[4];
+  void* tags[4];
+  EXPECT_EQ(0u, completion_queue->poll(futures, tags, 4));
+
+  for (size_t i = 0; i < 3; ++i) {
+    Future::Ptr future(new Future(Future::FUTURE_TYPE_GENERIC));
+    future->set_completion_queue(completion_queue, reinterpret_cast<void*>(i));
+    future->set();
+  }
+
+  EXPECT_EQ(2u, completion_queue->poll(futures, tags, 2));
+  EXPECT_EQ(reinterpret_cast<void*>(0), tags[0]);
+  EXPECT_EQ(reinterpret_cast<void*>(1), tags[1]);
+  cass_future_free(futures[0]);
+  cass_future_free(futures[1]);
+
+  // The remaining completion is still signaled
+  EXPECT_EQ(1u, completion_queue->poll(futures, tags, 4));
+  EXPECT_EQ(reinterpret_cast<void*>(2), tags[0]);
+  EXPECT_EQ(cass_true, cass_future_ready(futures[0]));
+  cass_future_free(futures[0]);
+
+  EXPECT_EQ(0u, completion_queue->poll(futures, tags, 4));
+}
+
+TEST(CompletionQueueUnitTest, WaitTimeout) {
+  CompletionQueue::Ptr completion_queue(new CompletionQueue());
+
+  CassFuture* futures[1];
+  uint64_t start = uv_hrtime();
+  EXPECT_EQ(0u, completion_queue->wait(futures, NULL, 1, 10000)); // 10 ms
+  EXPECT_GE(uv_hrtime() - start, 10000000u);
+}
+
+TEST(CompletionQueueUnitTest, MultipleProducers) {
+  CompletionQueue::Ptr completion_queue(new CompletionQueue());
+
+  SetFuturesThreadArgs args[NUM_THREADS];
+  for (size_t i = 0; i < NUM_THREADS; ++i) {
+    args[i].completion_queue = completion_queue;
+    args[i].offset = i * NUM_FUTURES_PER_THREAD;
+    uv_thread_create(&args[i].thread, set_futures_thread, &args[i]);
+  }
+
+  std::vector<bool> seen(NUM_THREADS * NUM_FUTURES_PER_THREAD + 1, false);
+  size_t total = 0;
+  while (total < NUM_THREADS * NUM_FUTURES_PER_THREAD) {
+    CassFuture* futures[64];
+    void* tags[64];
+    size_t count = completion_queue->wait(futures, tags, 64, 5000000); // 5 seconds
+    ASSERT_GT(count, 0u);
+    for (size_t i = 0; i < count; ++i) {
+      size_t tag = reinterpret_cast<size_t>(tags[i]);
+      EXPECT_FALSE(seen[tag]);
+      seen[tag] = true;
+      cass_future_free(futures[i]);
+    }
+    total += count;
+  }
+
+  for (size_t i = 0; i < NUM_THREADS; ++i) {
+    uv_thread_join(&args[i].thread);
+  }
+}
+
+#ifndef _WIN32
+TEST(CompletionQueueUnitTest, FileDescriptor) {
+  CompletionQueue::Ptr completion_queue(new CompletionQueue());
+  if (completion_queue->fd() == -1) {
+    return; // Not supported on this platform
+  }
+
+  struct pollfd pfd;
+  pfd.fd = completion_queue->fd();
+  pfd.events = POLLIN;
+  EXPECT_EQ(0, poll(&pfd, 1, 0));
+
+  Future::Ptr future(new Future(Future::FUTURE_TYPE_GENERIC));
+  future->set_completion_queue(completion_queue, NULL);
+  future->set();
+  EXPECT_EQ(1, poll(&pfd, 1, 0));
+
+  CassFuture* futures[1];
+  EXPECT_EQ(1u, completion_queue->poll(futures, NULL, 1));
+  cass_future_free(futures[0]);
+  EXPECT_EQ(0, poll(&pfd, 1, 0));
+}
+#endif
@@ -0,0 +1,149 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "concurrency_limiter.hpp"
+#include "host.hpp"
+
+using namespace datastax::internal::core;
+
+static const uint64_t NS_PER_MS = 1000LL * 1000LL;
+
+TEST(ConcurrencyLimiterUnitTest, IncreaseUnderLoad) {
+  ConcurrencyLimiterSettings settings;
+  settings.initial_limit = 10;
+  settings.max_limit = 12;
+  ConcurrencyLimiter limiter(settings, SaturatedHostTracker::Ptr());
+  EXPECT_EQ(10, limiter.limit());
+
+  // The limit isn't increased while less than half of it is used
+  for (int i = 0; i < 100; ++i) {
+    limiter.update(NS_PER_MS, 4, false);
+  }
+  EXPECT_EQ(10, limiter.limit());
+
+  // About one for every "limit" responses
+  for (int i = 0; i < 11; ++i) {
+    limiter.update(NS_PER_MS, 10, false);
+  }
+  EXPECT_EQ(11, limiter.limit());
+
+  // Capped by the maximum limit
+  for (int i = 0; i < 100; ++i) {
+    limiter.update(NS_PER_MS, 10, false);
+  }
+  EXPECT_EQ(12, limiter.limit());
+}
+
+TEST(ConcurrencyLimiterUnitTest, DecreaseOnCongestion) {
+  ConcurrencyLimiterSettings settings;
+  settings.initial_limit = 100;
+  settings.min_limit = 80;
+  settings.backoff_ratio = 0.9;
+  settings.latency_tolerance = 2.0;
+  ConcurrencyLimiter limiter(settings, SaturatedHostTracker::Ptr());
+
+  limiter.update(NS_PER_MS, 0, false); // Establish the minimum RTT
+  EXPECT_EQ(100, limiter.limit());
+
+  // Latency within the tolerance
+  limiter.update(2 * NS_PER_MS, 0, false);
+  EXPECT_EQ(100, limiter.limit());
+
+  // Latency over the tolerance
+  limiter.update(3 * NS_PER_MS, 0, false);
+  EXPECT_EQ(90, limiter.limit());
+
+  // Only a single decrease per round trip
+  limiter.update(3 * NS_PER_MS, 0, false);
+  limiter.update(3 * NS_PER_MS, 0, true);
+  EXPECT_EQ(90, limiter.limit());
+
+  // Dropped requests
+  limiter.update(0, 0, true);
+  EXPECT_EQ(81, limiter.limit());
+
+  // Capped by the minimum limit
+  limiter.update(0, 0, true);
+  EXPECT_EQ(80, limiter.limit());
+}
+
+TEST(ConcurrencyLimiterUnitTest, HostAtLimit) {
+  Host::Ptr host(new Host(Address("127.0.0.1", 9042)));
+  EXPECT_FALSE(host->is_at_concurrency_limit());
+  EXPECT_EQ(-1, host->concurrency_limit());
+
+  ConcurrencyLimiterSettings settings;
+  settings.initial_limit = 2;
+  SaturatedHostTracker::Ptr tracker(new SaturatedHostTracker());
+  host->enable_concurrency_limiter(settings, tracker);
+  EXPECT_EQ(2, host->concurrency_limit());
+
+  host->increment_inflight_requests();
+  EXPECT_FALSE(host->is_at_concurrency_limit());
+  EXPECT_EQ(0u, tracker->count());
+  host->increment_inflight_requests();
+  EXPECT_TRUE(host->is_at_concurrency_limit());
+  EXPECT_EQ(1u, tracker->count());
+  host->decrement_inflight_requests();
+  EXPECT_FALSE(host->is_at_concurrency_limit());
+  EXPECT_EQ(0u, tracker->count());
+}
+
+class UnsaturatedCounter : public SaturatedHostTracker::Listener {
+public:
+  UnsaturatedCounter()
+      : count(0) {}
+  virtual void on_host_unsaturated() { count++; }
+  int count;
+};
+
+TEST(ConcurrencyLimiterUnitTest, SaturatedHostTracker) {
+  SaturatedHostTracker::Ptr tracker(new SaturatedHostTracker());
+  UnsaturatedCounter listener;
+  tracker->add_listener(&listener);
+
+  ConcurrencyLimiterSettings settings;
+  settings.initial_limit = 1;
+  Host::Ptr host1(new Host(Address("127.0.0.1", 9042)));
+  Host::Ptr host2(new Host(Address("127.0.0.2", 9042)));
+  host1->enable_concurrency_limiter(settings, tracker);
+  host2->enable_concurrency_limiter(settings, tracker);
+
+  host1->increment_inflight_requests();
+  host2->increment_inflight_requests();
+  EXPECT_EQ(2u, tracker->count());
+  EXPECT_EQ(0, listener.count);
+
+  // Listeners are notified when a host drops below its limit
+  host1->decrement_inflight_requests();
+  EXPECT_EQ(1u, tracker->count());
+  EXPECT_EQ(1, listener.count);
+
+  // A larger limit also frees up capacity
+  for (int i = 0; i < 10; ++i) {
+    host2->update_concurrency_limit(NS_PER_MS, false);
+  }
+  EXPECT_EQ(2, host2->concurrency_limit());
+  EXPECT_EQ(0u, tracker->count());
+  EXPECT_EQ(2, listener.count);
+
+  tracker->remove_listener(&listener);
+  host2->increment_inflight_requests();
+  host2->decrement_inflight_requests();
+  EXPECT_EQ(2, listener.count);
+}
@@ -537,6 +537,21 @@ TEST_F(ControlConnectionUnitTest, SchemaChangeEvents) {
   EXPECT_EQ("aggregate1(varchar)", event12.target_name);
 }
 
+TEST_F(ControlConnectionUnitTest, SchemaKeyspaces) {
+  ControlConnectionSettings settings;
+  EXPECT_TRUE(settings.is_schema_keyspace("keyspace1"));
+  EXPECT_TRUE(settings.schema_keyspaces_where_clause().empty());
+
+  settings.schema_keyspaces.push_back("keyspace1");
+  settings.schema_keyspaces.push_back("it's");
+  EXPECT_TRUE(settings.is_schema_keyspace("keyspace1"));
+  EXPECT_TRUE(settings.is_schema_keyspace("it's"));
+  EXPECT_FALSE(settings.is_schema_keyspace("keyspace2"));
+  EXPECT_FALSE(settings.is_schema_keyspace("Keyspace1"));
+  EXPECT_EQ(" WHERE keyspace_name IN ('keyspace1','it''s')",
+            settings.schema_keyspaces_where_clause());
+}
+
 TEST_F(ControlConnectionUnitTest, EventDuringStartup) {
   Address address("127.0.0.1", PORT);
 
@@ -131,6 +131,28 @@ TEST(CqlTypeParserUnitTest, Tuple) {
   EXPECT_EQ(tuple->types()[2]->value_type(), CASS_VALUE_TYPE_TEXT);
 }
 
+TEST(CqlTypeParserUnitTest, Vector) {
+  DataType::ConstPtr data_type;
+
+  SimpleDataTypeCache cache;
+
+  KeyspaceMetadata keyspace("keyspace1");
+
+  data_type = DataTypeCqlNameParser::parse("vector<float, 3>", cache, &keyspace);
+  ASSERT_TRUE(data_type->is_vector());
+  EXPECT_EQ(data_type->value_type(), CASS_VALUE_TYPE_CUSTOM);
+  VectorType::ConstPtr vector = static_cast<VectorType::ConstPtr>(data_type);
+  EXPECT_EQ(vector->element_type()->value_type(), CASS_VALUE_TYPE_FLOAT);
+  EXPECT_EQ(vector->dimension(), 3u);
+  EXPECT_EQ(vector->class_name(),
+            "org.apache.cassandra.db.marshal.VectorType(org.apache.cassandra.db.marshal.FloatType, "
+            "3)");
+
+  EXPECT_FALSE(DataTypeCqlNameParser::parse("vector<float>", cache, &keyspace));
+  EXPECT_FALSE(DataTypeCqlNameParser::parse("vector<float, 0>", cache, &keyspace));
+  EXPECT_FALSE(DataTypeCqlNameParser::parse("vector<float, abc>", cache, &keyspace));
+}
+
 TEST(CqlTypeParserUnitTest, UserDefinedType) {
   DataType::ConstPtr data_type;
 
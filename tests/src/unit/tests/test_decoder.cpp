@@ -397,6 +397,48 @@ TEST_F(DecoderUnitTest, AsFloat) {
   ASSERT_TRUE(failure_logged_);
 }
 
+TEST_F(DecoderUnitTest, AsFloatArray) {
+  // 1.0f, -2.0f, 0.5f, 3.0f, 1.5f (big-endian)
+  const char input[20] = { 63, -128, 0, 0, -64, 0, 0, 0, 63, 0, 0, 0, 64, 64, 0, 0, 63, -64, 0, 0 };
+  TestDecoder decoder(input, 20);
+  float values[5] = { 0.0f };
+
+  // SUCCESS
+  ASSERT_TRUE(decoder.as_float_array(values, 5));
+  ASSERT_EQ(&input[0], decoder.buffer());
+  ASSERT_EQ(20ul, decoder.remaining());
+  EXPECT_EQ(1.0f, values[0]);
+  EXPECT_EQ(-2.0f, values[1]);
+  EXPECT_EQ(0.5f, values[2]);
+  EXPECT_EQ(3.0f, values[3]);
+  EXPECT_EQ(1.5f, values[4]);
+
+  // FAIL
+  float too_many[6];
+  ASSERT_FALSE(decoder.as_float_array(too_many, 6));
+  ASSERT_TRUE(failure_logged_);
+}
+
+TEST_F(DecoderUnitTest, AsDoubleArray) {
+  // 1.0, -2.0, 0.5 (big-endian)
+  const char input[24] = { 63, -16, 0, 0, 0, 0, 0, 0, -64, 0, 0, 0,
+                           0,  0,   0, 0, 63, -32, 0, 0, 0, 0, 0, 0 };
+  TestDecoder decoder(input, 24);
+  double values[3] = { 0.0 };
+
+  // SUCCESS
+  ASSERT_TRUE(decoder.as_double_array(values, 3));
+  ASSERT_EQ(24ul, decoder.remaining());
+  EXPECT_EQ(1.0, values[0]);
+  EXPECT_EQ(-2.0, values[1]);
+  EXPECT_EQ(0.5, values[2]);
+
+  // FAIL
+  double too_many[4];
+  ASSERT_FALSE(decoder.as_double_array(too_many, 4));
+  ASSERT_TRUE(failure_logged_);
+}
+
 TEST_F(DecoderUnitTest, DecodeDouble) {
   const char input[16] = { 0, 16, 0, 0, 0, 0, 0, 0, 127, -17, -1, -1, -1, -1, -1, -1 };
   TestDecoder decoder(input, 16);
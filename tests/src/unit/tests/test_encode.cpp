@@ -118,3 +118,36 @@ TEST(EncodeDurationUnitTest, EdgeNegative) {
     EXPECT_EQ(result_data[ind], 0xff);
   }
 }
+
+TEST(EncodeVectorUnitTest, Float) {
+  // Enough elements to exercise both the bulk and the trailing byte swaps
+  const float values[] = { 1.0f, -2.0f, 0.5f, 3.0f, 1.5f, -0.25f, 7.0f };
+  const size_t count = sizeof(values) / sizeof(values[0]);
+
+  Buffer result = encode_with_length(CassFloatVector(values, count));
+  ASSERT_EQ(sizeof(int32_t) + count * sizeof(float), result.size());
+
+  int32_t size = 0;
+  const char* pos = datastax::internal::decode_int32(result.data(), size);
+  EXPECT_EQ(static_cast<int32_t>(count * sizeof(float)), size);
+  for (size_t i = 0; i < count; ++i) {
+    float value = 0.0f;
+    pos = datastax::internal::decode_float(pos, value);
+    EXPECT_EQ(values[i], value);
+  }
+}
+
+TEST(EncodeVectorUnitTest, Double) {
+  const double values[] = { 1.0, -2.0, 0.5, 3.0, 1.5 };
+  const size_t count = sizeof(values) / sizeof(values[0]);
+
+  Buffer result = encode(CassDoubleVector(values, count));
+  ASSERT_EQ(count * sizeof(double), result.size());
+
+  const char* pos = result.data();
+  for (size_t i = 0; i < count; ++i) {
+    double value = 0.0;
+    pos = datastax::internal::decode_double(pos, value);
+    EXPECT_EQ(values[i], value);
+  }
+}
@@ -24,6 +24,8 @@
 #include "event_loop.hpp"
 #include "latency_aware_policy.hpp"
 #include "murmur3.hpp"
+#include "outlier_detection_policy.hpp"
+#include "peak_ewma_policy.hpp"
 #include "query_request.hpp"
 #include "random.hpp"
 #include "request_handler.hpp"
@@ -906,6 +908,135 @@ TEST(LatencyAwareLoadBalancingUnitTest, MovingAverage) {
               static_cast<double>(one_ms / 2LL), 2.0 * one_ms);
 }
 
+TEST(PeakEwmaLoadBalancingUnitTest, PeakAndDecay) {
+  const uint64_t one_ms = 1000000LL; // 1 ms in ns
+
+  Host host(Address("0.0.0.0", 9042));
+  host.update_peak_ewma(one_ms);
+  EXPECT_EQ(0, host.peak_ewma()); // Not enabled
+
+  host.enable_peak_ewma(10LL * one_ms);
+  host.update_peak_ewma(one_ms);
+  EXPECT_NEAR(static_cast<double>(host.peak_ewma()), static_cast<double>(one_ms), 0.1 * one_ms);
+
+  // A latency spike is used immediately
+  host.update_peak_ewma(100LL * one_ms);
+  EXPECT_NEAR(static_cast<double>(host.peak_ewma()), static_cast<double>(100LL * one_ms),
+              10.0 * one_ms);
+
+  // Lower latencies are averaged in after the spike and the value decays over time
+  test::Utils::msleep(50);
+  host.update_peak_ewma(one_ms);
+  EXPECT_LT(host.peak_ewma(), static_cast<int64_t>(10LL * one_ms));
+}
+
+TEST(PeakEwmaLoadBalancingUnitTest, FirstDecayIsUsed) {
+  const uint64_t one_ms = 1000000LL; // 1 ms in ns
+
+  Host host(Address("0.0.0.0", 9042));
+  EXPECT_EQ(10LL * one_ms, host.enable_peak_ewma(10LL * one_ms));
+  EXPECT_EQ(10LL * one_ms, host.enable_peak_ewma(10LL * one_ms));
+  EXPECT_EQ(10LL * one_ms, host.enable_peak_ewma(20LL * one_ms)); // Ignored
+
+  CassCluster* cluster = cass_cluster_new();
+  EXPECT_EQ(CASS_OK, cass_cluster_set_peak_ewma_routing_settings(
+                         cluster, PeakEwmaPolicy::MAX_DECAY_MS, 3));
+  EXPECT_EQ(CASS_ERROR_LIB_BAD_PARAMS, cass_cluster_set_peak_ewma_routing_settings(
+                                           cluster, PeakEwmaPolicy::MAX_DECAY_MS + 1, 3));
+  EXPECT_EQ(CASS_ERROR_LIB_BAD_PARAMS, cass_cluster_set_peak_ewma_routing_settings(cluster, 0, 3));
+  cass_cluster_free(cluster);
+}
+
+TEST(PeakEwmaLoadBalancingUnitTest, Simple) {
+  const uint64_t one_ms = 1000000LL; // 1 ms in ns
+
+  HostMap hosts;
+  populate_hosts(4, "rack1", LOCAL_DC, &hosts);
+  PeakEwmaPolicy::Settings settings;
+  settings.max_candidates = 3;
+  PeakEwmaPolicy policy(new RoundRobinPolicy(), settings);
+  policy.init(SharedRefPtr<Host>(), hosts, NULL, "");
+
+  Host::Ptr host1(hosts[addr_for_sequence(1)]);
+  Host::Ptr host2(hosts[addr_for_sequence(2)]);
+  Host::Ptr host3(hosts[addr_for_sequence(3)]);
+
+  // Unmeasured and idle hosts keep the child policy's order
+  {
+    ScopedPtr<QueryPlan> qp(policy.new_query_plan("", NULL, NULL));
+    const size_t seq[] = { 1, 2, 3, 4 };
+    verify_sequence(qp.get(), VECTOR_FROM(size_t, seq));
+  }
+
+  host1->update_peak_ewma(10LL * one_ms);
+  host2->update_peak_ewma(one_ms);
+  host3->update_peak_ewma(2LL * one_ms);
+
+  // Only the first 3 hosts of the child plan are ranked by latency
+  {
+    ScopedPtr<QueryPlan> qp(policy.new_query_plan("", NULL, NULL));
+    const size_t seq[] = { 4, 2, 3, 1 };
+    verify_sequence(qp.get(), VECTOR_FROM(size_t, seq));
+  }
+
+  // Outstanding requests make a fast host more expensive than a slower one
+  for (int i = 0; i < 10; ++i) {
+    host3->increment_inflight_requests();
+  }
+  {
+    ScopedPtr<QueryPlan> qp(policy.new_query_plan("", NULL, NULL));
+    const size_t seq[] = { 4, 1, 3, 2 };
+    verify_sequence(qp.get(), VECTOR_FROM(size_t, seq));
+  }
+}
+
+TEST(OutlierDetectionLoadBalancingUnitTest, Simple) {
+  const uint64_t one_ms = 1000000LL; // 1 ms in ns
+
+  OutlierDetectionPolicy::Settings settings;
+  settings.failure_rate_threshold = 0.5;
+  settings.min_requests = 20;
+  settings.interval_ns = 10LL * one_ms;
+  settings.base_ejection_ns = 50LL * one_ms;
+  settings.max_ejection_ns = 100LL * one_ms;
+
+  HostMap hosts;
+  populate_hosts(3, "rack1", LOCAL_DC, &hosts);
+  OutlierDetectionPolicy policy(new RoundRobinPolicy(), settings);
+  policy.init(SharedRefPtr<Host>(), hosts, NULL, "");
+
+  Host::Ptr host2(hosts[addr_for_sequence(2)]);
+  Host::Ptr host3(hosts[addr_for_sequence(3)]);
+
+  // Host 2 fails all of its requests and host 3 is under the threshold
+  for (int i = 0; i < 20; ++i) {
+    host2->record_request_result(true);
+    host3->record_request_result(i % 4 == 0);
+  }
+  test::Utils::msleep(20); // Complete the interval
+  host2->record_request_result(true);
+  host3->record_request_result(false);
+
+  EXPECT_TRUE(host2->is_ejected());
+  EXPECT_FALSE(host3->is_ejected());
+
+  // The ejected host is only used as a last resort
+  {
+    ScopedPtr<QueryPlan> qp(policy.new_query_plan("", NULL, NULL));
+    const size_t seq[] = { 1, 3, 2 };
+    verify_sequence(qp.get(), VECTOR_FROM(size_t, seq));
+  }
+
+  // The host is used normally after its ejection and recovery periods
+  test::Utils::msleep(150);
+  EXPECT_FALSE(host2->is_ejected());
+  {
+    ScopedPtr<QueryPlan> qp(policy.new_query_plan("", NULL, NULL));
+    const size_t seq[] = { 2, 3, 1 };
+    verify_sequence(qp.get(), VECTOR_FROM(size_t, seq));
+  }
+}
+
 #if _MSC_VER == 1700 && _M_IX86
 TEST(LatencyAwareLoadBalancingUnitTest,
      DISABLED_Simple) { // Disabled: See https://datastax-oss.atlassian.net/browse/CPP-654
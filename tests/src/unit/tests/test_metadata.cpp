@@ -16,7 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include "metadata.hpp"
 #include "result_metadata.hpp"
+#include "test_token_map_utils.hpp"
 
 using namespace datastax;
 using namespace datastax::internal;
@@ -81,3 +83,133 @@ TEST(ResultMetadataUnitTest, CaseSensitive) {
     EXPECT_EQ(count, 7u);
   }
 }
+
+class TestFieldsMetadata : public MetadataBase {
+public:
+  TestFieldsMetadata()
+      : MetadataBase("test") {}
+
+  void add(const String& name) { set_field(MetadataField(name)); }
+  size_t field_count() const { return fields_.size(); }
+};
+
+TEST(SchemaMetadataUnitTest, SortedFields) {
+  TestFieldsMetadata metadata;
+  const char* names[] = { "table_name", "comment", "keyspace_name", "caching", "comment", NULL };
+  for (size_t i = 0; names[i] != NULL; ++i) {
+    metadata.add(names[i]);
+  }
+  EXPECT_EQ(4u, metadata.field_count()); // Duplicates are replaced
+
+  for (size_t i = 0; names[i] != NULL; ++i) {
+    EXPECT_TRUE(metadata.get_field(names[i]) != NULL);
+  }
+  EXPECT_TRUE(metadata.get_field("bloom_filter_fp_chance") == NULL);
+  EXPECT_TRUE(metadata.get_field("zzz") == NULL);
+
+  ScopedPtr<Iterator> iterator(metadata.iterator_fields());
+  MetadataFieldIterator* fields = static_cast<MetadataFieldIterator*>(iterator.get());
+  String last;
+  while (fields->next()) {
+    EXPECT_LT(last, fields->field()->name());
+    last = fields->field()->name();
+  }
+}
+
+static ColumnMetadataVec keyspace_columns() {
+  DataType::ConstPtr varchar_data_type(new DataType(CASS_VALUE_TYPE_VARCHAR));
+  ColumnMetadataVec columns;
+  columns.push_back(::ColumnMetadata("keyspace_name", varchar_data_type));
+  columns.push_back(::ColumnMetadata(
+      "replication", CollectionType::map(varchar_data_type, varchar_data_type, true)));
+  return columns;
+}
+
+static ColumnMetadataVec table_columns() {
+  DataType::ConstPtr varchar_data_type(new DataType(CASS_VALUE_TYPE_VARCHAR));
+  ColumnMetadataVec columns;
+  columns.push_back(::ColumnMetadata("keyspace_name", varchar_data_type));
+  columns.push_back(::ColumnMetadata("table_name", varchar_data_type));
+  columns.push_back(::ColumnMetadata("comment", varchar_data_type));
+  return columns;
+}
+
+static void expect_change(const SchemaChange& change, SchemaChange::Type type,
+                          SchemaChange::Target target, const String& keyspace_name,
+                          const String& name) {
+  EXPECT_EQ(type, change.type);
+  EXPECT_EQ(target, change.target);
+  EXPECT_EQ(keyspace_name, change.keyspace_name);
+  EXPECT_EQ(name, change.name);
+}
+
+TEST(SchemaMetadataUnitTest, Diff) {
+  Metadata metadata;
+  SchemaChange::Vec changes;
+
+  ReplicationMap replication;
+  replication["class"] = CASS_SIMPLE_STRATEGY;
+  replication["replication_factor"] = "3";
+
+  RowResultResponseBuilder keyspaces1(keyspace_columns());
+  keyspaces1.append_keyspace_row_v3("keyspace1", replication);
+  keyspaces1.append_keyspace_row_v3("keyspace2", replication);
+
+  RowResultResponseBuilder tables1(table_columns());
+  tables1.append_table_row_v3("keyspace1", "table1", "a");
+  tables1.append_table_row_v3("keyspace1", "table2", "b");
+  tables1.append_table_row_v3("keyspace2", "table1", "c");
+
+  metadata.clear_and_update_back(VersionNumber(3, 0, 0));
+  metadata.update_keyspaces(keyspaces1.finish(), false);
+  metadata.update_tables(tables1.finish());
+  metadata.swap_to_back_and_update_front();
+
+  metadata.take_schema_changes(&changes);
+  ASSERT_EQ(2u, changes.size());
+  expect_change(changes[0], SchemaChange::CREATED, SchemaChange::KEYSPACE, "keyspace1", "");
+  expect_change(changes[1], SchemaChange::CREATED, SchemaChange::KEYSPACE, "keyspace2", "");
+
+  Metadata::SchemaSnapshot snapshot1(metadata.schema_snapshot());
+
+  // A full refresh with a single updated and a single created table
+  RowResultResponseBuilder keyspaces2(keyspace_columns());
+  keyspaces2.append_keyspace_row_v3("keyspace1", replication);
+  keyspaces2.append_keyspace_row_v3("keyspace2", replication);
+
+  RowResultResponseBuilder tables2(table_columns());
+  tables2.append_table_row_v3("keyspace1", "table1", "a");
+  tables2.append_table_row_v3("keyspace1", "table2", "updated");
+  tables2.append_table_row_v3("keyspace1", "table3", "d");
+  tables2.append_table_row_v3("keyspace2", "table1", "c");
+
+  metadata.clear_and_update_back(VersionNumber(3, 0, 0));
+  metadata.update_keyspaces(keyspaces2.finish(), false);
+  metadata.update_tables(tables2.finish());
+  metadata.swap_to_back_and_update_front();
+
+  metadata.take_schema_changes(&changes);
+  ASSERT_EQ(2u, changes.size());
+  expect_change(changes[0], SchemaChange::UPDATED, SchemaChange::TABLE, "keyspace1", "table2");
+  expect_change(changes[1], SchemaChange::CREATED, SchemaChange::TABLE, "keyspace1", "table3");
+
+  // Unchanged keyspaces and tables are shared with the previous snapshot
+  Metadata::SchemaSnapshot snapshot2(metadata.schema_snapshot());
+  EXPECT_EQ(snapshot1.get_keyspace("keyspace2"), snapshot2.get_keyspace("keyspace2"));
+  EXPECT_NE(snapshot1.get_keyspace("keyspace1"), snapshot2.get_keyspace("keyspace1"));
+  EXPECT_EQ(snapshot1.get_keyspace("keyspace1")->get_table("table1"),
+            snapshot2.get_keyspace("keyspace1")->get_table("table1"));
+  EXPECT_NE(snapshot1.get_keyspace("keyspace1")->get_table("table2"),
+            snapshot2.get_keyspace("keyspace1")->get_table("table2"));
+
+  // Incremental updates don't modify previous snapshots
+  metadata.drop_table_or_view("keyspace1", "table3");
+  metadata.take_schema_changes(&changes);
+  ASSERT_EQ(1u, changes.size());
+  expect_change(changes[0], SchemaChange::DROPPED, SchemaChange::TABLE, "keyspace1", "table3");
+
+  Metadata::SchemaSnapshot snapshot3(metadata.schema_snapshot());
+  EXPECT_TRUE(snapshot2.get_keyspace("keyspace1")->get_table("table3") != NULL);
+  EXPECT_TRUE(snapshot3.get_keyspace("keyspace1")->get_table("table3") == NULL);
+  EXPECT_EQ(snapshot2.get_keyspace("keyspace2"), snapshot3.get_keyspace("keyspace2"));
+}
@@ -15,20 +15,29 @@
 
 #include "execute_request.hpp"
 #include "md5.hpp"
+#include "prepare_host_handler.hpp"
 #include "prepared.hpp"
+#include "query_request.hpp"
 #include "session.hpp"
 #include "set.hpp"
 #include "uuids.hpp"
 
 using namespace mockssandra;
+using datastax::internal::OStringStream;
 using datastax::internal::ScopedMutex;
 using datastax::internal::Set;
+using datastax::internal::core::ClusterListener;
 using datastax::internal::core::Config;
+using datastax::internal::core::ConnectionSettings;
 using datastax::internal::core::ExecuteRequest;
 using datastax::internal::core::Future;
+using datastax::internal::core::PrepareHostHandler;
+using datastax::internal::core::PreparedMetadata;
 using datastax::internal::core::Prepared;
+using datastax::internal::core::QueryRequest;
 using datastax::internal::core::ResponseFuture;
 using datastax::internal::core::ResultResponse;
+using datastax::internal::core::SchemaChange;
 using datastax::internal::core::Session;
 
 #define PREPARED_QUERY "SELECT * FROM test"
@@ -43,16 +52,26 @@ public:
    */
   class PrepareStatements {
   public:
-    PrepareStatements() { uv_mutex_init(&mutex_); }
+    PrepareStatements()
+        : prepare_count_(0)
+        , execute_count_(0) {
+      uv_mutex_init(&mutex_);
+    }
     ~PrepareStatements() { uv_mutex_destroy(&mutex_); }
 
     String put_query(const Address& address, const String& query) {
       ScopedMutex l(&mutex_);
       String id = generate_id(query);
       statements_.insert(to_key(address, id));
+      prepare_count_++;
       return id;
     }
 
+    int prepare_count() const {
+      ScopedMutex l(&mutex_);
+      return prepare_count_;
+    }
+
     bool contains_id(const Address& address, const String& id) const {
       ScopedMutex l(&mutex_);
       return statements_.count(to_key(address, id)) > 0;
@@ -62,6 +81,16 @@ public:
       return contains_id(address, generate_id(query));
     }
 
+    void record_execute() {
+      ScopedMutex l(&mutex_);
+      execute_count_++;
+    }
+
+    int execute_count() const {
+      ScopedMutex l(&mutex_);
+      return execute_count_;
+    }
+
   private:
     String to_key(const Address& address, const String& id) const {
       return address.to_string() + "_" + id;
@@ -78,6 +107,8 @@ public:
   private:
     mutable uv_mutex_t mutex_;
     Set<String> statements_;
+    int prepare_count_;
+    int execute_count_;
   };
 
   /**
@@ -86,9 +117,11 @@ public:
    */
   class PrepareQuery : public Action {
   public:
-    PrepareQuery(PrepareStatements* statements, const String& keyspace = "")
+    PrepareQuery(PrepareStatements* statements, const String& keyspace = "",
+                 bool has_result_column = false)
         : statements_(statements)
-        , keyspace_(keyspace) {}
+        , keyspace_(keyspace)
+        , has_result_column_(has_result_column) {}
 
     void on_run(Request* request) const {
       String query;
@@ -112,9 +145,18 @@ public:
           encode_string("", &body); // Empty table doesn't matter for these tests
         }
         // Result metadata
-        encode_int32(0, &body); // Flags
-        encode_int32(0, &body); // Column count
-        encode_int32(0, &body); // Primary key count
+        if (has_result_column_) {
+          encode_int32(RESULT_FLAG_GLOBAL_TABLESPEC, &body); // Flags
+          encode_int32(1, &body);                            // Column count
+          encode_string("keyspace", &body);
+          encode_string("table", &body);
+          encode_string("value", &body);
+          body.push_back(0); // Type (int)
+          body.push_back(CASS_VALUE_TYPE_INT);
+        } else {
+          encode_int32(0, &body); // Flags
+          encode_int32(0, &body); // Column count
+        }
         request->write(OPCODE_RESULT, body);
       }
     }
@@ -122,6 +164,7 @@ public:
   private:
     PrepareStatements* statements_;
     const String keyspace_;
+    bool has_result_column_;
   };
 
   /**
@@ -149,6 +192,7 @@ public:
         encode_string(id, &body);                      // Prepared ID
         request->write(OPCODE_ERROR, body);
       } else {
+        statements_->record_execute();
         String body;
         encode_int32(RESULT_ROWS, &body); // Result kind
         encode_int32(0, &body);           // Flags
@@ -163,6 +207,28 @@ public:
     const String keyspace_;
   };
 
+  /**
+   * Action that handles PREPARE requests, but only on the first host. All later PREPARE requests
+   * fail so that re-preparing a statement on another host is retried on the next host.
+   */
+  class PrepareOnFirstHost : public PrepareQuery {
+  public:
+    PrepareOnFirstHost(PrepareStatements* statements)
+        : PrepareQuery(statements)
+        , statements_(statements) {}
+
+    void on_run(Request* request) const {
+      if (statements_->prepare_count() > 0) {
+        request->error(ERROR_SERVER_ERROR, "Unable to prepare");
+      } else {
+        PrepareQuery::on_run(request);
+      }
+    }
+
+  private:
+    PrepareStatements* statements_;
+  };
+
   static void connect(const Config& config, Session* session, const String& keyspace = "",
                       uint64_t wait_for_time_us = WAIT_FOR_TIME) {
     Future::Ptr connect_future(session->connect(config, keyspace));
@@ -180,6 +246,36 @@ public:
         << cass_error_desc(close_future->error()->code) << ": " << close_future->error()->message;
   }
 
+  struct HotStatementsState {
+    HotStatementsState(PrepareStatements* statements, const PreparedMetadata::Entry::Vec& entries,
+                       int num_hot_entries)
+        : statements(statements)
+        , entries(entries)
+        , num_hot_entries(num_hot_entries)
+        , is_called(false)
+        , is_hot_prepared(false) {}
+
+    PrepareStatements* statements;
+    PreparedMetadata::Entry::Vec entries;
+    int num_hot_entries;
+    bool is_called;
+    bool is_hot_prepared;
+  };
+
+  static void on_hot_statements_prepared(const PrepareHostHandler* handler,
+                                         HotStatementsState* state) {
+    EXPECT_FALSE(state->is_called);
+    state->is_called = true;
+    state->is_hot_prepared = true;
+    for (size_t i = state->entries.size() - state->num_hot_entries; i < state->entries.size();
+         ++i) {
+      if (!state->statements->contains_query(handler->host()->address(),
+                                             state->entries[i]->query())) {
+        state->is_hot_prepared = false;
+      }
+    }
+  }
+
   static Prepared::ConstPtr prepare(Session* session, const String& query) {
     ResponseFuture::Ptr future = session->prepare(query.c_str(), query.length());
 
@@ -187,7 +283,7 @@ public:
     EXPECT_FALSE(future->error()) << cass_error_desc(future->error()->code) << ": "
                                   << future->error()->message;
 
-    ResultResponse::Ptr result(future->response());
+    ResultResponse::ConstPtr result(future->response());
 
     if (!result || result->kind() != CASS_RESULT_KIND_PREPARED) {
       return Prepared::ConstPtr();
@@ -235,6 +331,44 @@ TEST_F(PreparedUnitTest, ReprepareOnUnpreparedNode) {
   close(&session);
 }
 
+/**
+ * Verify that a failed re-prepare doesn't release a host's in-flight request slot twice.
+ */
+TEST_F(PreparedUnitTest, FailedReprepareKeepsInflightCount) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareOnFirstHost(&statements));
+  builder.on(OPCODE_EXECUTE).execute(new ExecuteQuery(&statements));
+
+  mockssandra::SimpleCluster cluster(builder.build(), 2); // Requires at least 2 nodes
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.set_prepare_on_all_hosts(false); // Force re-prepare when executing on a new node
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+
+  Session session;
+  connect(config, &session);
+
+  Prepared::ConstPtr prepared = prepare(&session, PREPARED_QUERY);
+  ASSERT_TRUE(prepared);
+
+  for (int i = 0; i < 4; ++i) { // Round-robin executes on both nodes
+    Future::Ptr future =
+        session.execute(ExecuteRequest::ConstPtr(new ExecuteRequest(prepared.get())));
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute prepared query ";
+    EXPECT_FALSE(future->error()) << cass_error_desc(future->error()->code) << ": "
+                                  << future->error()->message;
+  }
+
+  EXPECT_EQ(1, statements.prepare_count());
+  EXPECT_EQ(0, session.cluster()->find_host(Address("127.0.0.1", 9042))->inflight_request_count());
+  EXPECT_EQ(0, session.cluster()->find_host(Address("127.0.0.2", 9042))->inflight_request_count());
+
+  close(&session);
+}
+
 /**
  * Verify that preparing a host on "UP" properly switches case-sensitive keyspaces before preparing
  * statements.
@@ -289,3 +423,545 @@ TEST_F(PreparedUnitTest, PreparedOnUpWithCaseSensitiveKeyspace) {
 
   close(&session);
 }
+
+/**
+ * Verify that identical concurrent reads are coalesced into a single request when singleflight
+ * reads are enabled.
+ */
+TEST_F(PreparedUnitTest, SingleflightReads) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements, "", true));
+  builder.on(OPCODE_EXECUTE).wait(200).execute(new ExecuteQuery(&statements));
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  config.default_profile().set_singleflight_reads(true);
+
+  Session session;
+  connect(config, &session);
+
+  Prepared::ConstPtr prepared = prepare(&session, PREPARED_QUERY);
+  ASSERT_TRUE(prepared);
+
+  ExecuteRequest* request = new ExecuteRequest(prepared.get());
+  ExecuteRequest::ConstPtr request_ptr(request);
+  request->set_is_idempotent(true);
+
+  Vector<Future::Ptr> futures;
+  for (int i = 0; i < 10; ++i) {
+    futures.push_back(session.execute(request_ptr));
+  }
+
+  for (Vector<Future::Ptr>::const_iterator it = futures.begin(); it != futures.end(); ++it) {
+    EXPECT_TRUE((*it)->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute prepared query ";
+    EXPECT_FALSE((*it)->error()) << cass_error_desc((*it)->error()->code) << ": "
+                                 << (*it)->error()->message;
+  }
+  EXPECT_EQ(1, statements.execute_count());
+
+  // Non-idempotent reads are never coalesced
+  request->set_is_idempotent(false);
+  Future::Ptr future1 = session.execute(request_ptr);
+  Future::Ptr future2 = session.execute(request_ptr);
+  EXPECT_TRUE(future1->wait_for(WAIT_FOR_TIME));
+  EXPECT_TRUE(future2->wait_for(WAIT_FOR_TIME));
+  EXPECT_EQ(3, statements.execute_count());
+
+  close(&session);
+}
+
+/**
+ * Verify that a coalesced read fails on its own request timeout instead of waiting for the request
+ * it was coalesced with.
+ */
+TEST_F(PreparedUnitTest, SingleflightFollowerTimeout) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements, "", true));
+  builder.on(OPCODE_EXECUTE).wait(500).execute(new ExecuteQuery(&statements));
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  config.default_profile().set_singleflight_reads(true);
+
+  Session session;
+  connect(config, &session);
+
+  Prepared::ConstPtr prepared = prepare(&session, PREPARED_QUERY);
+  ASSERT_TRUE(prepared);
+
+  ExecuteRequest* leader_request = new ExecuteRequest(prepared.get());
+  ExecuteRequest::ConstPtr leader_request_ptr(leader_request);
+  leader_request->set_is_idempotent(true);
+
+  ExecuteRequest* follower_request = new ExecuteRequest(prepared.get());
+  ExecuteRequest::ConstPtr follower_request_ptr(follower_request);
+  follower_request->set_is_idempotent(true);
+  follower_request->set_request_timeout_ms(50);
+
+  Future::Ptr leader_future = session.execute(leader_request_ptr);
+  Future::Ptr follower_future = session.execute(follower_request_ptr);
+
+  EXPECT_TRUE(follower_future->wait_for(WAIT_FOR_TIME));
+  ASSERT_TRUE(follower_future->error());
+  EXPECT_EQ(CASS_ERROR_LIB_REQUEST_TIMED_OUT, follower_future->error()->code);
+  EXPECT_FALSE(leader_future->ready()); // Still waiting for the server
+
+  EXPECT_TRUE(leader_future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(leader_future->error()) << cass_error_desc(leader_future->error()->code) << ": "
+                                       << leader_future->error()->message;
+  EXPECT_EQ(1, statements.execute_count());
+
+  close(&session);
+}
+
+/**
+ * Verify that a session saves a warm start snapshot when it's closed and that the next session
+ * uses it to complete prepares without waiting for the server. The snapshot's statements are keyed
+ * using the keyspace from the prepared metadata so the mock server returns a keyspace.
+ */
+TEST_F(PreparedUnitTest, WarmStartSnapshot) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).wait(200).execute(new PrepareQuery(&statements, "ks"));
+  builder.on(OPCODE_EXECUTE).execute(new ExecuteQuery(&statements, "ks"));
+  builder.on(OPCODE_QUERY).system_local().system_peers().use_keyspace("ks").empty_rows_result(1);
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  const String path("warm_start_unit_test.snapshot");
+  remove(path.c_str());
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  config.set_prepared_snapshot_path(path);
+
+  String prepared_id;
+  {
+    Session session;
+    connect(config, &session, "ks");
+    Prepared::ConstPtr prepared = prepare(&session, PREPARED_QUERY);
+    ASSERT_TRUE(prepared);
+    prepared_id = prepared->id();
+    close(&session);
+  }
+  EXPECT_EQ(1, statements.prepare_count());
+
+  {
+    Session session;
+    connect(config, &session, "ks");
+
+    // The prepares are completed using the snapshot and the statement is only prepared once in
+    // the background
+    ResponseFuture::Ptr future = session.prepare(PREPARED_QUERY, strlen(PREPARED_QUERY));
+    EXPECT_TRUE(future->ready());
+    ResponseFuture::Ptr other_future = session.prepare(PREPARED_QUERY, strlen(PREPARED_QUERY));
+    EXPECT_TRUE(other_future->ready());
+    Prepared::ConstPtr prepared = prepare(&session, PREPARED_QUERY);
+    ASSERT_TRUE(prepared);
+    EXPECT_EQ(prepared_id, prepared->id());
+
+    for (int i = 0; i < 100 && statements.prepare_count() < 2; ++i) {
+      test::Utils::msleep(10);
+    }
+    test::Utils::msleep(100); // Allow the background prepare to complete
+    EXPECT_EQ(2, statements.prepare_count());
+
+    // The live prepared metadata is used after the background prepare
+    prepared = prepare(&session, PREPARED_QUERY);
+    ASSERT_TRUE(prepared);
+    EXPECT_EQ(2, statements.prepare_count());
+
+    Future::Ptr execute_future =
+        session.execute(ExecuteRequest::ConstPtr(new ExecuteRequest(prepared.get())));
+    EXPECT_TRUE(execute_future->wait_for(WAIT_FOR_TIME));
+    EXPECT_FALSE(execute_future->error());
+
+    close(&session);
+  }
+
+  remove(path.c_str());
+}
+
+/**
+ * Verify that the most recently used statements are prepared first when preparing a host and that
+ * the callback is called as soon as those statements are prepared.
+ */
+TEST_F(PreparedUnitTest, PrepareHostHotStatementsFirst) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements));
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  const int num_entries = 100;
+  const int num_hot_entries = 10;
+
+  PreparedMetadata::Entry::Vec entries;
+  for (int i = 0; i < num_entries; ++i) {
+    OStringStream ss;
+    ss << PREPARED_QUERY << " WHERE id = " << i;
+    entries.push_back(PreparedMetadata::Entry::Ptr(
+        new PreparedMetadata::Entry(ss.str(), "", "", ResultResponse::ConstPtr())));
+  }
+
+  // Use the last statements most recently
+  test::Utils::msleep(200);
+  for (int i = num_entries - num_hot_entries; i < num_entries; ++i) {
+    entries[i]->mark_used();
+  }
+
+  HotStatementsState state(&statements, entries, num_hot_entries);
+  PrepareHostHandler::Ptr handler(new PrepareHostHandler(
+      datastax::internal::core::Host::Ptr(
+          new datastax::internal::core::Host(Address("127.0.0.1", 9042))),
+      entries,
+      bind_callback(on_hot_statements_prepared, &state), PROTOCOL_VERSION, 128, 2,
+      num_hot_entries));
+  handler->prepare(loop(), ConnectionSettings());
+  uv_run(loop(), UV_RUN_DEFAULT);
+
+  EXPECT_TRUE(state.is_called);
+  EXPECT_TRUE(state.is_hot_prepared);
+  for (int i = 0; i < num_entries; ++i) {
+    EXPECT_TRUE(statements.contains_query(Address("127.0.0.1", 9042), entries[i]->query()));
+  }
+}
+
+/**
+ * Verify that identical concurrent prepares are coalesced into a single PREPARE request and that
+ * preparing a query that's already prepared doesn't send a request.
+ */
+TEST_F(PreparedUnitTest, DeduplicatePrepares) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).wait(200).execute(new PrepareQuery(&statements, "ks"));
+  builder.on(OPCODE_QUERY).system_local().system_peers().use_keyspace("ks").empty_rows_result(1);
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+
+  Session session;
+  connect(config, &session, "ks");
+
+  Vector<ResponseFuture::Ptr> futures;
+  for (int i = 0; i < 10; ++i) {
+    futures.push_back(session.prepare(PREPARED_QUERY, strlen(PREPARED_QUERY)));
+  }
+
+  for (Vector<ResponseFuture::Ptr>::const_iterator it = futures.begin(); it != futures.end();
+       ++it) {
+    EXPECT_TRUE((*it)->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to prepare query";
+    EXPECT_FALSE((*it)->error()) << cass_error_desc((*it)->error()->code) << ": "
+                                 << (*it)->error()->message;
+    ResultResponse::ConstPtr result((*it)->response());
+    ASSERT_TRUE(result);
+    EXPECT_EQ(CASS_RESULT_KIND_PREPARED, result->kind());
+    EXPECT_EQ((*it)->prepare_request->query(), PREPARED_QUERY);
+  }
+  EXPECT_EQ(1, statements.prepare_count());
+
+  // The query is already prepared
+  Prepared::ConstPtr prepared = prepare(&session, PREPARED_QUERY);
+  ASSERT_TRUE(prepared);
+  EXPECT_EQ(1, statements.prepare_count());
+
+  prepared = prepare(&session, "SELECT * FROM other");
+  ASSERT_TRUE(prepared);
+  EXPECT_EQ(2, statements.prepare_count());
+
+  close(&session);
+}
+
+/**
+ * Verify that a prepared result isn't reused for keyspaces whose schema changes aren't tracked.
+ */
+TEST_F(PreparedUnitTest, PrepareUntrackedKeyspace) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements, "ks"));
+  builder.on(OPCODE_QUERY).system_local().system_peers().use_keyspace("ks").empty_rows_result(1);
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  for (int i = 0; i < 2; ++i) {
+    Config config;
+    config.contact_points().push_back(Address("127.0.0.1", 9042));
+    if (i == 0) {
+      config.set_use_schema(false);
+    } else {
+      config.schema_keyspaces().push_back("other");
+    }
+
+    Session session;
+    connect(config, &session, "ks");
+
+    int prepare_count = statements.prepare_count();
+    ASSERT_TRUE(prepare(&session, PREPARED_QUERY));
+    ASSERT_TRUE(prepare(&session, PREPARED_QUERY));
+    EXPECT_EQ(prepare_count + 2, statements.prepare_count());
+
+    close(&session);
+  }
+}
+
+/**
+ * Verify that concurrent prepares of the same query are only coalesced when they're sent using the
+ * same settings.
+ */
+TEST_F(PreparedUnitTest, DeduplicatePreparesWithSameSettings) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).wait(200).execute(new PrepareQuery(&statements, "ks"));
+  builder.on(OPCODE_QUERY).system_local().system_peers().use_keyspace("ks").empty_rows_result(1);
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+
+  Session session;
+  connect(config, &session, "ks");
+
+  QueryRequest::Ptr statement(new QueryRequest(PREPARED_QUERY));
+  statement->set_consistency(CASS_CONSISTENCY_LOCAL_QUORUM);
+
+  Vector<Future::Ptr> futures;
+  futures.push_back(session.prepare(PREPARED_QUERY, strlen(PREPARED_QUERY)));
+  futures.push_back(session.prepare(PREPARED_QUERY, strlen(PREPARED_QUERY)));
+  futures.push_back(session.prepare(statement.get()));
+  futures.push_back(session.prepare(statement.get()));
+
+  for (Vector<Future::Ptr>::const_iterator it = futures.begin(); it != futures.end(); ++it) {
+    EXPECT_TRUE((*it)->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to prepare query";
+    EXPECT_FALSE((*it)->error());
+  }
+  EXPECT_EQ(2, statements.prepare_count());
+
+  close(&session);
+}
+
+/**
+ * Verify that an entry from a ROWS result's metadata change doesn't replace the prepared entry
+ * used to look up a statement by its keyspace and query.
+ */
+TEST_F(PreparedUnitTest, PreparedMetadataKeepsPreparedEntry) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements));
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+
+  Session session;
+  connect(config, &session);
+  Prepared::ConstPtr prepared = prepare(&session, PREPARED_QUERY);
+  ASSERT_TRUE(prepared);
+  close(&session);
+
+  PreparedMetadata metadata;
+  metadata.set(prepared->id(), PreparedMetadata::Entry::Ptr(new PreparedMetadata::Entry(
+                                   PREPARED_QUERY, "ks", "", prepared->result())));
+  metadata.set(prepared->id(),
+               PreparedMetadata::Entry::Ptr(new PreparedMetadata::Entry(
+                   PREPARED_QUERY, "ks", "", ResultResponse::ConstPtr(new ResultResponse()))));
+
+  PreparedMetadata::Entry::Ptr entry(metadata.find("ks", PREPARED_QUERY));
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(prepared->result().get(), entry->result().get());
+  EXPECT_NE(prepared->result().get(), metadata.get(prepared->id())->result().get());
+}
+
+/**
+ * Verify that a session prepares a keyspace's statements again instead of reusing their results
+ * when a table of the keyspace changes.
+ */
+TEST_F(PreparedUnitTest, SchemaChangeInvalidatesPrepares) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements, "ks"));
+  builder.on(OPCODE_QUERY).system_local().system_peers().use_keyspace("ks").empty_rows_result(1);
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+
+  Session session;
+  connect(config, &session, "ks");
+
+  ASSERT_TRUE(prepare(&session, PREPARED_QUERY));
+  ASSERT_TRUE(prepare(&session, PREPARED_QUERY));
+  EXPECT_EQ(1, statements.prepare_count());
+
+  ClusterListener* listener = &session;
+  SchemaChange::Vec changes;
+  changes.push_back(SchemaChange(SchemaChange::CREATED, SchemaChange::TABLE, "ks", "other"));
+  changes.push_back(SchemaChange(SchemaChange::UPDATED, SchemaChange::TABLE, "other_ks", "table"));
+  listener->on_schema_changed(changes);
+  ASSERT_TRUE(prepare(&session, PREPARED_QUERY));
+  EXPECT_EQ(1, statements.prepare_count()); // Unrelated changes
+
+  changes.clear();
+  changes.push_back(SchemaChange(SchemaChange::UPDATED, SchemaChange::TABLE, "ks", "table"));
+  listener->on_schema_changed(changes);
+  ASSERT_TRUE(prepare(&session, PREPARED_QUERY));
+  EXPECT_EQ(2, statements.prepare_count());
+  ASSERT_TRUE(prepare(&session, PREPARED_QUERY));
+  EXPECT_EQ(2, statements.prepare_count());
+
+  close(&session);
+}
+
+/**
+ * Verify that a simple statement is prepared automatically once it has been executed often enough
+ * and that it's executed as a bound statement afterwards.
+ */
+TEST_F(PreparedUnitTest, AutoPrepare) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements));
+  builder.on(OPCODE_EXECUTE).execute(new ExecuteQuery(&statements));
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  config.set_auto_prepare(3, 16);
+
+  Session session;
+  connect(config, &session);
+
+  datastax::internal::core::Request::ConstPtr request(new QueryRequest(PREPARED_QUERY));
+  for (int i = 0; i < 3; ++i) {
+    Future::Ptr future = session.execute(request);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+    EXPECT_FALSE(future->error()) << cass_error_desc(future->error()->code) << ": "
+                                  << future->error()->message;
+  }
+
+  // The statement is prepared in the background after reaching the threshold
+  for (int i = 0; i < 20 && statements.execute_count() == 0; ++i) {
+    Future::Ptr future = session.execute(request);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+    test::Utils::msleep(50);
+  }
+  EXPECT_TRUE(statements.contains_query(Address("127.0.0.1", 9042), PREPARED_QUERY));
+  ASSERT_EQ(1, statements.execute_count());
+
+  for (int i = 0; i < 5; ++i) {
+    Future::Ptr future = session.execute(request);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+    EXPECT_FALSE(future->error()) << cass_error_desc(future->error()->code) << ": "
+                                  << future->error()->message;
+  }
+  EXPECT_EQ(6, statements.execute_count());
+
+  // Queries using named values are never prepared automatically
+  QueryRequest* named = new QueryRequest("SELECT * FROM test WHERE key = :key", 1);
+  datastax::internal::core::Request::ConstPtr named_request(named);
+  named->set("key", static_cast<cass_int32_t>(1));
+  for (int i = 0; i < 5; ++i) {
+    Future::Ptr future = session.execute(named_request);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+  }
+  EXPECT_FALSE(statements.contains_query(Address("127.0.0.1", 9042),
+                                         "SELECT * FROM test WHERE key = :key"));
+
+  close(&session);
+}
+
+/**
+ * Verify that executing an automatically prepared statement keeps it in the cache even though its
+ * position in the LRU list isn't updated.
+ */
+TEST_F(PreparedUnitTest, AutoPrepareKeepsRecentlyExecuted) {
+  PrepareStatements statements;
+
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(OPCODE_PREPARE).execute(new PrepareQuery(&statements));
+  builder.on(OPCODE_EXECUTE).execute(new ExecuteQuery(&statements));
+
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  config.set_auto_prepare(1, 2);
+
+  Session session;
+  connect(config, &session);
+
+  datastax::internal::core::Request::ConstPtr requests[] = {
+    datastax::internal::core::Request::ConstPtr(new QueryRequest("SELECT * FROM a")),
+    datastax::internal::core::Request::ConstPtr(new QueryRequest("SELECT * FROM b")),
+    datastax::internal::core::Request::ConstPtr(new QueryRequest("SELECT * FROM c"))
+  };
+
+  // Prepare "a" and "b" in the background
+  for (size_t i = 0; i < 2; ++i) {
+    Future::Ptr future = session.execute(requests[i]);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+    // Wait for the prepared statement to be added to the cache
+    for (int j = 0; j < 100 && session.auto_prepare_cache()->prepared_count() <= i; ++j) {
+      test::Utils::msleep(10);
+    }
+  }
+  ASSERT_EQ(2u, session.auto_prepare_cache()->prepared_count());
+  ASSERT_EQ(2, statements.prepare_count());
+
+  // "a" is executed as a bound statement so "b" is the least recently used
+  {
+    Future::Ptr future = session.execute(requests[0]);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+    EXPECT_EQ(1, statements.execute_count());
+  }
+
+  // Adding "c" evicts "b"
+  {
+    Future::Ptr future = session.execute(requests[2]);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+    for (int j = 0; j < 100 && statements.prepare_count() < 3; ++j) {
+      test::Utils::msleep(10);
+    }
+    EXPECT_EQ(3, statements.prepare_count());
+  }
+
+  {
+    Future::Ptr future = session.execute(requests[0]);
+    EXPECT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out waiting to execute query";
+    EXPECT_EQ(2, statements.execute_count());
+    EXPECT_EQ(3, statements.prepare_count());
+  }
+
+  close(&session);
+}
@@ -0,0 +1,63 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "priority_lane.hpp"
+
+using namespace datastax::internal::core;
+
+TEST(PriorityLaneUnitTest, WeightedSelection) {
+  PriorityLaneSettings settings;
+  settings.weights[CASS_REQUEST_PRIORITY_HIGH] = 4;
+  settings.weights[CASS_REQUEST_PRIORITY_NORMAL] = 2;
+  settings.weights[CASS_REQUEST_PRIORITY_LOW] = 1;
+  PriorityLaneSelector selector(settings);
+
+  bool is_ready[] = { true, true, true };
+  int counts[NUM_PRIORITY_LANES] = { 0 };
+  int last = -1;
+  for (int i = 0; i < 7 * 10; ++i) {
+    int lane = selector.select(is_ready);
+    ASSERT_GE(lane, 0);
+    if (lane == CASS_REQUEST_PRIORITY_LOW) {
+      EXPECT_NE(last, lane); // Selections are spread out
+    }
+    counts[lane]++;
+    last = lane;
+  }
+
+  EXPECT_EQ(40, counts[CASS_REQUEST_PRIORITY_HIGH]);
+  EXPECT_EQ(20, counts[CASS_REQUEST_PRIORITY_NORMAL]);
+  EXPECT_EQ(10, counts[CASS_REQUEST_PRIORITY_LOW]);
+}
+
+TEST(PriorityLaneUnitTest, SkipLanesNotReady) {
+  PriorityLaneSettings settings;
+  PriorityLaneSelector selector(settings);
+
+  bool is_ready[] = { false, false, true };
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(CASS_REQUEST_PRIORITY_LOW, selector.select(is_ready));
+  }
+
+  // A lane that becomes ready doesn't have to wait for the others to catch up
+  is_ready[CASS_REQUEST_PRIORITY_HIGH] = true;
+  EXPECT_EQ(CASS_REQUEST_PRIORITY_HIGH, selector.select(is_ready));
+
+  bool is_none_ready[] = { false, false, false };
+  EXPECT_EQ(-1, selector.select(is_none_ready));
+}
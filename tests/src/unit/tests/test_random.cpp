@@ -286,3 +286,22 @@ TEST(RandomUnitTest, MT19937_64) {
     EXPECT_EQ(v, random_numbers[i]);
   }
 }
+
+TEST(RandomUnitTest, ManyInstances) {
+  // More instances than a platform's per-process limit of thread-local keys
+  // (e.g. PTHREAD_KEYS_MAX) are alive at the same time.
+  Vector<Random*> randoms;
+  for (int i = 0; i < 4096; ++i) {
+    randoms.push_back(new Random());
+    EXPECT_LT(randoms.back()->next(10), 10u);
+  }
+  for (Vector<Random*>::iterator it = randoms.begin(), end = randoms.end(); it != end; ++it) {
+    delete *it;
+  }
+
+  // Reused storage doesn't hand back a destroyed instance's generator
+  for (int i = 0; i < 16; ++i) {
+    Random r;
+    EXPECT_LT(r.next(10), 10u);
+  }
+}
@@ -0,0 +1,97 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "rate_limiter.hpp"
+#include "test_utils.hpp"
+
+using namespace datastax::internal::core;
+
+TEST(RateLimiterUnitTest, Requests) {
+  RateLimitSettings settings;
+  settings.requests_per_second = 1000.0;
+  RateLimitBudget::Ptr budget(new RateLimitBudget(settings));
+  RateLimiter limiter1(budget);
+  RateLimiter limiter2(budget);
+
+  // The budget starts with one second worth of requests shared by the limiters
+  int admitted = 0;
+  while (limiter1.try_acquire() && admitted < 2000) {
+    admitted++;
+    if (limiter2.try_acquire()) admitted++;
+  }
+  EXPECT_GE(admitted, 1000);
+  EXPECT_LE(admitted, 1010); // A few requests might be refilled while running
+  EXPECT_FALSE(limiter2.try_acquire());
+
+  // Refilled over time
+  test::Utils::msleep(50);
+  admitted = 0;
+  while (limiter1.try_acquire() && admitted < 2000) {
+    admitted++;
+  }
+  EXPECT_GE(admitted, 40);
+  EXPECT_LE(admitted, 200);
+}
+
+TEST(RateLimiterUnitTest, LowRate) {
+  RateLimitSettings settings;
+  settings.requests_per_second = 10.0;
+  RateLimitBudget::Ptr budget(new RateLimitBudget(settings));
+  RateLimiter limiter(budget);
+
+  int admitted = 0;
+  while (limiter.try_acquire() && admitted < 100) {
+    admitted++;
+  }
+  EXPECT_EQ(10, admitted);
+
+  // Polling more often than a request is added must not lose the partial refills
+  admitted = 0;
+  uint64_t start = uv_hrtime();
+  while (uv_hrtime() - start < 450LL * 1000 * 1000) { // 450 ms
+    if (limiter.try_acquire()) admitted++;
+    test::Utils::msleep(1);
+  }
+  EXPECT_GE(admitted, 4);
+  EXPECT_LE(admitted, 5);
+}
+
+TEST(RateLimiterUnitTest, FractionalRate) {
+  RateLimitSettings settings;
+  settings.requests_per_second = 0.5;
+  RateLimitBudget::Ptr budget(new RateLimitBudget(settings));
+  RateLimiter limiter(budget);
+
+  // The budget holds at least one request
+  EXPECT_TRUE(limiter.try_acquire());
+  EXPECT_FALSE(limiter.try_acquire());
+}
+
+TEST(RateLimiterUnitTest, Bytes) {
+  RateLimitSettings settings;
+  settings.bytes_per_second = 1000;
+  RateLimitBudget::Ptr budget(new RateLimitBudget(settings));
+  RateLimiter limiter(budget);
+
+  EXPECT_TRUE(limiter.try_acquire());
+  limiter.record_bytes(2000); // Requests are admitted until the budget is in debt
+  EXPECT_FALSE(limiter.try_acquire());
+
+  test::Utils::msleep(1100);
+  EXPECT_TRUE(limiter.try_acquire());
+}
@@ -17,6 +17,7 @@
 #include "event_loop_test.hpp"
 
 #include "event_loop.hpp"
+#include "get_time.hpp"
 #include "query_request.hpp"
 #include "ref_counted.hpp"
 #include "request_handler.hpp"
@@ -692,6 +693,243 @@ TEST_F(RequestProcessorUnitTest, RequestTimeout) {
   ASSERT_TRUE(close_future->wait_for(WAIT_FOR_TIME));
 }
 
+TEST_F(RequestProcessorUnitTest, RequestDeadline) {
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(mockssandra::OPCODE_QUERY).wait(100); // Create a delay for all queries
+  mockssandra::SimpleCluster cluster(builder.build(), NUM_NODES);
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Future::Ptr close_future(new Future());
+  CloseListener::Ptr listener(new CloseListener(close_future));
+
+  HostMap hosts(generate_hosts());
+  Future::Ptr connect_future(new Future());
+  RequestProcessorInitializer::Ptr initializer(new RequestProcessorInitializer(
+      hosts.begin()->second, PROTOCOL_VERSION, hosts, TokenMap::Ptr(), "",
+      bind_callback(on_connected, connect_future.get())));
+
+  initializer->with_listener(listener.get())->initialize(event_loop());
+
+  ASSERT_TRUE(connect_future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(connect_future->error());
+  RequestProcessor::Ptr processor(connect_future->processor());
+
+  { // Deadline expires while waiting for a response
+    ResponseFuture::Ptr response_future(new ResponseFuture());
+    QueryRequest::Ptr query_request(new QueryRequest("SELECT * FROM table"));
+    query_request->set_deadline_ms(get_time_since_epoch_ms() + 50); // Smaller than delay
+    Request::ConstPtr request(query_request);
+    RequestHandler::Ptr request_handler(new RequestHandler(request, response_future));
+
+    processor->process_request(request_handler);
+    ASSERT_TRUE(response_future->wait_for(WAIT_FOR_TIME));
+    ASSERT_TRUE(response_future->error());
+    EXPECT_EQ(CASS_ERROR_LIB_REQUEST_DEADLINE_EXCEEDED, response_future->error()->code);
+  }
+
+  { // Deadline expired before the request is sent
+    ResponseFuture::Ptr response_future(new ResponseFuture());
+    QueryRequest::Ptr query_request(new QueryRequest("SELECT * FROM table"));
+    query_request->set_deadline_ms(get_time_since_epoch_ms() - 1);
+    query_request->set_record_attempted_addresses(true);
+    Request::ConstPtr request(query_request);
+    RequestHandler::Ptr request_handler(new RequestHandler(request, response_future));
+
+    processor->process_request(request_handler);
+    ASSERT_TRUE(response_future->wait_for(WAIT_FOR_TIME));
+    ASSERT_TRUE(response_future->error());
+    EXPECT_EQ(CASS_ERROR_LIB_REQUEST_DEADLINE_EXCEEDED, response_future->error()->code);
+    EXPECT_TRUE(response_future->attempted_addresses().empty());
+  }
+
+  processor->close();
+  ASSERT_TRUE(close_future->wait_for(WAIT_FOR_TIME));
+}
+
+TEST_F(RequestProcessorUnitTest, PriorityLanes) {
+  mockssandra::SimpleCluster cluster(simple(), NUM_NODES);
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Future::Ptr close_future(new Future());
+  CloseListener::Ptr listener(new CloseListener(close_future));
+
+  HostMap hosts(generate_hosts());
+  Future::Ptr connect_future(new Future());
+  RequestProcessorInitializer::Ptr initializer(new RequestProcessorInitializer(
+      hosts.begin()->second, PROTOCOL_VERSION, hosts, TokenMap::Ptr(), "",
+      bind_callback(on_connected, connect_future.get())));
+
+  RequestProcessorSettings settings;
+  settings.priority_lane_settings.enabled = true;
+  settings.priority_lane_settings.max_inflight_requests[CASS_REQUEST_PRIORITY_LOW] = 1;
+
+  initializer->with_settings(settings)->with_listener(listener.get())->initialize(event_loop());
+
+  ASSERT_TRUE(connect_future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(connect_future->error());
+  RequestProcessor::Ptr processor(connect_future->processor());
+
+  const CassRequestPriority priorities[] = { CASS_REQUEST_PRIORITY_LOW, CASS_REQUEST_PRIORITY_HIGH,
+                                             CASS_REQUEST_PRIORITY_UNKNOWN };
+  Vector<ResponseFuture::Ptr> response_futures;
+  for (int i = 0; i < 30; ++i) {
+    ResponseFuture::Ptr response_future(new ResponseFuture());
+    QueryRequest::Ptr query_request(new QueryRequest("SELECT * FROM table"));
+    query_request->set_priority(priorities[i % 3]);
+    Request::ConstPtr request(query_request);
+    processor->process_request(RequestHandler::Ptr(new RequestHandler(request, response_future)));
+    response_futures.push_back(response_future);
+  }
+
+  for (Vector<ResponseFuture::Ptr>::const_iterator it = response_futures.begin(),
+                                                   end = response_futures.end();
+       it != end; ++it) {
+    ASSERT_TRUE((*it)->wait_for(WAIT_FOR_TIME));
+    EXPECT_FALSE((*it)->error());
+  }
+
+  processor->close();
+  ASSERT_TRUE(close_future->wait_for(WAIT_FOR_TIME));
+}
+
+TEST_F(RequestProcessorUnitTest, RateLimit) {
+  mockssandra::SimpleCluster cluster(simple(), NUM_NODES);
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Future::Ptr close_future(new Future());
+  CloseListener::Ptr listener(new CloseListener(close_future));
+
+  HostMap hosts(generate_hosts());
+  Future::Ptr connect_future(new Future());
+  RequestProcessorInitializer::Ptr initializer(new RequestProcessorInitializer(
+      hosts.begin()->second, PROTOCOL_VERSION, hosts, TokenMap::Ptr(), "",
+      bind_callback(on_connected, connect_future.get())));
+
+  RequestProcessorSettings settings;
+  RateLimitSettings rate_limit_settings;
+  rate_limit_settings.requests_per_second = 1.0;
+  rate_limit_settings.queue_excess_requests = false;
+  settings.default_profile.set_rate_limit_settings(rate_limit_settings);
+  settings.default_profile.build_rate_limit_budget();
+
+  initializer->with_settings(settings)->with_listener(listener.get())->initialize(event_loop());
+
+  ASSERT_TRUE(connect_future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(connect_future->error());
+  RequestProcessor::Ptr processor(connect_future->processor());
+
+  Request::ConstPtr request(new QueryRequest("SELECT * FROM table"));
+  ResponseFuture::Ptr response_future1(new ResponseFuture());
+  ResponseFuture::Ptr response_future2(new ResponseFuture());
+  processor->process_request(RequestHandler::Ptr(new RequestHandler(request, response_future1)));
+  processor->process_request(RequestHandler::Ptr(new RequestHandler(request, response_future2)));
+
+  ASSERT_TRUE(response_future1->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(response_future1->error());
+  ASSERT_TRUE(response_future2->wait_for(WAIT_FOR_TIME));
+  ASSERT_TRUE(response_future2->error());
+  EXPECT_EQ(CASS_ERROR_LIB_RATE_LIMITED, response_future2->error()->code);
+
+  processor->close();
+  ASSERT_TRUE(close_future->wait_for(WAIT_FOR_TIME));
+}
+
+TEST_F(RequestProcessorUnitTest, RateLimitQueueExcessRequests) {
+  mockssandra::SimpleCluster cluster(simple(), NUM_NODES);
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Future::Ptr close_future(new Future());
+  CloseListener::Ptr listener(new CloseListener(close_future));
+
+  HostMap hosts(generate_hosts());
+  Future::Ptr connect_future(new Future());
+  RequestProcessorInitializer::Ptr initializer(new RequestProcessorInitializer(
+      hosts.begin()->second, PROTOCOL_VERSION, hosts, TokenMap::Ptr(), "",
+      bind_callback(on_connected, connect_future.get())));
+
+  RequestProcessorSettings settings;
+  RateLimitSettings rate_limit_settings;
+  rate_limit_settings.requests_per_second = 10.0;
+  settings.default_profile.set_rate_limit_settings(rate_limit_settings);
+  settings.default_profile.build_rate_limit_budget();
+
+  initializer->with_settings(settings)->with_listener(listener.get())->initialize(event_loop());
+
+  ASSERT_TRUE(connect_future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(connect_future->error());
+  RequestProcessor::Ptr processor(connect_future->processor());
+
+  // The first 10 requests use the initial budget and the rest are sent as it's refilled
+  uint64_t start = uv_hrtime();
+  Request::ConstPtr request(new QueryRequest("SELECT * FROM table"));
+  Vector<ResponseFuture::Ptr> response_futures;
+  for (int i = 0; i < 13; ++i) {
+    ResponseFuture::Ptr response_future(new ResponseFuture());
+    processor->process_request(RequestHandler::Ptr(new RequestHandler(request, response_future)));
+    response_futures.push_back(response_future);
+  }
+
+  for (Vector<ResponseFuture::Ptr>::const_iterator it = response_futures.begin(),
+                                                   end = response_futures.end();
+       it != end; ++it) {
+    ASSERT_TRUE((*it)->wait_for(WAIT_FOR_TIME));
+    EXPECT_FALSE((*it)->error());
+  }
+  EXPECT_GE(uv_hrtime() - start, 250LL * 1000 * 1000); // 250 ms
+
+  processor->close();
+  ASSERT_TRUE(close_future->wait_for(WAIT_FOR_TIME));
+}
+
+TEST_F(RequestProcessorUnitTest, ConcurrencyLimitQueueExcessRequests) {
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(mockssandra::OPCODE_QUERY).wait(50).empty_rows_result(1);
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Future::Ptr close_future(new Future());
+  CloseListener::Ptr listener(new CloseListener(close_future));
+
+  HostMap hosts(generate_hosts(1));
+  Future::Ptr connect_future(new Future());
+  RequestProcessorInitializer::Ptr initializer(new RequestProcessorInitializer(
+      hosts.begin()->second, PROTOCOL_VERSION, hosts, TokenMap::Ptr(), "",
+      bind_callback(on_connected, connect_future.get())));
+
+  RequestProcessorSettings settings;
+  settings.concurrency_limiter_settings.enabled = true;
+  settings.concurrency_limiter_settings.initial_limit = 1;
+  settings.concurrency_limiter_settings.max_limit = 1;
+
+  initializer->with_settings(settings)->with_listener(listener.get())->initialize(event_loop());
+
+  ASSERT_TRUE(connect_future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(connect_future->error());
+  RequestProcessor::Ptr processor(connect_future->processor());
+
+  // Requests wait in the queue while the host is at its limit and are
+  // processed as responses free up capacity.
+  Vector<ResponseFuture::Ptr> response_futures;
+  for (int i = 0; i < 5; ++i) {
+    ResponseFuture::Ptr response_future(new ResponseFuture());
+    Request::ConstPtr request(new QueryRequest("SELECT * FROM table"));
+    processor->process_request(RequestHandler::Ptr(new RequestHandler(request, response_future)));
+    response_futures.push_back(response_future);
+  }
+
+  for (Vector<ResponseFuture::Ptr>::const_iterator it = response_futures.begin(),
+                                                   end = response_futures.end();
+       it != end; ++it) {
+    ASSERT_TRUE((*it)->wait_for(WAIT_FOR_TIME));
+    EXPECT_FALSE((*it)->error()) << cass_error_desc((*it)->error()->code) << ": "
+                                 << (*it)->error()->message;
+  }
+  EXPECT_EQ(0u, settings.saturated_host_tracker->count());
+
+  processor->close();
+  ASSERT_TRUE(close_future->wait_for(WAIT_FOR_TIME));
+}
+
 TEST_F(RequestProcessorUnitTest, LowNumberOfStreams) {
   mockssandra::SimpleRequestHandlerBuilder builder;
   builder.on(mockssandra::OPCODE_QUERY)
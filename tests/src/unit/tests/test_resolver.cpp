@@ -171,3 +171,85 @@ TEST_F(ResolverUnitTest, MultiCancel) {
     EXPECT_TRUE((*it)->addresses().empty());
   }
 }
+
+TEST_F(ResolverUnitTest, Cached) {
+  ResolverCache::clear();
+
+  Resolver::Ptr resolver(create("localhost"));
+  resolver->set_cache_ttl_ms(60000);
+  resolver->resolve(loop(), RESOLVE_TIMEOUT);
+  run_loop();
+  ASSERT_EQ(Resolver::SUCCESS, status());
+  verify_addresses(addresses());
+
+  // The cached addresses are used without waiting on the uv_work thread pool
+  starve_thread_pool(200);
+
+  Resolver::Ptr cached_resolver(create("localhost"));
+  cached_resolver->set_cache_ttl_ms(60000);
+  cached_resolver->resolve(loop(), 1);
+  run_loop();
+  ASSERT_EQ(Resolver::SUCCESS, status());
+  verify_addresses(addresses());
+}
+
+TEST_F(ResolverUnitTest, CachedStaleRefreshed) {
+  ResolverCache::clear();
+
+  AddressVec stale_addresses;
+  stale_addresses.push_back(Address("127.0.0.2", 9042));
+  ResolverCache::put("localhost", 9042, stale_addresses);
+  test::Utils::msleep(10);
+
+  // The stale addresses are used while the hostname is resolved again
+  Resolver::Ptr resolver(create("localhost"));
+  resolver->set_cache_ttl_ms(1);
+  resolver->resolve(loop(), RESOLVE_TIMEOUT);
+  run_loop();
+  ASSERT_EQ(Resolver::SUCCESS, status());
+  ASSERT_EQ(1u, addresses().size());
+  EXPECT_EQ(Address("127.0.0.2", 9042), addresses()[0]);
+
+  AddressVec refreshed_addresses;
+  EXPECT_EQ(ResolverCache::HIT,
+            ResolverCache::get("localhost", 9042, 60000, &refreshed_addresses));
+  verify_addresses(refreshed_addresses);
+}
+
+TEST_F(ResolverUnitTest, CachedStaleRefreshFailed) {
+  ResolverCache::clear();
+
+  AddressVec stale_addresses;
+  stale_addresses.push_back(Address("127.0.0.2", 9042));
+  ResolverCache::put("doesnotexist.dne", 9042, stale_addresses);
+  test::Utils::msleep(10);
+
+  Resolver::Ptr resolver(create("doesnotexist.dne"));
+  resolver->set_cache_ttl_ms(1);
+  resolver->resolve(loop(), RESOLVE_TIMEOUT);
+  run_loop();
+  ASSERT_EQ(Resolver::SUCCESS, status());
+
+  // The stale entry is kept and can be refreshed again
+  AddressVec addresses;
+  EXPECT_EQ(ResolverCache::STALE, ResolverCache::get("doesnotexist.dne", 9042, 1, &addresses));
+  ASSERT_EQ(1u, addresses.size());
+  EXPECT_EQ(Address("127.0.0.2", 9042), addresses[0]);
+}
+
+TEST_F(ResolverUnitTest, CachedCancel) {
+  ResolverCache::clear();
+
+  AddressVec cached_addresses;
+  cached_addresses.push_back(Address("127.0.0.1", 9042));
+  ResolverCache::put("localhost", 9042, cached_addresses);
+
+  Resolver::Ptr resolver(create("localhost"));
+  resolver->set_cache_ttl_ms(60000);
+  resolver->resolve(loop(), RESOLVE_TIMEOUT);
+  resolver->cancel();
+  run_loop();
+  EXPECT_EQ(Resolver::CANCELED, status());
+  EXPECT_TRUE(addresses().empty());
+  ResolverCache::clear();
+}
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include "retry_budget.hpp"
 #include "retry_policy.hpp"
 
 using namespace datastax::internal;
@@ -173,3 +174,59 @@ TEST(RetryPoliciesUnitTest, Logging) {
   cass_log_set_level(CASS_LOG_INFO);
   check_default(logging_policy);
 }
+
+TEST(RetryPoliciesUnitTest, RetryBudget) {
+  RetryBudget::Settings settings;
+  settings.retry_ratio = 0.1;
+  settings.max_retries = 5;
+  RetryBudget budget(settings);
+
+  Host::Ptr host(new Host(Address("127.0.0.1", 9042)));
+
+  // The budget starts full
+  EXPECT_DOUBLE_EQ(5.0, budget.available_retries());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(budget.acquire(host.get()));
+  }
+  EXPECT_FALSE(budget.acquire(host.get()));
+  EXPECT_DOUBLE_EQ(0.0, budget.available_retries());
+
+  // A retry is allowed for every 10 requests
+  for (int i = 0; i < 9; ++i) {
+    budget.on_request();
+    budget.on_host_request(host.get());
+  }
+  EXPECT_FALSE(budget.acquire(host.get()));
+  budget.on_request();
+  budget.on_host_request(host.get());
+  EXPECT_TRUE(budget.acquire(host.get()));
+  EXPECT_FALSE(budget.acquire(host.get()));
+
+  // The budget never exceeds the maximum
+  for (int i = 0; i < 1000; ++i) {
+    budget.on_request();
+  }
+  EXPECT_DOUBLE_EQ(5.0, budget.available_retries());
+}
+
+TEST(RetryPoliciesUnitTest, RetryBudgetPerHost) {
+  RetryBudget::Settings settings;
+  settings.retry_ratio = 0.1;
+  settings.max_retries = 2;
+  RetryBudget budget(settings);
+
+  Host::Ptr host1(new Host(Address("127.0.0.1", 9042)));
+  Host::Ptr host2(new Host(Address("127.0.0.2", 9042)));
+
+  // Exhaust the first host's budget, the session's budget is still available
+  // for other hosts.
+  EXPECT_TRUE(budget.acquire(host1.get()));
+  for (int i = 0; i < 10; ++i) {
+    budget.on_request();
+  }
+  EXPECT_TRUE(budget.acquire(host1.get()));
+  EXPECT_FALSE(budget.acquire(host1.get()));
+  EXPECT_DOUBLE_EQ(1.0, budget.available_retries()); // Not charged for the failed retry
+  EXPECT_TRUE(budget.acquire(host2.get()));
+  EXPECT_FALSE(budget.acquire(host2.get()));
+}
@@ -281,6 +281,71 @@ TEST_F(SessionUnitTest, ExecuteQueryNotConnected) {
   ASSERT_EQ(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, future->error()->code);
 }
 
+TEST_F(SessionUnitTest, ExecuteQueryWithCompletionQueue) {
+  mockssandra::SimpleCluster cluster(simple());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Session session;
+  connect(&session);
+
+  CompletionQueue::Ptr completion_queue(new CompletionQueue());
+  const size_t num_requests = 100;
+  for (size_t i = 0; i < num_requests; ++i) {
+    Future::Ptr future = session.execute(Request::ConstPtr(new QueryRequest("blah", 0)),
+                                         completion_queue, reinterpret_cast<void*>(i));
+  }
+
+  size_t total = 0;
+  while (total < num_requests) {
+    CassFuture* futures[16];
+    void* tags[16];
+    size_t count = completion_queue->wait(futures, tags, 16, WAIT_FOR_TIME);
+    ASSERT_GT(count, 0u) << "Timed out waiting for completions";
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_LT(reinterpret_cast<size_t>(tags[i]), num_requests);
+      EXPECT_EQ(CASS_OK, cass_future_error_code(futures[i]));
+      cass_future_free(futures[i]);
+    }
+    total += count;
+  }
+
+  close(&session);
+}
+
+TEST_F(SessionUnitTest, ExecuteQueriesInBulk) {
+  mockssandra::SimpleCluster cluster(simple());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Session session;
+  { // Not connected
+    Request::ConstPtr requests[1] = { Request::ConstPtr(new QueryRequest("blah", 0)) };
+    Future::Ptr futures[1];
+    session.execute(requests, 1, futures);
+    ASSERT_TRUE(futures[0]->wait_for(WAIT_FOR_TIME));
+    EXPECT_EQ(CASS_ERROR_LIB_NO_HOSTS_AVAILABLE, futures[0]->error()->code);
+  }
+
+  Config config;
+  config.set_thread_count_io(3);
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  connect(config, &session);
+
+  const size_t num_requests = 100;
+  Request::ConstPtr requests[num_requests];
+  Future::Ptr futures[num_requests];
+  for (size_t i = 0; i < num_requests; ++i) {
+    requests[i] = Request::ConstPtr(new QueryRequest("blah", 0));
+  }
+  session.execute(requests, num_requests, futures);
+
+  for (size_t i = 0; i < num_requests; ++i) {
+    ASSERT_TRUE(futures[i]->wait_for(WAIT_FOR_TIME));
+    EXPECT_FALSE(futures[i]->error()) << "Request " << i << " failed";
+  }
+
+  close(&session);
+}
+
 TEST_F(SessionUnitTest, InvalidKeyspace) {
   mockssandra::SimpleRequestHandlerBuilder builder;
   builder.on(mockssandra::OPCODE_QUERY)
@@ -963,6 +1028,55 @@ TEST_F(SessionUnitTest, RemoteDCNodeRecovery) {
   close(&session);
 }
 
+TEST_F(SessionUnitTest, LocalHostsFirstConnect) {
+  // Delay connecting to the remote DC node
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(mockssandra::OPCODE_STARTUP)
+      .validate_startup()
+      .is_address("127.0.0.2")
+      .then(mockssandra::Action::Builder().wait(2000).ready())
+      .ready();
+  mockssandra::SimpleCluster cluster(builder.build(), 1, 1); // 1 local DC node and 1 remote DC node
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  config.set_load_balancing_policy(new DCAwarePolicy("dc1", 1));
+  config.set_local_hosts_first_connect(true);
+
+  Session session;
+  uint64_t start = uv_hrtime();
+  connect(config, &session);
+  EXPECT_LT(uv_hrtime() - start, 1000ull * 1000 * 1000) << "Waited for the remote DC node";
+
+  query(&session);
+
+  close(&session);
+}
+
+TEST_F(SessionUnitTest, LocalHostsFirstConnectFallbackToRemote) {
+  mockssandra::SimpleCluster cluster(simple(), 1, 1); // 1 local DC node and 1 remote DC node
+  ASSERT_EQ(cluster.start_all(), 0);
+  cluster.stop(1); // The local DC node is down
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.2", 9042));
+  config.set_load_balancing_policy(new DCAwarePolicy("dc1", 1));
+  config.set_local_hosts_first_connect(true);
+
+  Session session;
+  connect(config, &session);
+
+  QueryRequest::Ptr request(new QueryRequest("blah", 0));
+  request->set_consistency(CASS_CONSISTENCY_ONE); // Don't use a LOCAL consistency
+  ResponseFuture::Ptr future = session.execute(Request::ConstPtr(request));
+  ASSERT_TRUE(future->wait_for(WAIT_FOR_TIME));
+  EXPECT_FALSE(future->error()) << cass_error_desc(future->error()->code) << ": "
+                                << future->error()->message;
+
+  close(&session);
+}
+
 TEST_F(SessionUnitTest, DbaasDetectionUpdateDefaultConsistency) {
   mockssandra::SimpleRequestHandlerBuilder builder;
   builder.on(mockssandra::OPCODE_OPTIONS).execute(new SupportedDbaasOptions());
@@ -1011,3 +1125,35 @@ TEST_F(SessionUnitTest, DbaasDefaultConsistencyExecutionProfileNotUpdate) {
 
   close(&session);
 }
+
+TEST_F(SessionUnitTest, RetryBudgetExhausted) {
+  mockssandra::SimpleRequestHandlerBuilder builder;
+  builder.on(mockssandra::OPCODE_QUERY)
+      .system_local()
+      .system_peers()
+      .is_query("blah")
+      .then(mockssandra::Action::Builder().close())
+      .empty_rows_result(1);
+  mockssandra::SimpleCluster cluster(builder.build());
+  ASSERT_EQ(cluster.start_all(), 0);
+
+  RetryBudget::Settings settings;
+  settings.retry_ratio = 0.1;
+  settings.max_retries = 0; // Nothing saved up for a retry
+
+  Config config;
+  config.contact_points().push_back(Address("127.0.0.1", 9042));
+  config.set_retry_budget_settings(settings);
+  Session session;
+  connect(config, &session);
+
+  QueryRequest::Ptr request(new QueryRequest("blah", 0));
+  request->set_is_idempotent(true);
+
+  Future::Ptr future = session.execute(Request::ConstPtr(request));
+  ASSERT_TRUE(future->wait_for(WAIT_FOR_TIME)) << "Timed out executing query";
+  ASSERT_TRUE(future->error());
+  EXPECT_EQ(CASS_ERROR_LIB_RETRY_BUDGET_EXHAUSTED, future->error()->code);
+
+  close(&session);
+}
@@ -0,0 +1,77 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "speculative_execution.hpp"
+#include "test_utils.hpp"
+
+#define WINDOW_MS 50
+
+using namespace datastax::internal::core;
+
+static const uint64_t NS_PER_MS = 1000LL * 1000LL;
+
+TEST(SpeculativeExecutionUnitTest, PercentileDelay) {
+  PercentileTracker::Ptr tracker(new PercentileTracker(95.0, 1.0, WINDOW_MS * NS_PER_MS));
+  PercentileSpeculativeExecutionPlan plan(tracker, 1);
+
+  for (uint64_t i = 1; i <= 100; ++i) {
+    plan.record_latency(Host::Ptr(), i * NS_PER_MS);
+  }
+  EXPECT_EQ(-1, tracker->delay_ms()); // No data until the window is complete
+
+  test::Utils::msleep(WINDOW_MS + 10);
+  plan.record_latency(Host::Ptr(), NS_PER_MS); // Completes the window
+
+  EXPECT_GE(tracker->delay_ms(), 95);
+  EXPECT_LE(tracker->delay_ms(), 100);
+  EXPECT_EQ(tracker->delay_ms(), plan.next_execution(Host::Ptr()));
+  EXPECT_EQ(-1, plan.next_execution(Host::Ptr())); // Only a single speculative execution
+}
+
+TEST(SpeculativeExecutionUnitTest, PercentileNotEnoughSamples) {
+  PercentileTracker::Ptr tracker(new PercentileTracker(95.0, 1.0, WINDOW_MS * NS_PER_MS));
+  PercentileSpeculativeExecutionPlan plan(tracker, 1);
+
+  for (int64_t i = 1; i < PercentileTracker::MIN_SAMPLES - 1; ++i) {
+    plan.record_latency(Host::Ptr(), i * NS_PER_MS);
+  }
+  test::Utils::msleep(WINDOW_MS + 10);
+  plan.record_latency(Host::Ptr(), NS_PER_MS);
+
+  EXPECT_EQ(-1, tracker->delay_ms());
+  EXPECT_EQ(-1, plan.next_execution(Host::Ptr()));
+}
+
+TEST(SpeculativeExecutionUnitTest, PercentileMaxSpeculativeRatio) {
+  PercentileTracker::Ptr tracker(new PercentileTracker(95.0, 0.1));
+
+  // The budget starts full
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(tracker->acquire_execution());
+  }
+  EXPECT_FALSE(tracker->acquire_execution());
+
+  // A speculative execution is allowed for every 10 requests
+  for (int i = 0; i < 9; ++i) {
+    tracker->add_request();
+  }
+  EXPECT_FALSE(tracker->acquire_execution());
+  tracker->add_request();
+  EXPECT_TRUE(tracker->acquire_execution());
+  EXPECT_FALSE(tracker->acquire_execution());
+}
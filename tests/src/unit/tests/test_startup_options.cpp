@@ -75,7 +75,7 @@ public:
                                   << future->error()->message;
 
     Map<String, String> options;
-    ResultResponse::Ptr response = static_cast<ResultResponse::Ptr>(future->response());
+    ResultResponse::ConstPtr response(future->response());
     const Row row = response->first_row();
     for (size_t i = 0; i < row.values.size(); ++i) {
       String key = response->metadata()->get_column_definition(i).name.to_string();
@@ -43,11 +43,11 @@ public:
                                           << connect_future->error()->message;
   }
 
-  void get_rpc_address(const Response::Ptr& response, Address* output) {
+  void get_rpc_address(const Response::ConstPtr& response, Address* output) {
     ASSERT_TRUE(response);
     ASSERT_EQ(response->opcode(), CQL_OPCODE_RESULT);
 
-    ResultResponse::Ptr result(response);
+    ResultResponse::ConstPtr result(response);
 
     const Value* value = result->first_row().get_by_name("rpc_address");
     ASSERT_TRUE(value);
@@ -96,6 +96,37 @@ TEST_F(TimestampGenUnitTest, Monotonic) {
   }
 }
 
+struct ThreadLocalMonotonicThreadArgs {
+  uv_thread_t thread;
+  TimestampGenerator* gen;
+  int64_t timestamps[1000];
+};
+
+static void thread_local_monotonic_thread(void* data) {
+  ThreadLocalMonotonicThreadArgs* args = static_cast<ThreadLocalMonotonicThreadArgs*>(data);
+  for (int i = 0; i < 1000; ++i) {
+    args->timestamps[i] = args->gen->next();
+  }
+}
+
+TEST_F(TimestampGenUnitTest, ThreadLocalMonotonic) {
+  ThreadLocalMonotonicTimestampGenerator gen;
+
+  ThreadLocalMonotonicThreadArgs args[4];
+  for (int i = 0; i < 4; ++i) {
+    args[i].gen = &gen;
+    uv_thread_create(&args[i].thread, thread_local_monotonic_thread, &args[i]);
+  }
+
+  for (int i = 0; i < 4; ++i) {
+    uv_thread_join(&args[i].thread);
+    for (int j = 1; j < 1000; ++j) {
+      // Verify that timestamps are alway increasing within each thread
+      EXPECT_GT(args[i].timestamps[j], args[i].timestamps[j - 1]);
+    }
+  }
+}
+
 TEST_F(TimestampGenUnitTest, MonotonicExceedWarningThreshold) {
   // Set the threshold to something small that we're guaranteed to easily exceed.
   run_monotonic_timestamp_gen(1, 1000, 1000);
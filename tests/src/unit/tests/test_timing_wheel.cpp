@@ -0,0 +1,169 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include "loop_test.hpp"
+
+#include "event_loop.hpp"
+#include "timing_wheel.hpp"
+
+#define NUM_TIMERS 64
+
+using datastax::internal::bind_callback;
+using datastax::internal::core::EventLoop;
+using datastax::internal::core::TimingWheel;
+using datastax::internal::core::WheelTimer;
+
+class TimingWheelUnitTest : public Unit {
+public:
+  TimingWheelUnitTest()
+      : count_(0)
+      , last_timeout_(0) {}
+
+  virtual void SetUp() {
+    Unit::SetUp();
+    ASSERT_EQ(0, event_loop_.init());
+  }
+
+  virtual void TearDown() {
+    Unit::TearDown();
+    // Run the event loop on the test thread so that its handles are closed
+    event_loop_.close_handles();
+    uv_run(loop(), UV_RUN_DEFAULT);
+  }
+
+  uv_loop_t* loop() { return event_loop_.loop(); }
+  TimingWheel* timing_wheel() { return event_loop_.timing_wheel(); }
+
+  void run_until_count(int count) {
+    while (count_ < count) {
+      uv_run(loop(), UV_RUN_ONCE);
+    }
+  }
+
+  WheelTimer::Callback timer_callback() {
+    return bind_callback(&TimingWheelUnitTest::on_timer, this);
+  }
+
+  WheelTimer::Callback ordered_timer_callback() {
+    return bind_callback(&TimingWheelUnitTest::on_ordered_timer, this);
+  }
+
+  struct OrderedTimer {
+    WheelTimer timer;
+    uint64_t timeout;
+    uint64_t start;
+  };
+
+  void on_timer(WheelTimer* timer) {
+    EXPECT_FALSE(timer->is_running());
+    count_++;
+  }
+
+  void on_ordered_timer(WheelTimer* timer) {
+    OrderedTimer* ordered = reinterpret_cast<OrderedTimer*>(timer);
+    EXPECT_GE(uv_now(loop()) - ordered->start, ordered->timeout);
+    EXPECT_GE(ordered->timeout, last_timeout_);
+    last_timeout_ = ordered->timeout;
+    count_++;
+  }
+
+protected:
+  EventLoop event_loop_;
+  int count_;
+  uint64_t last_timeout_;
+};
+
+TEST_F(TimingWheelUnitTest, Once) {
+  WheelTimer timer;
+  timer.start(loop(), 0, timer_callback());
+  EXPECT_TRUE(timer.is_running());
+  EXPECT_EQ(1u, timing_wheel()->size());
+
+  run_until_count(1);
+  EXPECT_FALSE(timer.is_running());
+  EXPECT_EQ(0u, timing_wheel()->size());
+}
+
+TEST_F(TimingWheelUnitTest, Ordering) {
+  // The timeouts span multiple levels of the wheel and are started in reverse
+  // order.
+  const uint64_t timeouts[] = { 300, 200, 130, 65, 64, 63, 10, 1 };
+  const int num_timers = sizeof(timeouts) / sizeof(timeouts[0]);
+
+  OrderedTimer timers[num_timers];
+  for (int i = 0; i < num_timers; ++i) {
+    timers[i].timeout = timeouts[i];
+    timers[i].start = uv_now(loop());
+    timers[i].timer.start(loop(), timeouts[i], ordered_timer_callback());
+  }
+  EXPECT_EQ(static_cast<size_t>(num_timers), timing_wheel()->size());
+
+  run_until_count(num_timers);
+  EXPECT_EQ(0u, timing_wheel()->size());
+}
+
+TEST_F(TimingWheelUnitTest, StopAndRestart) {
+  WheelTimer timers[NUM_TIMERS];
+  for (int i = 0; i < NUM_TIMERS; ++i) {
+    timers[i].start(loop(), 1000 + i, timer_callback());
+  }
+  EXPECT_EQ(static_cast<size_t>(NUM_TIMERS), timing_wheel()->size());
+
+  // Stop half of the timers and restart the other half with a shorter timeout
+  for (int i = 0; i < NUM_TIMERS; ++i) {
+    if (i % 2 == 0) {
+      timers[i].stop();
+      EXPECT_FALSE(timers[i].is_running());
+    } else {
+      timers[i].start(loop(), 1, timer_callback());
+    }
+  }
+  EXPECT_EQ(static_cast<size_t>(NUM_TIMERS / 2), timing_wheel()->size());
+
+  uint64_t start = uv_now(loop());
+  run_until_count(NUM_TIMERS / 2);
+  EXPECT_LT(uv_now(loop()) - start, 1000u);
+  EXPECT_EQ(0u, timing_wheel()->size());
+}
+
+class WheelTimerFallbackUnitTest : public LoopTest {
+public:
+  WheelTimerFallbackUnitTest()
+      : count_(0) {}
+
+  WheelTimer::Callback timer_callback() {
+    return bind_callback(&WheelTimerFallbackUnitTest::on_timer, this);
+  }
+
+  void on_timer(WheelTimer* timer) {
+    EXPECT_FALSE(timer->is_running());
+    count_++;
+  }
+
+protected:
+  int count_;
+};
+
+TEST_F(WheelTimerFallbackUnitTest, Once) {
+  // The loop isn't owned by an event loop so a regular timer is used
+  WheelTimer timer;
+  timer.start(loop(), 1, timer_callback());
+  EXPECT_TRUE(timer.is_running());
+
+  uv_run(loop(), UV_RUN_DEFAULT);
+  EXPECT_FALSE(timer.is_running());
+  EXPECT_EQ(1, count_);
+}
@@ -22,7 +22,9 @@
 
 #include <algorithm>
 #include <ctype.h>
+#include <set>
 #include <string.h>
+#include <uv.h>
 
 using namespace datastax;
 using namespace datastax::internal;
@@ -32,6 +34,28 @@ inline bool operator!=(const CassUuid& u1, const CassUuid& u2) {
          u1.time_and_version != u2.time_and_version;
 }
 
+inline bool operator<(const CassUuid& u1, const CassUuid& u2) {
+  return u1.time_and_version < u2.time_and_version ||
+         (u1.time_and_version == u2.time_and_version &&
+          u1.clock_seq_and_node < u2.clock_seq_and_node);
+}
+
+#define NUM_THREADS 4
+#define NUM_UUIDS_PER_THREAD 10000
+
+struct GenerateTimeThreadArgs {
+  uv_thread_t thread;
+  CassUuidGen* uuid_gen;
+  CassUuid uuids[NUM_UUIDS_PER_THREAD];
+};
+
+void generate_time_thread(void* data) {
+  GenerateTimeThreadArgs* args = static_cast<GenerateTimeThreadArgs*>(data);
+  for (int i = 0; i < NUM_UUIDS_PER_THREAD; ++i) {
+    cass_uuid_gen_time(args->uuid_gen, &args->uuids[i]);
+  }
+}
+
 TEST(UuidUnitTest, V1) {
   CassUuidGen* uuid_gen = cass_uuid_gen_new();
 
@@ -63,6 +87,33 @@ TEST(UuidUnitTest, V1) {
   cass_uuid_gen_free(uuid_gen);
 }
 
+TEST(UuidUnitTest, V1MultipleThreads) {
+  CassUuidGen* uuid_gen = cass_uuid_gen_new();
+
+  ScopedArray<GenerateTimeThreadArgs> args(new GenerateTimeThreadArgs[NUM_THREADS]);
+  for (int i = 0; i < NUM_THREADS; ++i) {
+    args[i].uuid_gen = uuid_gen;
+    uv_thread_create(&args[i].thread, generate_time_thread, &args[i]);
+  }
+
+  std::set<CassUuid> uuids;
+  for (int i = 0; i < NUM_THREADS; ++i) {
+    uv_thread_join(&args[i].thread);
+    for (int j = 0; j < NUM_UUIDS_PER_THREAD; ++j) {
+      EXPECT_EQ(cass_uuid_version(args[i].uuids[j]), 1);
+      if (j > 0) { // Monotonic within a thread
+        EXPECT_GT(args[i].uuids[j].time_and_version, args[i].uuids[j - 1].time_and_version);
+      }
+      uuids.insert(args[i].uuids[j]);
+    }
+  }
+
+  // Unique across all threads
+  EXPECT_EQ(static_cast<size_t>(NUM_THREADS * NUM_UUIDS_PER_THREAD), uuids.size());
+
+  cass_uuid_gen_free(uuid_gen);
+}
+
 TEST(UuidUnitTest, V1MinMax) {
   cass_uint64_t founded_ts = 1270080000; // April 2010
   cass_uint64_t curr_ts = get_time_since_epoch_ms();
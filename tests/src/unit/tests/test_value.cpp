@@ -18,6 +18,7 @@
 
 #include "buffer.hpp"
 #include "cassandra.h"
+#include "collection.hpp"
 #include "string.hpp"
 #include "value.hpp"
 
@@ -188,3 +189,98 @@ TEST(ValueUnitTest, NullElementInCollectionSet) {
   EXPECT_EQ(cass_true, cass_value_is_null(element));
   cass_iterator_free(it);
 }
+
+TEST(ValueUnitTest, CollectionInt32Array) {
+  cass_int32_t values[10] = { 1, -2, 3, -4, 5, 0x7FFFFFFF, 7, -8, 9, 10 };
+  CollectionType::ConstPtr data_type =
+      CollectionType::list(DataType::ConstPtr(new DataType(CASS_VALUE_TYPE_INT)), false);
+  Collection collection(data_type, 11);
+  EXPECT_EQ(CASS_OK, collection.append(static_cast<cass_int32_t>(0)));
+  EXPECT_EQ(CASS_OK, cass_collection_append_int32_array(CassCollection::to(&collection), values,
+                                                        10));
+  EXPECT_EQ(CASS_OK, cass_collection_append_int32_array(CassCollection::to(&collection), NULL, 0));
+  cass_float_t floats[1] = { 1.0f };
+  EXPECT_EQ(CASS_ERROR_LIB_INVALID_VALUE_TYPE,
+            cass_collection_append_float_array(CassCollection::to(&collection), floats, 1));
+  EXPECT_EQ(11u, collection.item_count());
+
+  Buffer buf(collection.encode());
+  Decoder decoder(buf.data() + sizeof(int32_t), buf.size() - sizeof(int32_t));
+  Value value(data_type, 11, decoder);
+
+  CassIterator* it = cass_iterator_from_collection(CassValue::to(&value));
+  cass_int32_t element_value;
+  EXPECT_EQ(cass_true, cass_iterator_next(it));
+  EXPECT_EQ(CASS_OK, cass_value_get_int32(cass_iterator_get_value(it), &element_value));
+  EXPECT_EQ(0, element_value);
+
+  cass_int64_t int64_output[10];
+  EXPECT_EQ(CASS_ERROR_LIB_INVALID_VALUE_TYPE,
+            cass_iterator_next_int64_array(it, int64_output, 10, NULL));
+
+  cass_int32_t output[16];
+  size_t count_read = 0;
+  EXPECT_EQ(CASS_OK, cass_iterator_next_int32_array(it, output, 16, &count_read));
+  ASSERT_EQ(10u, count_read);
+  for (size_t i = 0; i < count_read; ++i) {
+    EXPECT_EQ(values[i], output[i]);
+  }
+  EXPECT_EQ(CASS_OK, cass_iterator_next_int32_array(it, output, 16, &count_read));
+  EXPECT_EQ(0u, count_read);
+  EXPECT_EQ(cass_false, cass_iterator_next(it));
+  cass_iterator_free(it);
+}
+
+TEST(ValueUnitTest, CollectionDoubleArray) {
+  cass_double_t values[3] = { 0.5, -1.25, 1e100 };
+  CollectionType::ConstPtr data_type =
+      CollectionType::set(DataType::ConstPtr(new DataType(CASS_VALUE_TYPE_DOUBLE)), false);
+  Collection collection(data_type, 3);
+  EXPECT_EQ(CASS_OK, cass_collection_append_double_array(CassCollection::to(&collection), values,
+                                                         3));
+
+  Buffer buf(collection.encode());
+  Decoder decoder(buf.data() + sizeof(int32_t), buf.size() - sizeof(int32_t));
+  Value value(data_type, 3, decoder);
+
+  CassIterator* it = cass_iterator_from_collection(CassValue::to(&value));
+  cass_double_t output[2];
+  size_t count_read = 0;
+  EXPECT_EQ(CASS_OK, cass_iterator_next_double_array(it, output, 2, &count_read));
+  ASSERT_EQ(2u, count_read);
+  EXPECT_EQ(values[0], output[0]);
+  EXPECT_EQ(values[1], output[1]);
+  EXPECT_EQ(cass_true, cass_iterator_next(it));
+  cass_double_t element_value;
+  EXPECT_EQ(CASS_OK, cass_value_get_double(cass_iterator_get_value(it), &element_value));
+  EXPECT_EQ(values[2], element_value);
+  EXPECT_EQ(cass_false, cass_iterator_next(it));
+  cass_iterator_free(it);
+}
+
+TEST(ValueUnitTest, CollectionArrayWithNullElement) {
+  const char input[44] = {
+    0,  0,  0,  4,  0, 0, 0, 1, // Size (int32_t) and contents of element 1
+    -1, -1, -1, -1,             // Element 2 is NULL
+    0,  0,  0,  4,  0, 0, 0, 3, // Size (int32_t) and contents of element 3
+    0,  0,  0,  4,  0, 0, 0, 4, // Size (int32_t) and contents of element 4
+    0,  0,  0,  4,  0, 0, 0, 5, // Size (int32_t) and contents of element 5
+    0,  0,  0,  4,  0, 0, 0, 6  // Size (int32_t) and contents of element 6
+  };
+  Decoder decoder(input, 44);
+  DataType::ConstPtr element_data_type(new DataType(CASS_VALUE_TYPE_INT));
+  CollectionType::ConstPtr data_type = CollectionType::list(element_data_type, false);
+  Value value(data_type, 6, decoder);
+
+  CassIterator* it = cass_iterator_from_collection(CassValue::to(&value));
+  cass_int32_t output[5];
+  size_t count_read = 0;
+  EXPECT_EQ(CASS_ERROR_LIB_INVALID_DATA,
+            cass_iterator_next_int32_array(it, output, 5, &count_read));
+  EXPECT_EQ(cass_true, cass_iterator_next(it)); // Not advanced
+  const CassValue* element = cass_iterator_get_value(it);
+  cass_int32_t element_value;
+  EXPECT_EQ(CASS_OK, cass_value_get_int32(element, &element_value));
+  EXPECT_EQ(1, element_value);
+  cass_iterator_free(it);
+}
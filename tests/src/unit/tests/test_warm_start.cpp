@@ -0,0 +1,97 @@
+/*
+  Copyright (c) DataStax, Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "serialization.hpp"
+#include "warm_start.hpp"
+
+using namespace datastax;
+using namespace datastax::internal;
+using namespace datastax::internal::core;
+
+static void append_int32(int32_t value, String* output) {
+  char buf[sizeof(int32_t)];
+  encode_int32(buf, value);
+  output->append(buf, sizeof(int32_t));
+}
+
+static ResultResponse::Ptr prepared_result(const String& id) {
+  String body;
+  append_int32(CASS_RESULT_KIND_PREPARED, &body);
+  char buf[sizeof(uint16_t)];
+  encode_uint16(buf, static_cast<uint16_t>(id.size()));
+  body.append(buf, sizeof(uint16_t));
+  body.append(id);
+  for (int i = 0; i < 5; ++i) { // Metadata (flags, columns, pk count) and result metadata
+    append_int32(0, &body);
+  }
+
+  ResultResponse::Ptr result(new ResultResponse());
+  result->set_buffer(body.size());
+  memcpy(result->data(), body.data(), body.size());
+  Decoder decoder(result->data(), body.size(), ProtocolVersion(CASS_PROTOCOL_VERSION_V4));
+  EXPECT_TRUE(result->decode(decoder));
+  return result;
+}
+
+static WarmStartSnapshot::Ptr snapshot() {
+  WarmStartSnapshot::Ptr snapshot(
+      new WarmStartSnapshot(ProtocolVersion(CASS_PROTOCOL_VERSION_V4), "keyspace"));
+  Host::Ptr host(new Host(Address("127.0.0.1", 9042)));
+  host->set_rack_and_dc("rack1", "dc1");
+  snapshot->add_host(host);
+  EXPECT_TRUE(snapshot->add_prepared(PreparedMetadata::Entry::Ptr(
+      new PreparedMetadata::Entry("SELECT * FROM table", "", "", prepared_result("abc")))));
+  return snapshot;
+}
+
+TEST(WarmStartUnitTest, EncodeAndDecode) {
+  String data(snapshot()->encode());
+
+  WarmStartSnapshot decoded;
+  ASSERT_TRUE(decoded.decode(data.data(), data.size()));
+  EXPECT_EQ(ProtocolVersion(CASS_PROTOCOL_VERSION_V4), decoded.protocol_version());
+  EXPECT_EQ("keyspace", decoded.keyspace());
+
+  ASSERT_EQ(1u, decoded.hosts().size());
+  EXPECT_EQ(Address("127.0.0.1", 9042), decoded.hosts()[0].address);
+  EXPECT_EQ("dc1", decoded.hosts()[0].dc);
+  EXPECT_EQ("rack1", decoded.hosts()[0].rack);
+
+  ASSERT_EQ(1u, decoded.prepared().size());
+  EXPECT_EQ("SELECT * FROM table", decoded.prepared()[0].query);
+  ResultResponse::Ptr result(decoded.decode_result(decoded.prepared()[0]));
+  ASSERT_TRUE(result);
+  EXPECT_EQ("abc", result->prepared_id().to_string());
+
+  // Truncated or corrupt snapshots are invalid
+  EXPECT_FALSE(decoded.decode(data.data(), data.size() - 1));
+  data[0] = 'X';
+  EXPECT_FALSE(decoded.decode(data.data(), data.size()));
+}
+
+TEST(WarmStartUnitTest, IsValidFor) {
+  WarmStartSnapshot::Ptr snapshot(::snapshot());
+  ProtocolVersion v4(CASS_PROTOCOL_VERSION_V4);
+  Host::Ptr host(new Host(Address("127.0.0.1", 9042)));
+
+  EXPECT_TRUE(snapshot->is_valid_for(host, v4, "keyspace"));
+  EXPECT_FALSE(snapshot->is_valid_for(host, ProtocolVersion(CASS_PROTOCOL_VERSION_V3), "keyspace"));
+  EXPECT_FALSE(snapshot->is_valid_for(host, v4, "other"));
+  EXPECT_FALSE(
+      snapshot->is_valid_for(Host::Ptr(new Host(Address("127.0.0.2", 9042))), v4, "keyspace"));
+}